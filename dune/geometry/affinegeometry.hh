@@ -9,9 +9,12 @@
  */
 
 #include <cmath>
+#include <cstddef>
 
 #include <dune/common/fmatrix.hh>
 #include <dune/common/fvector.hh>
+#include <dune/common/simd.hh>
+#include <dune/common/unused.hh>
 
 #include <dune/geometry/type.hh>
 
@@ -225,6 +228,18 @@ namespace Dune
       template< int n >
       static void cholesky_L ( const FieldMatrix< ctype, n, n > &A, FieldMatrix< ctype, n, n > &ret )
       {
+        const bool positiveDefinite = cholesky_L( A, ret, ctype( 0 ) );
+        assert( positiveDefinite );
+        DUNE_UNUSED_PARAMETER( positiveDefinite );
+      }
+
+      // returns whether each pivot exceeds tolerance times the corresponding
+      // diagonal entry of A, i.e., whether A is (numerically) positive definite
+      template< int n >
+      static bool cholesky_L ( const FieldMatrix< ctype, n, n > &A, FieldMatrix< ctype, n, n > &ret, const ctype &tolerance )
+      {
+        using std::sqrt;
+        bool positiveDefinite = true;
         for( int i = 0; i < n; ++i )
         {
           ctype &rii = ret[ i ][ i ];
@@ -232,7 +247,7 @@ namespace Dune
           ctype xDiag = A[ i ][ i ];
           for( int j = 0; j < i; ++j )
             xDiag -= ret[ i ][ j ] * ret[ i ][ j ];
-          assert( xDiag > ctype( 0 ) );
+          positiveDefinite = positiveDefinite && all_true( xDiag > tolerance * A[ i ][ i ] );
           rii = sqrt( xDiag );
 
           ctype invrii = ctype( 1 ) / rii;
@@ -244,6 +259,7 @@ namespace Dune
             ret[ k ][ i ] = invrii * x;
           }
         }
+        return positiveDefinite;
       }
 
       template< int n >
@@ -319,6 +335,18 @@ namespace Dune
         return det;
       }
 
+      // returns zero instead of asserting if A is not positive definite, see cholesky_L
+      template< int n >
+      static ctype spdInvA ( FieldMatrix< ctype, n, n > &A, const ctype &tolerance )
+      {
+        FieldMatrix< ctype, n, n > L;
+        if( !cholesky_L( A, L, tolerance ) )
+          return ctype( 0 );
+        const ctype det = invL( L );
+        LTL( L, A );
+        return det;
+      }
+
       // calculate x := A^{-1} x
       template< int n >
       static void spdInvAx ( FieldMatrix< ctype, n, n > &A, FieldVector< ctype, n > &x )
@@ -436,6 +464,38 @@ namespace Dune
         }
       }
 
+      /** \brief Compute right pseudo-inverse of matrix A, detecting rank deficiency
+       *
+       *  Unlike rightInvA( A, ret ), this does not assert that A has full
+       *  rank.  Rows of A that are linearly dependent up to the relative
+       *  tolerance yield zero, leaving ret unspecified.
+       */
+      template< int m, int n >
+      static ctype rightInvA ( const FieldMatrix< ctype, m, n > &A, FieldMatrix< ctype, n, m > &ret, const ctype &tolerance )
+      {
+        static_assert((n >= m), "Matrix has no right inverse.");
+        using std::abs;
+        if( (n == 2) && (m == 2) )
+        {
+          // compare det^2 = |a_0|^2 |a_1|^2 sin^2 to the rows, as cholesky_L does
+          const ctype det = (A[ 0 ][ 0 ]*A[ 1 ][ 1 ] - A[ 1 ][ 0 ]*A[ 0 ][ 1 ]);
+          const ctype norms = (A[ 0 ][ 0 ]*A[ 0 ][ 0 ] + A[ 0 ][ 1 ]*A[ 0 ][ 1 ]) * (A[ 1 ][ 0 ]*A[ 1 ][ 0 ] + A[ 1 ][ 1 ]*A[ 1 ][ 1 ]);
+          if( !all_true( det*det > tolerance * norms ) )
+            return ctype( 0 );
+          return rightInvA( A, ret );
+        }
+        else
+        {
+          FieldMatrix< ctype, m , m > aat;
+          AAT_L( A, aat );
+          const ctype det = spdInvA( aat, tolerance );
+          if( !all_true( det > ctype( 0 ) ) )
+            return ctype( 0 );
+          ATBT( A , aat , ret );
+          return det;
+        }
+      }
+
       template< int m, int n >
       static void xTRightInvA ( const FieldMatrix< ctype, m, n > &A, const FieldVector< ctype, n > &x, FieldVector< ctype, m > &y )
       {
@@ -573,6 +633,31 @@ namespace Dune
       return local;
     }
 
+    /** \brief Evaluate the inverse mapping in a set of global points
+     *
+     *  \param[in]   globals  random access container of global coordinates
+     *  \param[out]  locals   array receiving the local coordinates
+     *  \param[out]  inside   array receiving for each point, whether its local
+     *                        coordinate lies inside the reference element
+     *                        (may be \c nullptr)
+     *
+     *  The inside flags use Impl::insideTolerance, as those of
+     *  MultiLinearGeometry do.
+     *
+     *  \note Each output array must hold at least globals.size() entries.
+     */
+    template< class GlobalPoints >
+    void local ( const GlobalPoints &globals, LocalCoordinate *locals, bool *inside = nullptr ) const
+    {
+      const std::size_t size = globals.size();
+      for( std::size_t i = 0; i < size; ++i )
+      {
+        jacobianInverseTransposed_.mtv( globals[ i ] - origin_, locals[ i ] );
+        if( inside )
+          inside[ i ] = refElement_->checkInside( locals[ i ] );
+      }
+    }
+
     /** \brief Obtain the integration element
      *
      *  If the Jacobian of the mapping is denoted by $J(x)$, the integration
@@ -0,0 +1,194 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+/** \file
+ *  \brief throughput of the geometry mappings
+ *
+ *  For every geometry class, dimension pair and geometry type, the methods
+ *  global, local, jacobianTransposed, jacobianInverseTransposed and
+ *  integrationElement are evaluated in the points of a quadrature rule.
+ *  The MultiLinearGeometry classes are measured for an affine and for a
+ *  (non-affine) multilinear mapping.
+ */
+
+#include <config.h>
+
+#include <bitset>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+
+#include <dune/geometry/affinegeometry.hh>
+#include <dune/geometry/axisalignedcubegeometry.hh>
+#include <dune/geometry/multilineargeometry.hh>
+#include <dune/geometry/quadraturerules.hh>
+#include <dune/geometry/referenceelements.hh>
+#include <dune/geometry/type.hh>
+
+#include <dune/geometry/benchmark/benchmark.hh>
+
+using Dune::Benchmark::Options;
+
+template< class ctype >
+const char *ctypeName ();
+
+template<>
+const char *ctypeName< float > () { return "float"; }
+
+template<>
+const char *ctypeName< double > () { return "double"; }
+
+const char *typeName ( const Dune::GeometryType &type )
+{
+  if( type.isSimplex() )
+    return "simplex";
+  if( type.isCube() )
+    return "cube";
+  if( type.isPrism() )
+    return "prism";
+  if( type.isPyramid() )
+    return "pyramid";
+  return "other";
+}
+
+
+template< class Geometry >
+void benchmarkGeometry ( const Options &options, const std::string &className, const std::string &mapping,
+                         const Geometry &geometry )
+{
+  typedef typename Geometry::ctype ctype;
+  const int mydim = Geometry::mydimension;
+  const int cdim = Geometry::coorddimension;
+
+  const Dune::QuadratureRule< ctype, mydim > &quadrature = Dune::QuadratureRules< ctype, mydim >::rule( geometry.type(), 2 );
+  std::vector< typename Geometry::LocalCoordinate > locals;
+  std::vector< typename Geometry::GlobalCoordinate > globals;
+  for( const auto &qp : quadrature )
+  {
+    locals.push_back( qp.position() );
+    globals.push_back( geometry.global( qp.position() ) );
+  }
+  const std::size_t size = locals.size();
+
+  auto benchmark = [ & ] ( const std::string &method, auto &&f ) {
+    const std::string name = className + "/" + ctypeName< ctype >() + "/" + std::to_string( mydim ) + "/" + std::to_string( cdim )
+                             + "/" + typeName( geometry.type() ) + "/" + mapping + "/" + method;
+    if( !options.selected( name ) )
+      return;
+
+    const Dune::Benchmark::Result result = Dune::Benchmark::measure( options, [ & ] ( std::size_t n ) {
+        for( std::size_t i = 0, k = 0; i < n; ++i )
+        {
+          Dune::Benchmark::doNotOptimize( f( k ) );
+          k = (k+1 < size ? k+1 : 0);
+        }
+      } );
+
+    std::cout << Dune::Benchmark::Record( "geometry" )
+    .add( "class", className ).add( "ctype", ctypeName< ctype >() )
+    .add( "mydim", mydim ).add( "cdim", cdim )
+    .add( "type", typeName( geometry.type() ) ).add( "mapping", mapping )
+    .add( "method", method ).add( result ) << std::endl;
+  };
+
+  benchmark( "global", [ & ] ( std::size_t k ) { return geometry.global( locals[ k ] ); } );
+  benchmark( "local", [ & ] ( std::size_t k ) { return geometry.local( globals[ k ] ); } );
+  benchmark( "jacobianTransposed", [ & ] ( std::size_t k ) { return geometry.jacobianTransposed( locals[ k ] ); } );
+  benchmark( "jacobianInverseTransposed", [ & ] ( std::size_t k ) { return geometry.jacobianInverseTransposed( locals[ k ] ); } );
+  benchmark( "integrationElement", [ & ] ( std::size_t k ) { return geometry.integrationElement( locals[ k ] ); } );
+}
+
+
+template< class ctype, int mydim, int cdim >
+void benchmarkGeometries ( const Options &options )
+{
+  // an affine mapping with full rank Jacobian
+  Dune::FieldVector< ctype, cdim > origin;
+  Dune::FieldMatrix< ctype, mydim, cdim > jt;
+  for( int j = 0; j < cdim; ++j )
+  {
+    origin[ j ] = ctype( 0.5 ) + ctype( 0.25 )*j;
+    for( int i = 0; i < mydim; ++i )
+      jt[ i ][ j ] = (i == j ? ctype( 1 ) + ctype( 0.25 )*i : ctype( 0.125 )*(i+j+1));
+  }
+
+  // the lowest bit of a topology id is insignificant
+  for( unsigned int topologyId = 0; topologyId < Dune::Impl::numTopologies( mydim ); topologyId += 2 )
+  {
+    const Dune::GeometryType type( topologyId, mydim );
+    const Dune::ReferenceElement< ctype, mydim > &refElement = Dune::ReferenceElements< ctype, mydim >::general( type );
+
+    // corners of the affine mapping and of a distorted, multilinear mapping
+    std::vector< Dune::FieldVector< ctype, cdim > > affineCorners, corners;
+    for( int i = 0; i < refElement.size( mydim ); ++i )
+    {
+      const Dune::FieldVector< ctype, mydim > &x = refElement.position( i, mydim );
+      Dune::FieldVector< ctype, cdim > y( origin );
+      jt.umtv( x, y );
+      affineCorners.push_back( y );
+      if( mydim > 1 )
+        y[ cdim-1 ] += ctype( 0.25 )*x[ 0 ]*x[ mydim-1 ];
+      corners.push_back( y );
+    }
+
+    benchmarkGeometry( options, "AffineGeometry", "affine",
+                       Dune::AffineGeometry< ctype, mydim, cdim >( refElement, origin, jt ) );
+
+    benchmarkGeometry( options, "MultiLinearGeometry", "affine",
+                       Dune::MultiLinearGeometry< ctype, mydim, cdim >( refElement, affineCorners ) );
+    benchmarkGeometry( options, "CachedMultiLinearGeometry", "affine",
+                       Dune::CachedMultiLinearGeometry< ctype, mydim, cdim >( refElement, affineCorners ) );
+    if( !type.isSimplex() )
+    {
+      benchmarkGeometry( options, "MultiLinearGeometry", "multilinear",
+                         Dune::MultiLinearGeometry< ctype, mydim, cdim >( refElement, corners ) );
+      benchmarkGeometry( options, "CachedMultiLinearGeometry", "multilinear",
+                         Dune::CachedMultiLinearGeometry< ctype, mydim, cdim >( refElement, corners ) );
+    }
+
+    if( type.isCube() )
+    {
+      Dune::FieldVector< ctype, cdim > upper( origin );
+      std::bitset< cdim > axes;
+      for( int i = 0; i < mydim; ++i )
+      {
+        upper[ i ] += jt[ i ][ i ];
+        axes[ i ] = true;
+      }
+      benchmarkGeometry( options, "AxisAlignedCubeGeometry", "affine",
+                         Dune::AxisAlignedCubeGeometry< ctype, mydim, cdim >( origin, upper, axes ) );
+    }
+  }
+}
+
+
+template< class ctype >
+void benchmarkGeometries ( const Options &options )
+{
+  benchmarkGeometries< ctype, 1, 1 >( options );
+  benchmarkGeometries< ctype, 1, 2 >( options );
+  benchmarkGeometries< ctype, 1, 3 >( options );
+  benchmarkGeometries< ctype, 2, 2 >( options );
+  benchmarkGeometries< ctype, 2, 3 >( options );
+  benchmarkGeometries< ctype, 3, 3 >( options );
+}
+
+
+int main ( int argc, char **argv )
+try
+{
+  const Options options = Dune::Benchmark::parseOptions( argc, argv );
+  benchmarkGeometries< double >( options );
+  benchmarkGeometries< float >( options );
+  return 0;
+}
+catch( const Dune::Exception &e )
+{
+  std::cerr << e << std::endl;
+  return 1;
+}
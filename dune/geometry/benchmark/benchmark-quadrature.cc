@@ -0,0 +1,110 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+/** \file
+ *  \brief latency of QuadratureRules::rule under thread contention
+ *
+ *  A number of threads concurrently look up existing quadrature rules.  The
+ *  orders are chosen from the three storage classes of QuadratureRules: the
+ *  lock-free table (order < numFastOrders), the preallocated slots (order <
+ *  numCachedOrders) and the map of higher orders.  The reported time is the
+ *  wall clock time per lookup, i.e., it equals the latency of a single
+ *  lookup if the threads do not slow each other down.
+ */
+
+#include <config.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dune/common/exceptions.hh>
+
+#include <dune/geometry/quadraturerules.hh>
+#include <dune/geometry/type.hh>
+
+#include <dune/geometry/benchmark/benchmark.hh>
+
+using Dune::Benchmark::Options;
+
+template< int dim >
+void benchmarkLookup ( const Options &options, const Dune::GeometryType &type, const std::string &typeName,
+                       const std::string &storage, int firstOrder, int lastOrder, unsigned int numThreads )
+{
+  typedef Dune::QuadratureRules< double, dim > Rules;
+
+  const std::string name = std::string( "rule/" ) + std::to_string( dim ) + "/" + typeName + "/" + storage
+                           + "/" + std::to_string( numThreads );
+  if( !options.selected( name ) )
+    return;
+
+  // create the rules up front, we only want to measure the lookup
+  for( int p = firstOrder; p < lastOrder; ++p )
+    Rules::rule( type, p );
+
+  const Dune::Benchmark::Result result = Dune::Benchmark::measure( options, [ & ] ( std::size_t n ) {
+      auto lookup = [ & ] () {
+        for( std::size_t i = 0, p = firstOrder; i < n; ++i )
+        {
+          Dune::Benchmark::doNotOptimize( Rules::rule( type, p ) );
+          p = (p+1 < std::size_t( lastOrder ) ? p+1 : firstOrder);
+        }
+      };
+
+      std::vector< std::thread > threads;
+      for( unsigned int t = 1; t < numThreads; ++t )
+        threads.emplace_back( lookup );
+      lookup();
+      for( std::thread &thread : threads )
+        thread.join();
+    } );
+
+  std::cout << Dune::Benchmark::Record( "quadrature" )
+  .add( "method", "rule" ).add( "ctype", "double" ).add( "dim", dim )
+  .add( "type", typeName ).add( "storage", storage )
+  .add( "orders", std::to_string( firstOrder ) + "-" + std::to_string( lastOrder-1 ) )
+  .add( "threads", numThreads ).add( result ) << std::endl;
+}
+
+
+template< int dim >
+void benchmarkLookup ( const Options &options, const Dune::GeometryType &type, const std::string &typeName )
+{
+  typedef Dune::QuadratureRules< double, dim > Rules;
+
+  std::vector< unsigned int > numThreads;
+  const unsigned int maxThreads = std::max( std::thread::hardware_concurrency(), 1u );
+  for( unsigned int t = 1; t < maxThreads; t *= 2 )
+    numThreads.push_back( t );
+  numThreads.push_back( maxThreads );
+
+  for( unsigned int t : numThreads )
+  {
+    benchmarkLookup< dim >( options, type, typeName, "fast", 0, Rules::numFastOrders, t );
+    benchmarkLookup< dim >( options, type, typeName, "cached", Rules::numFastOrders, Rules::numCachedOrders, t );
+    benchmarkLookup< dim >( options, type, typeName, "high", Rules::numCachedOrders, Rules::numCachedOrders+4, t );
+  }
+}
+
+
+int main ( int argc, char **argv )
+try
+{
+  const Options options = Dune::Benchmark::parseOptions( argc, argv );
+  benchmarkLookup< 1 >( options, Dune::GeometryType( Dune::GeometryType::cube, 1 ), "cube" );
+  benchmarkLookup< 2 >( options, Dune::GeometryType( Dune::GeometryType::simplex, 2 ), "simplex" );
+  benchmarkLookup< 2 >( options, Dune::GeometryType( Dune::GeometryType::cube, 2 ), "cube" );
+  benchmarkLookup< 3 >( options, Dune::GeometryType( Dune::GeometryType::simplex, 3 ), "simplex" );
+  benchmarkLookup< 3 >( options, Dune::GeometryType( Dune::GeometryType::cube, 3 ), "cube" );
+  benchmarkLookup< 3 >( options, Dune::GeometryType( Dune::GeometryType::prism, 3 ), "prism" );
+  benchmarkLookup< 3 >( options, Dune::GeometryType( Dune::GeometryType::pyramid, 3 ), "pyramid" );
+  return 0;
+}
+catch( const Dune::Exception &e )
+{
+  std::cerr << e << std::endl;
+  return 1;
+}
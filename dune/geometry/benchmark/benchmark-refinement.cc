@@ -0,0 +1,212 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+/** \file
+ *  \brief iteration rates of the static and virtual refinement
+ *
+ *  For each supported pair of element type and refined element type, a
+ *  single operation is a complete sweep over the vertices (reading the
+ *  coordinates) or the elements (reading the vertex indices and the
+ *  coordinates of the center) of a refinement level.  The interface
+ *  "foreach" performs the same sweeps by forEachVertex() and
+ *  forEachElement(), which select the static refinement at run time.  The
+ *  case "export"
+ *  writes the vertex coordinates and the vertex indices of the elements of
+ *  a level by exportLevel(), the case "table" obtains the shared table of
+ *  a level (after its creation in the first call).  The case "range" obtains
+ *  the iterator range of the second half of the elements by eRange(), which
+ *  only requires seeking for the random access iterators of the hypercube
+ *  and simplex refinements.
+ */
+
+#include <config.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/fvector.hh>
+
+#include <dune/geometry/refinement.hh>
+#include <dune/geometry/type.hh>
+#include <dune/geometry/virtualrefinement.hh>
+
+#include <dune/geometry/benchmark/benchmark.hh>
+
+using Dune::Benchmark::Options;
+
+const char *typeName ( const Dune::GeometryType &type )
+{
+  if( type.isCube() )
+    return "cube";
+  if( type.isSimplex() )
+    return "simplex";
+  if( type.isPrism() )
+    return "prism";
+  if( type.isPyramid() )
+    return "pyramid";
+  return "other";
+}
+
+
+template< class VertexIterator >
+void sweepVertices ( VertexIterator it, const VertexIterator &end )
+{
+  typename VertexIterator::CoordVector sum( 0 );
+  for( ; it != end; ++it )
+    sum += it.coords();
+  Dune::Benchmark::doNotOptimize( sum );
+}
+
+template< class ElementIterator >
+void sweepElements ( ElementIterator it, const ElementIterator &end )
+{
+  typename ElementIterator::CoordVector sum( 0 );
+  int indices = 0;
+  for( ; it != end; ++it )
+  {
+    const auto vertexIndices = it.vertexIndices();
+    for( std::size_t i = 0; i < vertexIndices.size(); ++i )
+      indices += vertexIndices[ i ];
+    sum += it.coords();
+  }
+  Dune::Benchmark::doNotOptimize( sum );
+  Dune::Benchmark::doNotOptimize( indices );
+}
+
+
+template< class CoordVector >
+struct VertexVisitor
+{
+  template< class VertexIterator >
+  void operator() ( const VertexIterator &it ) { sum += it.coords(); }
+
+  CoordVector sum = CoordVector( 0 );
+};
+
+template< class CoordVector >
+struct ElementVisitor
+{
+  template< class ElementIterator >
+  void operator() ( const ElementIterator &it )
+  {
+    const auto vertexIndices = it.vertexIndices();
+    for( std::size_t i = 0; i < vertexIndices.size(); ++i )
+      indices += vertexIndices[ i ];
+    sum += it.coords();
+  }
+
+  CoordVector sum = CoordVector( 0 );
+  int indices = 0;
+};
+
+
+template< int dim, class Sweep >
+void benchmarkSweep ( const Options &options, const std::string &interface,
+                      const Dune::GeometryType &type, const Dune::GeometryType &coerceTo,
+                      int level, const std::string &entity, int count, Sweep &&sweep )
+{
+  const std::string name = interface + "/" + std::to_string( dim ) + "/" + typeName( type ) + "/" + typeName( coerceTo )
+                           + "/" + std::to_string( level ) + "/" + entity;
+  if( !options.selected( name ) )
+    return;
+
+  const Dune::Benchmark::Result result = Dune::Benchmark::measure( options, [ & ] ( std::size_t n ) {
+      for( std::size_t i = 0; i < n; ++i )
+        sweep();
+    } );
+
+  std::cout << Dune::Benchmark::Record( "refinement" )
+  .add( "interface", interface ).add( "ctype", "double" ).add( "dim", dim )
+  .add( "type", typeName( type ) ).add( "coerceTo", typeName( coerceTo ) )
+  .add( "level", level ).add( "entity", entity ).add( "count", count )
+  .add( result ).add( "ns_per_entity", result.nsPerOp / count ) << std::endl;
+}
+
+
+template< unsigned int topologyId, unsigned int coerceToId, int dim >
+void benchmarkRefinement ( const Options &options )
+{
+  typedef Dune::StaticRefinement< topologyId, double, coerceToId, dim > StaticRefinement;
+  typedef Dune::VirtualRefinement< dim, double > VirtualRefinement;
+
+  const Dune::GeometryType type( topologyId, dim ), coerceTo( coerceToId, dim );
+  const VirtualRefinement &virtualRefinement = Dune::buildRefinement< dim, double >( type, coerceTo );
+
+  for( int level : { 1, 3, 5 } )
+  {
+    benchmarkSweep< dim >( options, "static", type, coerceTo, level, "vertex", StaticRefinement::nVertices( level ),
+                           [ level ] () { sweepVertices( StaticRefinement::vBegin( level ), StaticRefinement::vEnd( level ) ); } );
+    benchmarkSweep< dim >( options, "static", type, coerceTo, level, "element", StaticRefinement::nElements( level ),
+                           [ level ] () { sweepElements( StaticRefinement::eBegin( level ), StaticRefinement::eEnd( level ) ); } );
+
+    benchmarkSweep< dim >( options, "virtual", type, coerceTo, level, "vertex", virtualRefinement.nVertices( level ),
+                           [ & ] () { sweepVertices( virtualRefinement.vBegin( level ), virtualRefinement.vEnd( level ) ); } );
+    benchmarkSweep< dim >( options, "virtual", type, coerceTo, level, "element", virtualRefinement.nElements( level ),
+                           [ & ] () { sweepElements( virtualRefinement.eBegin( level ), virtualRefinement.eEnd( level ) ); } );
+
+    typedef typename VirtualRefinement::CoordVector CoordVector;
+    benchmarkSweep< dim >( options, "foreach", type, coerceTo, level, "vertex", virtualRefinement.nVertices( level ),
+                           [ & ] () {
+                             VertexVisitor< CoordVector > visitor;
+                             Dune::forEachVertex< dim, double >( type, coerceTo, level, visitor );
+                             Dune::Benchmark::doNotOptimize( visitor.sum );
+                           } );
+    benchmarkSweep< dim >( options, "foreach", type, coerceTo, level, "element", virtualRefinement.nElements( level ),
+                           [ & ] () {
+                             ElementVisitor< CoordVector > visitor;
+                             Dune::forEachElement< dim, double >( type, coerceTo, level, visitor );
+                             Dune::Benchmark::doNotOptimize( visitor.sum );
+                             Dune::Benchmark::doNotOptimize( visitor.indices );
+                           } );
+
+    std::vector< double > coords( StaticRefinement::nVertices( level )*dim );
+    std::vector< int > connectivity( StaticRefinement::nElements( level )*StaticRefinement::nCorners() );
+    benchmarkSweep< dim >( options, "static", type, coerceTo, level, "export", StaticRefinement::nElements( level ),
+                           [ & ] () { StaticRefinement::exportLevel( level, coords.data(), connectivity.data() ); } );
+    benchmarkSweep< dim >( options, "virtual", type, coerceTo, level, "export", virtualRefinement.nElements( level ),
+                           [ & ] () { virtualRefinement.exportLevel( level, coords.data(), connectivity.data() ); } );
+
+    benchmarkSweep< dim >( options, "static", type, coerceTo, level, "table", StaticRefinement::nElements( level ),
+                           [ level ] () { Dune::Benchmark::doNotOptimize( StaticRefinement::table( level ) ); } );
+    benchmarkSweep< dim >( options, "virtual", type, coerceTo, level, "table", virtualRefinement.nElements( level ),
+                           [ & ] () { Dune::Benchmark::doNotOptimize( virtualRefinement.table( level ) ); } );
+
+    const int nElements = StaticRefinement::nElements( level );
+    benchmarkSweep< dim >( options, "static", type, coerceTo, level, "range", 1,
+                           [ level, nElements ] () { Dune::Benchmark::doNotOptimize( StaticRefinement::eRange( level, nElements/2, nElements ) ); } );
+  }
+}
+
+
+int main ( int argc, char **argv )
+try
+{
+  using Dune::Impl::Point;
+  typedef Dune::Impl::Prism< Point > Line;
+  typedef Dune::Impl::Prism< Line > Square;
+  typedef Dune::Impl::Pyramid< Line > Triangle;
+  typedef Dune::Impl::Prism< Square > Cube;
+  typedef Dune::Impl::Pyramid< Square > Pyramid;
+  typedef Dune::Impl::Prism< Triangle > Prism;
+  typedef Dune::Impl::Pyramid< Triangle > Tet;
+
+  const Options options = Dune::Benchmark::parseOptions( argc, argv );
+  benchmarkRefinement< Line::id, Line::id, 1 >( options );
+  benchmarkRefinement< Triangle::id, Triangle::id, 2 >( options );
+  benchmarkRefinement< Square::id, Square::id, 2 >( options );
+  benchmarkRefinement< Square::id, Triangle::id, 2 >( options );
+  benchmarkRefinement< Tet::id, Tet::id, 3 >( options );
+  benchmarkRefinement< Pyramid::id, Tet::id, 3 >( options );
+  benchmarkRefinement< Prism::id, Tet::id, 3 >( options );
+  benchmarkRefinement< Cube::id, Cube::id, 3 >( options );
+  benchmarkRefinement< Cube::id, Tet::id, 3 >( options );
+  return 0;
+}
+catch( const Dune::Exception &e )
+{
+  std::cerr << e << std::endl;
+  return 1;
+}
@@ -0,0 +1,206 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_BENCHMARK_BENCHMARK_HH
+#define DUNE_GEOMETRY_BENCHMARK_BENCHMARK_HH
+
+/** \file
+ *  \brief minimal timing harness shared by the microbenchmarks
+ *
+ *  Each benchmark program writes one JSON object per line to std::cout
+ *  (JSON lines), e.g.
+ *  \code
+ *  {"benchmark":"geometry","class":"AffineGeometry",...,"iterations":1048576,"ns_per_op":2.31}
+ *  \endcode
+ *  so that the output of several runs can be compared by a script.  All
+ *  programs accept the options
+ *  - <tt>--min-time <seconds></tt>: minimum duration of a single timed run
+ *    (default 0.01),
+ *  - <tt>--repetitions <n></tt>: number of timed runs, of which the fastest
+ *    is reported (default 5),
+ *  - <tt>--filter <string></tt>: only run the cases whose name contains the
+ *    given string.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include <dune/common/exceptions.hh>
+
+namespace Dune
+{
+
+  namespace Benchmark
+  {
+
+    // doNotOptimize
+    // -------------
+
+    /** \brief prevent the compiler from optimizing away the computation of a
+     *         value
+     */
+    template< class T >
+    inline void doNotOptimize ( const T &value )
+    {
+#if defined(__GNUC__)
+      asm volatile ( "" : : "r" (&value) : "memory" );
+#else
+      static const void *volatile sink;
+      sink = &value;
+#endif
+    }
+
+
+
+    // Options
+    // -------
+
+    //! command line options common to all benchmark programs
+    struct Options
+    {
+      double minTime = 0.01;
+      int repetitions = 5;
+      std::string filter;
+
+      //! check whether a case is selected by the filter
+      bool selected ( const std::string &name ) const
+      {
+        return filter.empty() || (name.find( filter ) != std::string::npos);
+      }
+    };
+
+    //! parse the command line (throws Dune::Exception on invalid options)
+    inline Options parseOptions ( int argc, char **argv )
+    {
+      Options options;
+      for( int i = 1; i < argc; ++i )
+      {
+        const std::string option = argv[ i ];
+        if( i+1 >= argc )
+          DUNE_THROW( Exception, "Missing argument to option '" << option << "'" );
+        const std::string value = argv[ ++i ];
+        if( option == "--min-time" )
+          options.minTime = std::atof( value.c_str() );
+        else if( option == "--repetitions" )
+          options.repetitions = std::max( std::atoi( value.c_str() ), 1 );
+        else if( option == "--filter" )
+          options.filter = value;
+        else
+          DUNE_THROW( Exception, "Unknown option '" << option << "'" );
+      }
+      return options;
+    }
+
+
+
+    // Result
+    // ------
+
+    //! result of timing a benchmark case
+    struct Result
+    {
+      //! number of operations per timed run
+      std::size_t iterations;
+      //! time per operation of the fastest run in nanoseconds
+      double nsPerOp;
+    };
+
+    /** \brief time a benchmark case
+     *
+     *  The functor is called as <tt>f( n )</tt> and has to perform n
+     *  operations.  The number n is doubled until a single call takes at
+     *  least options.minTime seconds.  Then, options.repetitions calls are
+     *  timed and the fastest one is reported.
+     */
+    template< class F >
+    inline Result measure ( const Options &options, F &&f )
+    {
+      typedef std::chrono::steady_clock Clock;
+      auto run = [ &f ] ( std::size_t n ) {
+        const Clock::time_point start = Clock::now();
+        f( n );
+        return std::chrono::duration< double >( Clock::now() - start ).count();
+      };
+
+      std::size_t n = 1;
+      while( (run( n ) < options.minTime) && (n < (std::numeric_limits< std::size_t >::max() >> 1)) )
+        n *= 2;
+
+      double best = std::numeric_limits< double >::max();
+      for( int i = 0; i < options.repetitions; ++i )
+        best = std::min( best, run( n ) );
+      return Result{ n, 1e9 * best / double( n ) };
+    }
+
+
+
+    // Record
+    // ------
+
+    /** \brief one line of benchmark output
+     *
+     *  A record collects key value pairs and is written as a single JSON
+     *  object.
+     */
+    class Record
+    {
+    public:
+      explicit Record ( const std::string &benchmark ) { add( "benchmark", benchmark ); }
+
+      Record &add ( const std::string &key, const std::string &value )
+      {
+        std::string quoted = "\"";
+        for( char c : value )
+        {
+          if( (c == '"') || (c == '\\') )
+            quoted += '\\';
+          quoted += c;
+        }
+        return addRaw( key, quoted + "\"" );
+      }
+
+      Record &add ( const std::string &key, const char *value ) { return add( key, std::string( value ) ); }
+
+      template< class T, std::enable_if_t< std::is_integral< T >::value, int > = 0 >
+      Record &add ( const std::string &key, T value ) { return addRaw( key, std::to_string( value ) ); }
+
+      Record &add ( const std::string &key, double value )
+      {
+        std::ostringstream s;
+        s << std::setprecision( 6 ) << value;
+        return addRaw( key, s.str() );
+      }
+
+      //! add the result of measure()
+      Record &add ( const Result &result )
+      {
+        return add( "iterations", result.iterations ).add( "ns_per_op", result.nsPerOp );
+      }
+
+      friend std::ostream &operator<< ( std::ostream &out, const Record &record )
+      {
+        return out << "{" << record.fields_ << "}";
+      }
+
+    private:
+      Record &addRaw ( const std::string &key, const std::string &value )
+      {
+        fields_ += (fields_.empty() ? "\"" : ",\"") + key + "\":" + value;
+        return *this;
+      }
+
+      std::string fields_;
+    };
+
+  } // namespace Benchmark
+
+} // namespace Dune
+
+#endif // #ifndef DUNE_GEOMETRY_BENCHMARK_BENCHMARK_HH
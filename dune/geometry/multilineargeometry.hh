@@ -4,13 +4,16 @@
 #define DUNE_GEOMETRY_MULTILINEARGEOMETRY_HH
 
 #include <cassert>
+#include <cstddef>
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <type_traits>
 #include <vector>
 
 #include <dune/common/fmatrix.hh>
 #include <dune/common/fvector.hh>
+#include <dune/common/simd.hh>
 #include <dune/common/typetraits.hh>
 
 #include <dune/geometry/affinegeometry.hh>
@@ -67,7 +70,7 @@ namespace Dune
     typedef Impl::FieldMatrixHelper< ct > MatrixHelper;
 
     /** \brief tolerance to numerical algorithms */
-    static ct tolerance () { return ct( 16 ) * std::numeric_limits< ct >::epsilon(); }
+    static ct tolerance () { return ct( 16 * std::numeric_limits< SimdScalar< ct > >::epsilon() ); }
 
     /** \brief template specifying the storage for the corners
      *
@@ -184,6 +187,12 @@ namespace Dune
    *
    *  The requirements on the traits are documented along with their default,
    *  MultiLinearGeometryTraits.
+   *
+   *  The coordinate type may also be a SIMD type (as supported by
+   *  dune/common/simd.hh), so that each lane holds the coordinates of a
+   *  different element of the same geometry type.  In this case, local()
+   *  iterates until all lanes have converged and affine() only returns true
+   *  if the mapping is affine in every lane.
    */
   template< class ct, int mydim, int cdim, class Traits = MultiLinearGeometryTraits< ct > >
   class MultiLinearGeometry
@@ -213,6 +222,37 @@ namespace Dune
     //! type of reference element
     typedef Dune::ReferenceElement< ctype, mydimension > ReferenceElement;
 
+    //! outcome of the inverse mapping, see local( const GlobalCoordinate &, LocalCoordinate &, const LocalParameters & )
+    enum class LocalStatus
+    {
+      converged,    //!< the Newton iteration converged
+      outside,      //!< the iterate left the reference element (only reported if requested)
+      singular,     //!< the Jacobian is singular
+      notConverged  //!< the maximum number of iterations was reached
+    };
+
+    //! parameters of the inverse mapping, see local( const GlobalCoordinate &, LocalCoordinate &, const LocalParameters & )
+    struct LocalParameters
+    {
+      LocalParameters ()
+        : tolerance( Traits::tolerance() ), maxIterations( 100 ), maxDampingSteps( 4 ),
+          fixedJacobian( false ), earlyOut( false ), outsideTolerance( ctype( 1 ) / ctype( 4 ) )
+      {}
+
+      //! stop once the squared norm of the Newton update is below this value
+      ctype tolerance;
+      //! maximum number of Newton iterations
+      int maxIterations;
+      //! maximum number of step halvings per iteration (0 disables damping)
+      int maxDampingSteps;
+      //! keep the inverse Jacobian of the first iteration (simplified Newton)
+      bool fixedJacobian;
+      //! stop as soon as an iterate lies outside the reference element by more than outsideTolerance
+      bool earlyOut;
+      //! tolerance for the outside check (ignored for SIMD coordinate types)
+      ctype outsideTolerance;
+    };
+
   private:
     static const bool hasSingleGeometryType = Traits::template hasSingleGeometryType< mydimension >::v;
 
@@ -305,22 +345,107 @@ namespace Dune
      *  \code
      *  (global( x ) - y).two_norm()
      *  \endcode
+     *
+     *  \note The iteration uses the default LocalParameters.  If it does not
+     *        converge, the last iterate is returned; if the Jacobian of an
+     *        affine mapping or in the center is singular, the center of the
+     *        reference element.  Use the overload returning a LocalStatus to
+     *        detect these cases.
      */
     LocalCoordinate local ( const GlobalCoordinate &globalCoord ) const
     {
-      const ctype tolerance = Traits::tolerance();
-      LocalCoordinate x = refElement().position( 0, 0 );
-      LocalCoordinate dx;
-      do
-      {
-        // Newton's method: DF^n dx^n = F^n, x^{n+1} -= dx^n
-        const GlobalCoordinate dglobal = (*this).global( x ) - globalCoord;
-        MatrixHelper::template xTRightInvA< mydimension, coorddimension >( jacobianTransposed( x ), dglobal, dx );
-        x -= dx;
-      } while( dx.two_norm2() > tolerance );
+      LocalCoordinate x;
+      local( globalCoord, x, LocalParameters() );
       return x;
     }
 
+    /** \brief evaluate the inverse mapping, reporting the outcome
+     *
+     *  \copydetails local( const GlobalCoordinate &, LocalCoordinate &, const LocalParameters & ) const
+     */
+    LocalStatus local ( const GlobalCoordinate &globalCoord, LocalCoordinate &x ) const
+    {
+      return local( globalCoord, x, LocalParameters() );
+    }
+
+    /** \brief evaluate the inverse mapping, reporting the outcome
+     *
+     *  For affine mappings, the local coordinate is computed directly.
+     *  Otherwise, a damped Newton method is used.  Its first step from the
+     *  center of the reference element amounts to inverting the affine
+     *  approximation of the mapping.  A step is halved (up to
+     *  parameters.maxDampingSteps times) while it does not decrease the
+     *  residual.
+     *
+     *  \param[in]   globalCoord  global coordinate to map
+     *  \param[out]  x            corresponding local coordinate (the last
+     *                            iterate if the iteration did not converge,
+     *                            the center of the reference element if the
+     *                            Jacobian of an affine mapping or in the
+     *                            center is singular)
+     *  \param[in]   parameters   parameters controlling the iteration
+     *
+     *  \returns status of the inverse mapping
+     *
+     *  \note For SIMD coordinate types, all lanes are iterated until each of
+     *        them has converged.  The iteration is considered converged only
+     *        if all lanes converged.
+     */
+    LocalStatus local ( const GlobalCoordinate &globalCoord, LocalCoordinate &x, const LocalParameters &parameters ) const
+    {
+      JacobianTransposed jt;
+      if( affine( jt ) )
+      {
+        JacobianInverseTransposed jit;
+        jit.setupChecked( jt );
+        return localAffine( corner( 0 ), jit, globalCoord, x, parameters );
+      }
+      else
+        return localNonAffine( globalCoord, x, parameters );
+    }
+
+    /** \brief evaluate the inverse mapping in a set of global points
+     *
+     *  \copydetails local( const GlobalPoints &, LocalCoordinate *, bool *, const LocalParameters & ) const
+     */
+    template< class GlobalPoints >
+    void local ( const GlobalPoints &globals, LocalCoordinate *locals, bool *inside = nullptr ) const
+    {
+      local( globals, locals, inside, LocalParameters() );
+    }
+
+    /** \brief evaluate the inverse mapping in a set of global points
+     *
+     *  This is the batched version of local( const GlobalCoordinate &,
+     *  LocalCoordinate &, const LocalParameters & ) const.  The setup shared by
+     *  all points is done only once: the affinity check and, for affine
+     *  mappings, the inverse Jacobian; for non-affine mappings, the first
+     *  Newton step from the center of the reference element.
+     *
+     *  \param[in]   globals     random access container of global coordinates
+     *  \param[out]  locals      array receiving the local coordinates
+     *  \param[out]  inside      array receiving for each point, whether the
+     *                           inverse mapping converged and the local
+     *                           coordinate lies inside the reference element
+     *                           (may be \c nullptr)
+     *  \param[in]   parameters  parameters controlling the iteration
+     *
+     *  \note Each output array must hold at least globals.size() entries.
+     */
+    template< class GlobalPoints >
+    void local ( const GlobalPoints &globals, LocalCoordinate *locals, bool *inside, const LocalParameters &parameters ) const
+    {
+      JacobianTransposed jt;
+      if( affine( jt ) )
+      {
+        JacobianInverseTransposed jit;
+        jit.setupChecked( jt );
+        localAffine( globals, corner( 0 ), jit, locals, inside, parameters );
+      }
+      else
+        localNonAffine( globals, locals, inside, parameters );
+    }
+
     /** \brief obtain the integration element
      *
      *  If the Jacobian of the mapping is denoted by $J(x)$, the integration
@@ -380,6 +505,44 @@ namespace Dune
      */
     JacobianInverseTransposed jacobianInverseTransposed ( const LocalCoordinate &local ) const;
 
+    /** \brief evaluate the mapping and its derivatives in a set of points
+     *
+     *  For each point x_i of the given set, this method computes
+     *  global( x_i ), jacobianTransposed( x_i ),
+     *  jacobianInverseTransposed( x_i ) and integrationElement( x_i ) in one
+     *  pass.  The corners are traversed only once per point and, for affine
+     *  mappings, the Jacobian and its inverse are only set up once for all
+     *  points.
+     *
+     *  \param[in]   points                     random access container of
+     *                                           local coordinates or of
+     *                                           quadrature points (e.g., a
+     *                                           QuadratureRule)
+     *  \param[out]  globals                    array receiving the global
+     *                                           coordinates
+     *  \param[out]  jacobianTransposeds        array receiving the transposed
+     *                                           Jacobians
+     *  \param[out]  jacobianInverseTransposeds array receiving the transposed
+     *                                           inverse Jacobians
+     *  \param[out]  integrationElements        array receiving the integration
+     *                                           elements
+     *
+     *  \note Each output array must hold at least points.size() entries. Pass
+     *        a \c nullptr to skip the corresponding quantity.
+     */
+    template< class Points >
+    void evaluate ( const Points &points, GlobalCoordinate *globals,
+                    JacobianTransposed *jacobianTransposeds = nullptr,
+                    JacobianInverseTransposed *jacobianInverseTransposeds = nullptr,
+                    ctype *integrationElements = nullptr ) const
+    {
+      JacobianTransposed jt;
+      if( affine( jt ) )
+        evaluateAffine( points, corner( 0 ), jt, globals, jacobianTransposeds, jacobianInverseTransposeds, integrationElements );
+      else
+        evaluateNonAffine( points, globals, jacobianTransposeds, jacobianInverseTransposeds, integrationElements );
+    }
+
     friend const ReferenceElement &referenceElement ( const MultiLinearGeometry &geometry ) { return geometry.refElement(); }
 
   protected:
@@ -408,6 +571,15 @@ namespace Dune
                                      CornerIterator &cit, const ctype &df, const LocalCoordinate &x,
                                      const ctype &rf, FieldMatrix< ctype, rows, cdim > &jt );
 
+    template< int dim, class CornerIterator >
+    static void globalAndJacobianTransposed ( TopologyId topologyId, std::integral_constant< int, dim >,
+                                              CornerIterator &cit, const ctype &df, const LocalCoordinate &x,
+                                              GlobalCoordinate &y, FieldMatrix< ctype, dim, cdim > &jt );
+    template< class CornerIterator >
+    static void globalAndJacobianTransposed ( TopologyId topologyId, std::integral_constant< int, 0 >,
+                                              CornerIterator &cit, const ctype &df, const LocalCoordinate &x,
+                                              GlobalCoordinate &y, FieldMatrix< ctype, 0, cdim > &jt );
+
     template< int dim, class CornerIterator >
     static bool affine ( TopologyId topologyId, std::integral_constant< int, dim >, CornerIterator &cit, JacobianTransposed &jt );
     template< class CornerIterator >
@@ -421,6 +593,233 @@ namespace Dune
       return affine( topologyId(), std::integral_constant< int, mydimension >(), cit, jacobianT );
     }
 
+    static const LocalCoordinate &localCoordinate ( const LocalCoordinate &x ) { return x; }
+
+    template< class QuadraturePoint >
+    static auto localCoordinate ( const QuadraturePoint &qp ) -> decltype( qp.position() ) { return qp.position(); }
+
+    template< class Points >
+    static void evaluateAffine ( const Points &points, const GlobalCoordinate &origin, const JacobianTransposed &jt,
+                                 GlobalCoordinate *globals, JacobianTransposed *jacobianTransposeds,
+                                 JacobianInverseTransposed *jacobianInverseTransposeds, ctype *integrationElements )
+    {
+      JacobianInverseTransposed jit;
+      if( jacobianInverseTransposeds )
+        jit.setup( jt );
+      else if( integrationElements )
+        jit.setupDeterminant( jt );
+      evaluateAffine( points, origin, jt, jit, globals, jacobianTransposeds, jacobianInverseTransposeds, integrationElements );
+    }
+
+    template< class Points >
+    static void evaluateAffine ( const Points &points, const GlobalCoordinate &origin,
+                                 const JacobianTransposed &jt, const JacobianInverseTransposed &jit,
+                                 GlobalCoordinate *globals, JacobianTransposed *jacobianTransposeds,
+                                 JacobianInverseTransposed *jacobianInverseTransposeds, ctype *integrationElements )
+    {
+      const std::size_t size = points.size();
+      for( std::size_t i = 0; i < size; ++i )
+      {
+        if( globals )
+        {
+          globals[ i ] = origin;
+          jt.umtv( localCoordinate( points[ i ] ), globals[ i ] );
+        }
+        if( jacobianTransposeds )
+          jacobianTransposeds[ i ] = jt;
+        if( jacobianInverseTransposeds )
+          jacobianInverseTransposeds[ i ] = jit;
+        if( integrationElements )
+          integrationElements[ i ] = jit.detInv();
+      }
+    }
+
+    template< class Points >
+    void evaluateNonAffine ( const Points &points, GlobalCoordinate *globals, JacobianTransposed *jacobianTransposeds,
+                             JacobianInverseTransposed *jacobianInverseTransposeds, ctype *integrationElements ) const
+    {
+      using std::begin;
+
+      GlobalCoordinate y;
+      JacobianTransposed jt;
+      const std::size_t size = points.size();
+      for( std::size_t i = 0; i < size; ++i )
+      {
+        auto cit = begin(std::cref(corners_).get());
+        globalAndJacobianTransposed( topologyId(), std::integral_constant< int, mydimension >(), cit, ctype( 1 ), localCoordinate( points[ i ] ), y, jt );
+        if( globals )
+          globals[ i ] = y;
+        if( jacobianTransposeds )
+          jacobianTransposeds[ i ] = jt;
+        if( jacobianInverseTransposeds )
+        {
+          jacobianInverseTransposeds[ i ].setup( jt );
+          if( integrationElements )
+            integrationElements[ i ] = jacobianInverseTransposeds[ i ].detInv();
+        }
+        else if( integrationElements )
+          integrationElements[ i ] = MatrixHelper::template sqrtDetAAT< mydimension, coorddimension >( jt );
+      }
+    }
+
+    LocalStatus localAffine ( const GlobalCoordinate &origin, const JacobianInverseTransposed &jit,
+                              const GlobalCoordinate &globalCoord, LocalCoordinate &x,
+                              const LocalParameters &parameters ) const
+    {
+      if( any_true( !(jit.detInv() > ctype( 0 )) ) )
+      {
+        // the inverse is unspecified, so fall back to the center as localNonAffine does
+        x = refElement().position( 0, 0 );
+        return LocalStatus::singular;
+      }
+      jit.mtv( globalCoord - origin, x );
+      if( parameters.earlyOut && outside( x, parameters.outsideTolerance ) )
+        return LocalStatus::outside;
+      return LocalStatus::converged;
+    }
+
+    template< class GlobalPoints >
+    void localAffine ( const GlobalPoints &globals, const GlobalCoordinate &origin, const JacobianInverseTransposed &jit,
+                       LocalCoordinate *locals, bool *inside, const LocalParameters &parameters ) const
+    {
+      const std::size_t size = globals.size();
+      for( std::size_t i = 0; i < size; ++i )
+      {
+        const LocalStatus status = localAffine( origin, jit, globals[ i ], locals[ i ], parameters );
+        if( inside )
+          inside[ i ] = isInside( status, locals[ i ] );
+      }
+    }
+
+    LocalStatus localNonAffine ( const GlobalCoordinate &globalCoord, LocalCoordinate &x,
+                                 const LocalParameters &parameters ) const
+    {
+      x = refElement().position( 0, 0 );
+      GlobalCoordinate residual;
+      JacobianTransposed jt;
+      globalAndJacobianTransposed( x, residual, jt );
+      residual -= globalCoord;
+
+      JacobianInverseTransposed jit;
+      jit.setupChecked( jt );
+      if( any_true( !(jit.detInv() > ctype( 0 )) ) )
+        return LocalStatus::singular;
+      return localNewton( globalCoord, x, residual, jt, jit, parameters );
+    }
+
+    template< class GlobalPoints >
+    void localNonAffine ( const GlobalPoints &globals, LocalCoordinate *locals, bool *inside,
+                          const LocalParameters &parameters ) const
+    {
+      // mapping and Jacobian in the center are shared by all points
+      const LocalCoordinate &center = refElement().position( 0, 0 );
+      GlobalCoordinate yCenter;
+      JacobianTransposed jtCenter;
+      globalAndJacobianTransposed( center, yCenter, jtCenter );
+      JacobianInverseTransposed jitCenter;
+      jitCenter.setupChecked( jtCenter );
+      const bool singular = any_true( !(jitCenter.detInv() > ctype( 0 )) );
+
+      const std::size_t size = globals.size();
+      for( std::size_t i = 0; i < size; ++i )
+      {
+        LocalStatus status = LocalStatus::singular;
+        locals[ i ] = center;
+        if( !singular )
+        {
+          GlobalCoordinate residual = yCenter - globals[ i ];
+          JacobianTransposed jt = jtCenter;
+          JacobianInverseTransposed jit = jitCenter;
+          status = localNewton( globals[ i ], locals[ i ], residual, jt, jit, parameters );
+        }
+        if( inside )
+          inside[ i ] = isInside( status, locals[ i ] );
+      }
+    }
+
+    // damped Newton iteration, started with x, its residual, Jacobian and inverse Jacobian
+    LocalStatus localNewton ( const GlobalCoordinate &globalCoord, LocalCoordinate &x, GlobalCoordinate &residual,
+                              JacobianTransposed &jt, JacobianInverseTransposed &jit,
+                              const LocalParameters &parameters ) const
+    {
+      LocalCoordinate dx, xNew;
+      GlobalCoordinate residualNew;
+      JacobianTransposed jtNew;
+      // for SIMD coordinate types, each lane stops updating once it has converged
+      decltype( parameters.tolerance > parameters.tolerance ) active( true );
+      for( int iteration = 0; iteration < parameters.maxIterations; ++iteration )
+      {
+        // Newton's method: DF^n dx^n = F^n, x^{n+1} = x^n - lambda^n dx^n
+        if( (iteration > 0) && !parameters.fixedJacobian )
+        {
+          jit.setupChecked( jt );
+          if( any_true( !(jit.detInv() > ctype( 0 )) ) )
+            return LocalStatus::singular;
+        }
+        jit.mtv( residual, dx );
+        const auto small = !(dx.two_norm2() > parameters.tolerance);
+
+        // halve the step while the residual does not decrease
+        ctype lambda( 1 );
+        for( int k = 0;; ++k )
+        {
+          for( int i = 0; i < mydimension; ++i )
+            xNew[ i ] = x[ i ] - lambda*dx[ i ];
+          globalAndJacobianTransposed( xNew, residualNew, jtNew );
+          residualNew -= globalCoord;
+          if( k >= parameters.maxDampingSteps )
+            break;
+          const auto accept = !active || small || !(residualNew.two_norm2() > residual.two_norm2());
+          if( all_true( accept ) )
+            break;
+          lambda = cond( accept, lambda, ctype( lambda / ctype( 2 ) ) );
+        }
+
+        for( int i = 0; i < mydimension; ++i )
+          x[ i ] = cond( active, xNew[ i ], x[ i ] );
+        residual = residualNew;
+        jt = jtNew;
+
+        active = active && !small;
+        if( !any_true( active ) )
+          break;
+        if( parameters.earlyOut && outside( x, parameters.outsideTolerance ) )
+          return LocalStatus::outside;
+      }
+
+      if( any_true( active ) )
+        return LocalStatus::notConverged;
+      if( parameters.earlyOut && outside( x, parameters.outsideTolerance ) )
+        return LocalStatus::outside;
+      return LocalStatus::converged;
+    }
+
+    bool isInside ( LocalStatus status, const LocalCoordinate &x ) const
+    {
+      const ctype tolerance = ctype( Impl::template insideTolerance< SimdScalar< ctype > >() );
+      return (status == LocalStatus::converged) && !outside( x, tolerance );
+    }
+
+    void globalAndJacobianTransposed ( const LocalCoordinate &x, GlobalCoordinate &y, JacobianTransposed &jt ) const
+    {
+      using std::begin;
+
+      auto cit = begin(std::cref(corners_).get());
+      globalAndJacobianTransposed( topologyId(), std::integral_constant< int, mydimension >(), cit, ctype( 1 ), x, y, jt );
+    }
+
+    bool outside ( const LocalCoordinate &x, const ctype &tolerance ) const
+    {
+      return outside( x, tolerance, std::is_same< SimdScalar< ctype >, ctype >() );
+    }
+
+    bool outside ( const LocalCoordinate &x, const ctype &tolerance, std::true_type ) const
+    {
+      return !Impl::template checkInside< ctype, mydimension >( toUnsignedInt( topologyId() ), mydimension, x, tolerance );
+    }
+
+    bool outside ( const LocalCoordinate &x, const ctype &tolerance, std::false_type ) const { return false; }
+
   private:
     // The following methods are needed to convert the return type of topologyId to
     // unsigned int with g++-4.4. It has problems casting integral_constant to the
@@ -452,6 +851,17 @@ namespace Dune
       detInv_ = MatrixHelper::template rightInvA< mydimension, coorddimension >( jt, static_cast< Base & >( *this ) );
     }
 
+    /** \brief set up the inverse, detecting rank deficiency
+     *
+     *  Unlike setup(), this does not assert that jt has full rank.  If it
+     *  does not (up to Traits::tolerance()), detInv() is zero and the
+     *  matrix is unspecified.
+     */
+    void setupChecked ( const JacobianTransposed &jt )
+    {
+      detInv_ = MatrixHelper::template rightInvA< mydimension, coorddimension >( jt, static_cast< Base & >( *this ), Traits::tolerance() );
+    }
+
     void setupDeterminant ( const JacobianTransposed &jt )
     {
       detInv_ = MatrixHelper::template sqrtDetAAT< mydimension, coorddimension >( jt );
@@ -502,6 +912,9 @@ namespace Dune
     typedef typename Base::JacobianTransposed JacobianTransposed;
     typedef typename Base::JacobianInverseTransposed JacobianInverseTransposed;
 
+    typedef typename Base::LocalStatus LocalStatus;
+    typedef typename Base::LocalParameters LocalParameters;
+
     template< class CornerStorage >
     CachedMultiLinearGeometry ( const ReferenceElement &referenceElement, const CornerStorage &cornerStorage )
       : Base( referenceElement, cornerStorage ),
@@ -555,20 +968,68 @@ namespace Dune
      *  \code
      *  (global( x ) - y).two_norm()
      *  \endcode
+     *
+     *  \note As for MultiLinearGeometry, the center of the reference element
+     *        is returned if the Jacobian of an affine mapping is singular.
      */
     LocalCoordinate local ( const GlobalCoordinate &global ) const
+    {
+      LocalCoordinate x;
+      if( affine() && jacobianInverseTransposedComputed_ )
+        jacobianInverseTransposed_.mtv( global - corner( 0 ), x );
+      else
+        local( global, x );
+      return x;
+    }
+
+    /** \brief evaluate the inverse mapping, reporting the outcome
+     *
+     *  \copydetails MultiLinearGeometry::local( const GlobalCoordinate &, LocalCoordinate &, const LocalParameters & ) const
+     */
+    LocalStatus local ( const GlobalCoordinate &global, LocalCoordinate &x ) const
+    {
+      return local( global, x, LocalParameters() );
+    }
+
+    /** \brief evaluate the inverse mapping, reporting the outcome
+     *
+     *  \copydetails MultiLinearGeometry::local( const GlobalCoordinate &, LocalCoordinate &, const LocalParameters & ) const
+     */
+    LocalStatus local ( const GlobalCoordinate &global, LocalCoordinate &x, const LocalParameters &parameters ) const
     {
       if( affine() )
       {
-        LocalCoordinate local;
-        if( jacobianInverseTransposedComputed_ )
-          jacobianInverseTransposed_.mtv( global - corner( 0 ), local );
-        else
-          MatrixHelper::template xTRightInvA< mydimension, coorddimension >( jacobianTransposed_, global - corner( 0 ), local );
-        return local;
+        JacobianInverseTransposed jit;
+        return Base::localAffine( corner( 0 ), checkedJacobianInverseTransposed( jit ), global, x, parameters );
       }
       else
-        return Base::local( global );
+        return Base::localNonAffine( global, x, parameters );
+    }
+
+    /** \brief evaluate the inverse mapping in a set of global points
+     *
+     *  \copydetails MultiLinearGeometry::local( const GlobalPoints &, LocalCoordinate *, bool *, const LocalParameters & ) const
+     */
+    template< class GlobalPoints >
+    void local ( const GlobalPoints &globals, LocalCoordinate *locals, bool *inside = nullptr ) const
+    {
+      local( globals, locals, inside, LocalParameters() );
+    }
+
+    /** \brief evaluate the inverse mapping in a set of global points
+     *
+     *  \copydetails MultiLinearGeometry::local( const GlobalPoints &, LocalCoordinate *, bool *, const LocalParameters & ) const
+     */
+    template< class GlobalPoints >
+    void local ( const GlobalPoints &globals, LocalCoordinate *locals, bool *inside, const LocalParameters &parameters ) const
+    {
+      if( affine() )
+      {
+        JacobianInverseTransposed jit;
+        Base::localAffine( globals, corner( 0 ), checkedJacobianInverseTransposed( jit ), locals, inside, parameters );
+      }
+      else
+        Base::localNonAffine( globals, locals, inside, parameters );
     }
 
     /** \brief obtain the integration element
@@ -648,10 +1109,49 @@ namespace Dune
         return Base::jacobianInverseTransposed( local );
     }
 
+    /** \brief evaluate the mapping and its derivatives in a set of points
+     *
+     *  \copydetails MultiLinearGeometry::evaluate
+     */
+    template< class Points >
+    void evaluate ( const Points &points, GlobalCoordinate *globals,
+                    JacobianTransposed *jacobianTransposeds = nullptr,
+                    JacobianInverseTransposed *jacobianInverseTransposeds = nullptr,
+                    ctype *integrationElements = nullptr ) const
+    {
+      if( affine() )
+      {
+        if( jacobianInverseTransposeds )
+          jacobianInverseTransposed( refElement().position( 0, 0 ) );
+        else if( integrationElements )
+          integrationElement( refElement().position( 0, 0 ) );
+        Base::evaluateAffine( points, corner( 0 ), jacobianTransposed_, jacobianInverseTransposed_,
+                              globals, jacobianTransposeds, jacobianInverseTransposeds, integrationElements );
+      }
+      else
+        Base::evaluateNonAffine( points, globals, jacobianTransposeds, jacobianInverseTransposeds, integrationElements );
+    }
+
   protected:
     using Base::refElement;
 
   private:
+    // the inverse Jacobian of an affine mapping for the inverse mapping,
+    // which tolerates a singular Jacobian; only a regular one is cached
+    const JacobianInverseTransposed &checkedJacobianInverseTransposed ( JacobianInverseTransposed &jit ) const
+    {
+      if( jacobianInverseTransposedComputed_ )
+        return jacobianInverseTransposed_;
+      jit.setupChecked( jacobianTransposed_ );
+      if( all_true( jit.detInv() > ctype( 0 ) ) )
+      {
+        jacobianInverseTransposed_ = jit;
+        jacobianInverseTransposedComputed_ = true;
+        integrationElementComputed_ = true;
+      }
+      return jit;
+    }
+
     mutable JacobianTransposed jacobianTransposed_;
     mutable JacobianInverseTransposed jacobianInverseTransposed_;
 
@@ -697,10 +1197,10 @@ namespace Dune
     {
       assert( Impl::isPyramid( toUnsignedInt(topologyId), mydimension, mydimension-dim ) );
       // apply (1-xn) times mapping for bottom (with argument x/(1-xn))
-      if( cxn > Traits::tolerance() || cxn < -Traits::tolerance() )
-        global< add >( topologyId, std::integral_constant< int, dim-1 >(), cit, df/cxn, x, rf*cxn, y );
-      else
-        global< add >( topologyId, std::integral_constant< int, dim-1 >(), cit, df, x, ctype( 0 ), y );
+      const auto regular = (cxn > Traits::tolerance() || cxn < -Traits::tolerance());
+      const ctype dfcxn = cond( regular, ctype( df / cond( regular, cxn, ctype( 1 ) ) ), df );
+      const ctype rfcxn = cond( regular, ctype( rf*cxn ), ctype( 0 ) );
+      global< add >( topologyId, std::integral_constant< int, dim-1 >(), cit, dfcxn, x, rfcxn, y );
       // apply xn times the tip
       y.axpy( rf*xn, *cit );
       ++cit;
@@ -788,7 +1288,8 @@ namespace Dune
        */
 
       /* The second case effectively results in x* = 0 */
-      ctype dfcxn = (cxn > Traits::tolerance() || cxn < -Traits::tolerance()) ? ctype(df / cxn) : ctype(0);
+      const auto regular = (cxn > Traits::tolerance() || cxn < -Traits::tolerance());
+      const ctype dfcxn = cond( regular, ctype( df / cond( regular, cxn, ctype( 1 ) ) ), ctype( 0 ) );
 
       // initialize last row
       // b =  -Tb(x*)
@@ -835,6 +1336,73 @@ namespace Dune
 
 
 
+  template< class ct, int mydim, int cdim, class Traits >
+  template< int dim, class CornerIterator >
+  inline void MultiLinearGeometry< ct, mydim, cdim, Traits >
+  ::globalAndJacobianTransposed ( TopologyId topologyId, std::integral_constant< int, dim >,
+                                  CornerIterator &cit, const ctype &df, const LocalCoordinate &x,
+                                  GlobalCoordinate &y, FieldMatrix< ctype, dim, cdim > &jt )
+  {
+    const ctype xn = df*x[ dim-1 ];
+    const ctype cxn = ctype( 1 ) - xn;
+
+    if( Impl::isPrism( toUnsignedInt(topologyId), mydimension, mydimension-dim ) )
+    {
+      // evaluate mapping and Jacobian for bottom and top
+      GlobalCoordinate yBottom, yTop;
+      FieldMatrix< ctype, dim-1, cdim > jtBottom, jtTop;
+      globalAndJacobianTransposed( topologyId, std::integral_constant< int, dim-1 >(), cit, df, x, yBottom, jtBottom );
+      globalAndJacobianTransposed( topologyId, std::integral_constant< int, dim-1 >(), cit, df, x, yTop, jtTop );
+
+      // interpolate linearly, the last row is the difference between top and bottom
+      for( int i = 0; i < coorddimension; ++i )
+      {
+        y[ i ] = cxn*yBottom[ i ] + xn*yTop[ i ];
+        jt[ dim-1 ][ i ] = yTop[ i ] - yBottom[ i ];
+        for( int j = 0; j < dim-1; ++j )
+          jt[ j ][ i ] = cxn*jtBottom[ j ][ i ] + xn*jtTop[ j ][ i ];
+      }
+    }
+    else
+    {
+      assert( Impl::isPyramid( toUnsignedInt(topologyId), mydimension, mydimension-dim ) );
+      // see jacobianTransposed for a derivation of the pyramid case
+      const auto regular = (cxn > Traits::tolerance() || cxn < -Traits::tolerance());
+      const ctype dfcxn = cond( regular, ctype( df / cond( regular, cxn, ctype( 1 ) ) ), ctype( 0 ) );
+
+      // evaluate mapping and Jacobian for the bottom in x* = x/(1-xn)
+      GlobalCoordinate yBottom;
+      FieldMatrix< ctype, dim-1, cdim > jtBottom;
+      globalAndJacobianTransposed( topologyId, std::integral_constant< int, dim-1 >(), cit, dfcxn, x, yBottom, jtBottom );
+      const GlobalCoordinate &tip = *cit;
+      ++cit;
+
+      for( int i = 0; i < coorddimension; ++i )
+      {
+        y[ i ] = cond( regular, ctype( cxn*yBottom[ i ] ), ctype( 0 ) ) + xn*tip[ i ];
+        jt[ dim-1 ][ i ] = tip[ i ] - yBottom[ i ];
+      }
+      for( int j = 0; j < dim-1; ++j )
+      {
+        jt[ j ] = jtBottom[ j ];
+        jt[ dim-1 ].axpy( dfcxn*x[ j ], jtBottom[ j ] );
+      }
+    }
+  }
+
+  template< class ct, int mydim, int cdim, class Traits >
+  template< class CornerIterator >
+  inline void MultiLinearGeometry< ct, mydim, cdim, Traits >
+  ::globalAndJacobianTransposed ( TopologyId topologyId, std::integral_constant< int, 0 >,
+                                  CornerIterator &cit, const ctype &df, const LocalCoordinate &x,
+                                  GlobalCoordinate &y, FieldMatrix< ctype, 0, cdim > &jt )
+  {
+    y = *cit;
+    ++cit;
+  }
+
+
+
   template< class ct, int mydim, int cdim, class Traits >
   template< int dim, class CornerIterator >
   inline bool MultiLinearGeometry< ct, mydim, cdim, Traits >
@@ -851,11 +1419,11 @@ namespace Dune
       if( !affine( topologyId, std::integral_constant< int, dim-1 >(), cit, jtTop ) )
         return false;
 
-      // check whether both jacobians are identical
+      // check whether both jacobians are identical (in all SIMD lanes)
       ctype norm( 0 );
       for( int i = 0; i < dim-1; ++i )
         norm += (jtTop[ i ] - jt[ i ]).two_norm2();
-      if( norm >= Traits::tolerance() )
+      if( any_true( norm >= Traits::tolerance() ) )
         return false;
     }
     else
@@ -0,0 +1,322 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_MULTILINEARGEOMETRYSTORE_HH
+#define DUNE_GEOMETRY_MULTILINEARGEOMETRYSTORE_HH
+
+/** \file
+ *  \brief contiguous storage of the corners of many elements of the same
+ *         geometry type
+ */
+
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <dune/common/fvector.hh>
+
+#include <dune/geometry/multilineargeometry.hh>
+#include <dune/geometry/referenceelements.hh>
+#include <dune/geometry/type.hh>
+#include <dune/geometry/utility/executor.hh>
+
+namespace Dune
+{
+
+  namespace Impl
+  {
+
+    // CornerRange
+    // -----------
+
+    /** \brief non-owning view of a contiguous range of corners
+     *
+     *  This class satisfies the requirements on the corner storage of
+     *  MultiLinearGeometry.  It is cheap to copy and refers to corners owned
+     *  by someone else, e.g., a MultiLinearGeometryStore.
+     */
+    template< class Corner >
+    class CornerRange
+    {
+    public:
+      typedef const Corner *const_iterator;
+
+      CornerRange () : begin_( nullptr ), end_( nullptr ) {}
+
+      CornerRange ( const Corner *begin, const Corner *end )
+        : begin_( begin ), end_( end )
+      {}
+
+      const_iterator begin () const { return begin_; }
+      const_iterator end () const { return end_; }
+
+      std::size_t size () const { return end_ - begin_; }
+
+      const Corner &operator[] ( std::size_t i ) const
+      {
+        assert( i < size() );
+        return begin_[ i ];
+      }
+
+    private:
+      const Corner *begin_;
+      const Corner *end_;
+    };
+
+  } // namespace Impl
+
+
+
+  // MultiLinearGeometryStore
+  // ------------------------
+
+  /** \brief storage for the corners of many elements of one geometry type
+   *
+   *  All corners are kept in a single contiguous buffer, the corners of each
+   *  element being stored consecutively in Dune ordering.  Instead of one
+   *  geometry object per element, the store hands out lightweight
+   *  MultiLinearGeometry views referring to this buffer, and it runs batched
+   *  evaluations over ranges of elements.
+   *
+   *  The batched kernels take an optional executor (see
+   *  dune/geometry/utility/executor.hh) distributing the element range, e.g.,
+   *  across threads.  By default, they run serially.
+   *
+   *  \tparam  ct      coordinate type
+   *  \tparam  mydim   geometry dimension
+   *  \tparam  cdim    coordinate dimension
+   *  \tparam  Traits  traits for the geometries (optional), see
+   *                   MultiLinearGeometryTraits; the corner storage is
+   *                   replaced by a view into the store.
+   *
+   *  \note Inserting elements may reallocate the buffer, invalidating all
+   *        geometries handed out before.
+   */
+  template< class ct, int mydim, int cdim, class Traits = MultiLinearGeometryTraits< ct > >
+  class MultiLinearGeometryStore
+  {
+    typedef MultiLinearGeometryStore< ct, mydim, cdim, Traits > This;
+
+  public:
+    //! coordinate type
+    typedef ct ctype;
+
+    //! geometry dimension
+    static const int mydimension = mydim;
+    //! coordinate dimension
+    static const int coorddimension = cdim;
+
+    //! type of local coordinates
+    typedef FieldVector< ctype, mydimension > LocalCoordinate;
+    //! type of global coordinates
+    typedef FieldVector< ctype, coorddimension > GlobalCoordinate;
+
+    //! type of the corner view used by the geometries
+    typedef Impl::CornerRange< GlobalCoordinate > CornerRange;
+
+    //! traits of the geometries handed out by the store
+    struct GeometryTraits
+      : public Traits
+    {
+      template< int, int >
+      struct CornerStorage
+      {
+        typedef CornerRange Type;
+      };
+    };
+
+    //! type of the geometries handed out by the store
+    typedef MultiLinearGeometry< ctype, mydimension, coorddimension, GeometryTraits > Geometry;
+
+    //! type of jacobian transposed
+    typedef typename Geometry::JacobianTransposed JacobianTransposed;
+    //! type of jacobian inverse transposed
+    typedef typename Geometry::JacobianInverseTransposed JacobianInverseTransposed;
+
+    //! type of reference element
+    typedef typename Geometry::ReferenceElement ReferenceElement;
+
+    /** \brief constructor
+     *
+     *  \param[in]  refElement  reference element shared by all elements
+     */
+    explicit MultiLinearGeometryStore ( const ReferenceElement &refElement )
+      : refElement_( &refElement ),
+        corners_( refElement.size( mydimension ) )
+    {}
+
+    /** \brief constructor
+     *
+     *  \param[in]  gt  geometry type shared by all elements
+     */
+    explicit MultiLinearGeometryStore ( Dune::GeometryType gt )
+      : This( ReferenceElements< ctype, mydimension >::general( gt ) )
+    {}
+
+    /** \brief obtain the geometry type of the stored elements */
+    Dune::GeometryType type () const { return refElement().type(); }
+
+    /** \brief obtain the reference element of the stored elements */
+    const ReferenceElement &refElement () const { return *refElement_; }
+
+    /** \brief obtain number of corners per element */
+    int corners () const { return corners_; }
+
+    /** \brief obtain number of stored elements */
+    std::size_t size () const { return coordinates_.size() / corners_; }
+
+    /** \brief reserve storage for n elements */
+    void reserve ( std::size_t n ) { coordinates_.reserve( n*corners_ ); }
+
+    /** \brief remove all elements */
+    void clear () { coordinates_.clear(); }
+
+    /** \brief append an element
+     *
+     *  \param[in]  corners  corners of the element (in Dune ordering)
+     *
+     *  \returns index of the new element
+     */
+    template< class Corners >
+    std::size_t push_back ( const Corners &corners )
+    {
+      const std::size_t index = size();
+      for( int i = 0; i < corners_; ++i )
+        coordinates_.push_back( corners[ i ] );
+      return index;
+    }
+
+    /** \brief access the i-th corner of element e */
+    GlobalCoordinate &corner ( std::size_t e, int i )
+    {
+      assert( (e < size()) && (i >= 0) && (i < corners_) );
+      return coordinates_[ e*corners_ + i ];
+    }
+
+    /** \brief access the i-th corner of element e */
+    const GlobalCoordinate &corner ( std::size_t e, int i ) const
+    {
+      assert( (e < size()) && (i >= 0) && (i < corners_) );
+      return coordinates_[ e*corners_ + i ];
+    }
+
+    /** \brief obtain the contiguous corner buffer of size size()*corners() */
+    const GlobalCoordinate *data () const { return coordinates_.data(); }
+
+    /** \brief obtain a view of the corners of element e */
+    CornerRange cornerRange ( std::size_t e ) const
+    {
+      assert( e < size() );
+      const GlobalCoordinate *begin = coordinates_.data() + e*corners_;
+      return CornerRange( begin, begin + corners_ );
+    }
+
+    /** \brief obtain a geometry for element e
+     *
+     *  The geometry refers to the corners inside the store and remains valid
+     *  as long as no elements are inserted.
+     */
+    Geometry geometry ( std::size_t e ) const { return Geometry( refElement(), cornerRange( e ) ); }
+
+    /** \brief apply a functor to the geometries of the elements [first, last)
+     *
+     *  The functor is called as <tt>f( e, geometry( e ) )</tt>.  For parallel
+     *  executors, it must be safe to call f concurrently for different
+     *  elements.
+     */
+    template< class F, class Executor = SerialExecutor >
+    void forEach ( std::size_t first, std::size_t last, F &&f, const Executor &executor = Executor() ) const
+    {
+      assert( (first <= last) && (last <= size()) );
+      executor( first, last, [ this, &f ] ( std::size_t begin, std::size_t end ) {
+          for( std::size_t e = begin; e < end; ++e )
+            f( e, geometry( e ) );
+        } );
+    }
+
+    /** \brief compute the volumes of the elements [first, last)
+     *
+     *  \param[out]  volumes  array receiving the volume of element e at
+     *                        index <tt>e-first</tt>
+     */
+    template< class Executor = SerialExecutor >
+    void volumes ( std::size_t first, std::size_t last, ctype *volumes, const Executor &executor = Executor() ) const
+    {
+      forEach( first, last, [ first, volumes ] ( std::size_t e, const Geometry &geometry ) {
+          volumes[ e - first ] = geometry.volume();
+        }, executor );
+    }
+
+    /** \brief compute the centers of the elements [first, last)
+     *
+     *  \param[out]  centers  array receiving the center of element e at
+     *                        index <tt>e-first</tt>
+     */
+    template< class Executor = SerialExecutor >
+    void centers ( std::size_t first, std::size_t last, GlobalCoordinate *centers, const Executor &executor = Executor() ) const
+    {
+      forEach( first, last, [ first, centers ] ( std::size_t e, const Geometry &geometry ) {
+          centers[ e - first ] = geometry.center();
+        }, executor );
+    }
+
+    /** \brief evaluate the geometries of the elements [first, last) in a set of points
+     *
+     *  This is the batched version of MultiLinearGeometry::evaluate for a
+     *  range of elements.  The results are stored element by element, i.e.,
+     *  the value for element e and point q is found at index
+     *  <tt>(e-first)*points.size() + q</tt> of each output array.
+     *
+     *  \note A \c nullptr may be passed for any quantity not needed.
+     */
+    template< class Points, class Executor = SerialExecutor >
+    void evaluate ( std::size_t first, std::size_t last, const Points &points,
+                    GlobalCoordinate *globals,
+                    JacobianTransposed *jacobianTransposeds = nullptr,
+                    JacobianInverseTransposed *jacobianInverseTransposeds = nullptr,
+                    ctype *integrationElements = nullptr,
+                    const Executor &executor = Executor() ) const
+    {
+      const std::size_t n = points.size();
+      forEach( first, last, [ & ] ( std::size_t e, const Geometry &geometry ) {
+          const std::size_t offset = (e - first)*n;
+          geometry.evaluate( points,
+                             (globals ? globals + offset : nullptr),
+                             (jacobianTransposeds ? jacobianTransposeds + offset : nullptr),
+                             (jacobianInverseTransposeds ? jacobianInverseTransposeds + offset : nullptr),
+                             (integrationElements ? integrationElements + offset : nullptr) );
+        }, executor );
+    }
+
+    /** \brief evaluate the inverse mappings of the elements [first, last) in
+     *         sets of global points
+     *
+     *  \param[in]   first     index of the first element
+     *  \param[in]   last      index after the last element
+     *  \param[in]   globals   n global points per element, stored element by
+     *                         element
+     *  \param[in]   n         number of points per element
+     *  \param[out]  locals    array receiving the local coordinates in the
+     *                         same layout as globals
+     *  \param[in]   executor  executor distributing the elements
+     */
+    template< class Executor = SerialExecutor >
+    void local ( std::size_t first, std::size_t last, const GlobalCoordinate *globals, std::size_t n,
+                 LocalCoordinate *locals, const Executor &executor = Executor() ) const
+    {
+      forEach( first, last, [ first, globals, n, locals ] ( std::size_t e, const Geometry &geometry ) {
+          const std::size_t offset = (e - first)*n;
+          for( std::size_t q = 0; q < n; ++q )
+            locals[ offset + q ] = geometry.local( globals[ offset + q ] );
+        }, executor );
+    }
+
+  private:
+    const ReferenceElement *refElement_;
+    int corners_;
+    std::vector< GlobalCoordinate > coordinates_;
+  };
+
+} // namespace Dune
+
+#endif // #ifndef DUNE_GEOMETRY_MULTILINEARGEOMETRYSTORE_HH
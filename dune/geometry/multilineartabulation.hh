@@ -0,0 +1,318 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_MULTILINEARTABULATION_HH
+#define DUNE_GEOMETRY_MULTILINEARTABULATION_HH
+
+/** \file
+ *  \brief Tabulation of the corner shape functions of MultiLinearGeometry in
+ *         quadrature points
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+#include <dune/common/stdthread.hh>
+#include <dune/common/visibility.hh>
+
+#include <dune/geometry/multilineargeometry.hh>
+#include <dune/geometry/quadraturerules.hh>
+#include <dune/geometry/quadraturerules/nocopyvector.hh>
+#include <dune/geometry/referenceelements.hh>
+#include <dune/geometry/type.hh>
+#include <dune/geometry/typeindex.hh>
+
+namespace Dune
+{
+
+  // MultiLinearTabulation
+  // ---------------------
+
+  /** \brief corner shape functions of a MultiLinearGeometry tabulated in the
+   *         points of a quadrature rule
+   *
+   *  For fixed local coordinate x, the mapping of a MultiLinearGeometry is
+   *  linear in the corners y_c, i.e.,
+   *  \f[ y(x) = \sum_c \phi_c(x)\,y_c. \f]
+   *  This class stores \f$\phi_c\f$ and \f$\nabla\phi_c\f$ in all points of a
+   *  quadrature rule.  Evaluating the mapping and its Jacobian for an element
+   *  in these points then reduces to small dense matrix products with the
+   *  corner matrix of the element.
+   *
+   *  Tabulations for all quadrature rules are provided by
+   *  MultiLinearTabulations.
+   *
+   *  \tparam  ctype  coordinate type
+   *  \tparam  dim    dimension of the reference element
+   */
+  template< class ctype, int dim >
+  class MultiLinearTabulation
+  {
+    // geometry whose corners are the unit vectors evaluates the shape functions
+    static const int maxCorners = (1 << dim);
+    typedef MultiLinearGeometry< ctype, dim, maxCorners > ShapeFunctions;
+
+    template< class Corners >
+    using Corner = typename std::decay< decltype( std::declval< const Corners & >()[ 0 ] ) >::type;
+
+  public:
+    //! dimension of the reference element
+    static const int dimension = dim;
+
+    //! type of the tabulated quadrature rule
+    typedef Dune::QuadratureRule< ctype, dim > QuadratureRule;
+
+    //! create an empty tabulation
+    MultiLinearTabulation () : quadrature_( nullptr ), corners_( 0 ) {}
+
+    /** \brief tabulate the shape functions of a geometry type
+     *
+     *  \param[in]  type        geometry type of the reference element
+     *  \param[in]  quadrature  quadrature rule to tabulate in
+     *
+     *  \note The quadrature rule must outlive the tabulation.
+     */
+    MultiLinearTabulation ( const GeometryType &type, const QuadratureRule &quadrature )
+      : quadrature_( &quadrature ),
+        corners_( ReferenceElements< ctype, dim >::general( type ).size( dim ) )
+    {
+      std::vector< FieldVector< ctype, maxCorners > > unitCorners( corners_, FieldVector< ctype, maxCorners >( ctype( 0 ) ) );
+      for( int c = 0; c < corners_; ++c )
+        unitCorners[ c ][ c ] = ctype( 1 );
+      const ShapeFunctions shapeFunctions( type, unitCorners );
+
+      std::vector< typename ShapeFunctions::GlobalCoordinate > phi( size() );
+      std::vector< typename ShapeFunctions::JacobianTransposed > dphi( size() );
+      shapeFunctions.evaluate( quadrature, phi.data(), dphi.data() );
+
+      values_.resize( size()*corners_ );
+      gradients_.resize( size()*dim*corners_ );
+      for( std::size_t qp = 0; qp < size(); ++qp )
+      {
+        for( int c = 0; c < corners_; ++c )
+        {
+          values_[ qp*corners_ + c ] = phi[ qp ][ c ];
+          for( int j = 0; j < dim; ++j )
+            gradients_[ (qp*dim + j)*corners_ + c ] = dphi[ qp ][ j ][ c ];
+        }
+      }
+    }
+
+    //! return the tabulated quadrature rule
+    const QuadratureRule &quadrature () const
+    {
+      assert( quadrature_ );
+      return *quadrature_;
+    }
+
+    //! return the number of quadrature points
+    std::size_t size () const { return (quadrature_ ? quadrature_->size() : 0); }
+
+    //! return the number of corners (i.e., of shape functions)
+    int corners () const { return corners_; }
+
+    //! return the values of all shape functions in quadrature point qp
+    const ctype *values ( std::size_t qp ) const
+    {
+      assert( qp < size() );
+      return values_.data() + qp*corners_;
+    }
+
+    /** \brief return the gradients of all shape functions in quadrature point qp
+     *
+     *  The gradients are stored as a dim x corners() matrix in row-major
+     *  order, i.e., the derivative of shape function c with respect to
+     *  direction j is found at index j*corners() + c.
+     */
+    const ctype *gradients ( std::size_t qp ) const
+    {
+      assert( qp < size() );
+      return gradients_.data() + qp*dim*corners_;
+    }
+
+    /** \brief evaluate the mapping of an element in quadrature point qp
+     *
+     *  \param[in]   qp       index of the quadrature point
+     *  \param[in]   corners  corners of the element (in Dune ordering)
+     *  \param[out]  y        global coordinate of the quadrature point
+     */
+    template< class Corners, int cdim >
+    void global ( std::size_t qp, const Corners &corners, FieldVector< ctype, cdim > &y ) const
+    {
+      const ctype *phi = values( qp );
+      y = ctype( 0 );
+      for( int c = 0; c < corners_; ++c )
+        y.axpy( phi[ c ], corners[ c ] );
+    }
+
+    /** \brief evaluate the transposed Jacobian of an element in quadrature point qp
+     *
+     *  \param[in]   qp       index of the quadrature point
+     *  \param[in]   corners  corners of the element (in Dune ordering)
+     *  \param[out]  jt       transposed Jacobian in the quadrature point
+     */
+    template< class Corners, int cdim >
+    void jacobianTransposed ( std::size_t qp, const Corners &corners, FieldMatrix< ctype, dim, cdim > &jt ) const
+    {
+      const ctype *dphi = gradients( qp );
+      jt = ctype( 0 );
+      for( int c = 0; c < corners_; ++c )
+      {
+        const FieldVector< ctype, cdim > &corner = corners[ c ];
+        for( int j = 0; j < dim; ++j )
+          jt[ j ].axpy( dphi[ j*corners_ + c ], corner );
+      }
+    }
+
+    /** \brief evaluate mapping and transposed Jacobian of an element in all
+     *         quadrature points
+     *
+     *  \param[in]   corners              corners of the element (in Dune
+     *                                    ordering)
+     *  \param[out]  globals              array receiving the global
+     *                                    coordinates
+     *  \param[out]  jacobianTransposeds  array receiving the transposed
+     *                                    Jacobians
+     *
+     *  \note Each output array must hold at least size() entries. Pass a
+     *        \c nullptr to skip the corresponding quantity.
+     */
+    template< class Corners >
+    void evaluate ( const Corners &corners, Corner< Corners > *globals,
+                    FieldMatrix< ctype, dim, Corner< Corners >::dimension > *jacobianTransposeds = nullptr ) const
+    {
+      const std::size_t n = size();
+      for( std::size_t qp = 0; qp < n; ++qp )
+      {
+        if( globals )
+          global( qp, corners, globals[ qp ] );
+        if( jacobianTransposeds )
+          jacobianTransposed( qp, corners, jacobianTransposeds[ qp ] );
+      }
+    }
+
+  private:
+    const QuadratureRule *quadrature_;
+    int corners_;
+    std::vector< ctype > values_;
+    std::vector< ctype > gradients_;
+  };
+
+
+
+  // MultiLinearTabulations
+  // ----------------------
+
+  /** \brief A container for the tabulations of all quadrature rules of
+   *         dimension <tt>dim</tt>
+   *
+   *  The tabulations are created lazily and thread-safe on first access,
+   *  using the quadrature rules provided by QuadratureRules.
+   */
+  template< class ctype, int dim >
+  class MultiLinearTabulations
+  {
+    typedef Dune::MultiLinearTabulation< ctype, dim > MultiLinearTabulation;
+
+    static void initTabulation ( MultiLinearTabulation *tabulation, QuadratureType::Enum qt,
+                                 const GeometryType &t, int p )
+    {
+      *tabulation = MultiLinearTabulation( t, QuadratureRules< ctype, dim >::rule( t, p, qt ) );
+    }
+
+    typedef NoCopyVector< std::pair< std::once_flag, MultiLinearTabulation > >
+      QuadratureOrderVector; // indexed by quadrature order
+    static void initQuadratureOrderVector ( QuadratureOrderVector *qov, QuadratureType::Enum qt,
+                                            const GeometryType &t )
+    {
+      if( dim == 0 )
+        // we only need one tabulation for points
+        qov->resize( 1 );
+      else
+        qov->resize( std::min( std::size_t( QuadratureRules< ctype, dim >::maxOrder( t, qt ) )+1,
+                               std::size_t( QuadratureRules< ctype, dim >::numCachedOrders ) ) );
+    }
+
+    typedef NoCopyVector< std::pair< std::once_flag, QuadratureOrderVector > >
+      GeometryTypeVector; // indexed by geometry type
+    static void initGeometryTypeVector ( GeometryTypeVector *gtv )
+    {
+      gtv->resize( LocalGeometryTypeIndex::size( dim ) );
+    }
+
+    DUNE_EXPORT const MultiLinearTabulation &_tabulation ( const GeometryType &t, int p, QuadratureType::Enum qt )
+    {
+      assert( t.dim() == dim );
+
+      DUNE_ASSERT_CALL_ONCE();
+
+      static NoCopyVector< std::pair< // indexed by quadrature type
+        std::once_flag,
+        GeometryTypeVector
+        > > tabulationCache( QuadratureType::size );
+
+      auto &quadratureTypeLevel = tabulationCache[ qt ];
+      std::call_once( quadratureTypeLevel.first, initGeometryTypeVector,
+                      &quadratureTypeLevel.second );
+
+      auto &geometryTypeLevel =
+        quadratureTypeLevel.second[ LocalGeometryTypeIndex::index( t ) ];
+      std::call_once( geometryTypeLevel.first, initQuadratureOrderVector,
+                      &geometryTypeLevel.second, qt, t );
+
+      const std::size_t order = (dim == 0 ? 0 : p);
+      if( order >= geometryTypeLevel.second.size() )
+        return _highOrderTabulation( t, p, qt );
+
+      auto &quadratureOrderLevel = geometryTypeLevel.second[ order ];
+      std::call_once( quadratureOrderLevel.first, initTabulation,
+                      &quadratureOrderLevel.second, qt, t, p );
+
+      return quadratureOrderLevel.second;
+    }
+
+    //! tabulation for a quadrature order beyond the preallocated ones
+    DUNE_EXPORT const MultiLinearTabulation &_highOrderTabulation ( const GeometryType &t, int p, QuadratureType::Enum qt )
+    {
+      typedef std::tuple< int, std::size_t, int > Key;
+      static std::mutex mutex;
+      static std::map< Key, std::unique_ptr< MultiLinearTabulation > > cache;
+
+      std::lock_guard< std::mutex > guard( mutex );
+      std::unique_ptr< MultiLinearTabulation > &tabulation = cache[ Key( qt, LocalGeometryTypeIndex::index( t ), p ) ];
+      if( !tabulation )
+        tabulation.reset( new MultiLinearTabulation( t, QuadratureRules< ctype, dim >::rule( t, p, qt ) ) );
+      return *tabulation;
+    }
+
+    //! singleton provider
+    DUNE_EXPORT static MultiLinearTabulations &instance ()
+    {
+      static MultiLinearTabulations instance;
+      return instance;
+    }
+
+    //! private constructor
+    MultiLinearTabulations () {}
+
+  public:
+    //! select the tabulation for GeometryType t in the QuadratureRule of order p
+    static const MultiLinearTabulation &
+    tabulation ( const GeometryType &t, int p, QuadratureType::Enum qt = QuadratureType::GaussLegendre )
+    {
+      return instance()._tabulation( t, p, qt );
+    }
+  };
+
+} // namespace Dune
+
+#endif // #ifndef DUNE_GEOMETRY_MULTILINEARTABULATION_HH
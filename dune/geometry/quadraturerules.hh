@@ -5,9 +5,20 @@
 #define DUNE_GEOMETRY_QUADRATURERULES_HH
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <limits>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -17,7 +28,9 @@
 #include <dune/common/stdthread.hh>
 #include <dune/common/visibility.hh>
 
+#include <dune/geometry/quadraturerules/gaussjacobi.hh>
 #include <dune/geometry/quadraturerules/nocopyvector.hh>
+#include <dune/geometry/quadraturerules/quadraturecache.hh>
 #include <dune/geometry/type.hh>
 #include <dune/geometry/typeindex.hh>
 
@@ -74,6 +87,116 @@ namespace Dune {
     ct weight_;
   };
 
+  /** \brief Structure-of-arrays layout of the points of a quadrature rule
+      \ingroup Quadrature
+
+      The coordinates of all quadrature points are stored direction by
+      direction, followed by the weights, in one contiguous buffer.  Each of
+      these dim+1 arrays starts on an address aligned to \ref alignment bytes
+      and holds paddedSize() entries, so kernels may process the points in
+      full vector registers.  The padding entries have zero coordinates and
+      zero weights and therefore do not contribute to a quadrature sum.
+
+      \tparam ct Number type used for both coordinates and the weights
+      \tparam dim Dimension of the integration domain
+   */
+  template<typename ct, int dim>
+  class QuadratureRuleSoA
+  {
+  public:
+    /** \brief Alignment of each of the arrays in bytes */
+    static const std::size_t alignment = 64;
+
+    /** \brief Create an empty structure of arrays */
+    QuadratureRuleSoA () : size_(0), paddedSize_(0), offset_(0) {}
+
+    /** \brief Copy the points of a quadrature rule into the structure of arrays
+     *
+     *  \param points  random access container of QuadraturePoint<ct,dim>
+     */
+    template<class Points>
+    explicit QuadratureRuleSoA (const Points &points)
+      : size_(points.size())
+    {
+      paddedSize_ = (size_ + lanes() - 1) / lanes() * lanes();
+      allocate();
+      for (std::size_t i = 0; i < size_; ++i)
+      {
+        for (int k = 0; k < dim; ++k)
+          data()[k*paddedSize_ + i] = points[i].position()[k];
+        data()[dim*paddedSize_ + i] = points[i].weight();
+      }
+    }
+
+    QuadratureRuleSoA (const QuadratureRuleSoA &other)
+      : size_(other.size_), paddedSize_(other.paddedSize_)
+    {
+      allocate();
+      std::copy(other.data(), other.data() + (dim+1)*paddedSize_, data());
+    }
+
+    QuadratureRuleSoA (QuadratureRuleSoA &&) = default;
+
+    QuadratureRuleSoA &operator= (const QuadratureRuleSoA &other)
+    {
+      if (this != &other)
+      {
+        size_ = other.size_;
+        paddedSize_ = other.paddedSize_;
+        allocate();
+        std::copy(other.data(), other.data() + (dim+1)*paddedSize_, data());
+      }
+      return *this;
+    }
+
+    QuadratureRuleSoA &operator= (QuadratureRuleSoA &&) = default;
+
+    //! number of quadrature points
+    std::size_t size () const { return size_; }
+
+    //! length of each array including the zero padding
+    std::size_t paddedSize () const { return paddedSize_; }
+
+    //! return the k-th coordinate of all quadrature points
+    const ct *position (int k) const
+    {
+      assert((k >= 0) && (k < dim));
+      return data() + k*paddedSize_;
+    }
+
+    //! return the weights of all quadrature points
+    const ct *weights () const
+    {
+      return data() + dim*paddedSize_;
+    }
+
+  private:
+    static std::size_t lanes ()
+    {
+      return std::max(alignment / sizeof(ct), std::size_t(1));
+    }
+
+    // allocate zero-initialized storage for (dim+1)*paddedSize_ entries with
+    // some slack, and find the first suitably aligned entry
+    void allocate ()
+    {
+      storage_.assign((dim+1)*paddedSize_ + lanes(), ct(0));
+      const std::size_t misalignment = reinterpret_cast<std::uintptr_t>(storage_.data()) % alignment;
+      if ((misalignment != 0) && ((alignment - misalignment) % sizeof(ct) == 0))
+        offset_ = (alignment - misalignment) / sizeof(ct);
+      else
+        offset_ = 0;
+    }
+
+    ct *data () { return storage_.data() + offset_; }
+    const ct *data () const { return storage_.data() + offset_; }
+
+    std::size_t size_;
+    std::size_t paddedSize_;
+    std::size_t offset_;
+    std::vector<ct> storage_;
+  };
+
   /** \brief Defines an \p enum for currently available quadrature rules.
       \ingroup Quadrature
    */
@@ -85,30 +208,46 @@ namespace Dune {
       GaussJacobi_2_0 = 2,
 
       GaussLobatto = 4,
+
+      /** \brief fully symmetric rules with positive weights and interior points
+       *
+       *  Selects SymmetricSimplexQuadratureRule on triangles and tetrahedra,
+       *  SymmetricPrismQuadratureRule on prisms, and PyramidQuadratureRule on
+       *  pyramids.  All other geometry types (and orders beyond the tabulated
+       *  ones) use the Gauss-Legendre based rules.
+       */
+      Symmetric = 5,
       size
     };
   }
 
+  // Forward declaration of the container class, which assembles rules
+  // read from cache files.
+  template<typename ctype, int dim> class QuadratureRules;
+
   /** \brief Abstract base class for quadrature rules
       \ingroup Quadrature
    */
   template<typename ct, int dim>
   class QuadratureRule : public std::vector<QuadraturePoint<ct,dim> >
   {
+    // rules read from a cache file are assembled by QuadratureRules
+    friend class QuadratureRules<ct,dim>;
+
   public:
     /** \brief Default constructor
      *
      * Create an invalid empty quadrature rule.  This must be initialized
      * later by copying another quadraturerule before it can be used.
      */
-    QuadratureRule() : delivered_order(-1) {}
+    QuadratureRule() : delivered_order(-1), tensorFactors_() {}
 
   protected:
     /** \brief Constructor for a given geometry type.  Leaves the quadrature order invalid  */
-    QuadratureRule(GeometryType t) : geometry_type(t), delivered_order(-1) {}
+    QuadratureRule(GeometryType t) : geometry_type(t), delivered_order(-1), tensorFactors_() {}
 
     /** \brief Constructor for a given geometry type and a given quadrature order */
-    QuadratureRule(GeometryType t, int order) : geometry_type(t), delivered_order(order) {}
+    QuadratureRule(GeometryType t, int order) : geometry_type(t), delivered_order(order), tensorFactors_() {}
   public:
     /** \brief The space dimension */
     enum { d=dim };
@@ -127,9 +266,94 @@ namespace Dune {
     //! therefore iterator is the same as const_iterator
     typedef typename std::vector<QuadraturePoint<ct,dim> >::const_iterator iterator;
 
+    /** \brief Return the points and weights in structure-of-arrays layout
+     *
+     *  The arrays are set up for all rules handed out by QuadratureRules.
+     *  Code filling a rule by hand has to call updateSoA() afterwards.
+     */
+    const QuadratureRuleSoA<ct,dim> &soa () const { return soa_; }
+
+    //! rebuild the structure-of-arrays layout from the current points
+    void updateSoA () { soa_ = QuadratureRuleSoA<ct,dim>(*this); }
+
+    /** \brief Check whether the rule is a tensor product of one-dimensional rules
+     *
+     *  For a tensor product rule with \f$n_k\f$ points in direction k, the
+     *  point with index \f$(\dots(i_0 n_1 + i_1) n_2 + \dots) n_{dim-1} + i_{dim-1}\f$
+     *  is the product of the \f$i_k\f$-th points of the rules tensorFactor(k),
+     *  i.e., direction 0 varies slowest.  This structure allows for
+     *  sum-factorized evaluation, see TensorContraction.  A one-dimensional
+     *  rule is the tensor product of itself.
+     */
+    bool isTensorProduct () const { return (dim == 1) || ((dim > 1) && (tensorFactors_[0] != nullptr)); }
+
+    //! return the one-dimensional rule in direction k of a tensor product rule
+    const QuadratureRule<ct,1> &tensorFactor (int k) const
+    {
+      assert(isTensorProduct() && (k >= 0) && (k < dim));
+      return *tensorFactor(k, this);
+    }
+
   protected:
+    //! mark the rule as tensor product of one-dimensional rules (which must outlive it)
+    void setTensorFactors (const std::array<const QuadratureRule<ct,1>*, dim> &factors) { tensorFactors_ = factors; }
+
     GeometryType geometry_type;
     int delivered_order;
+
+  private:
+    // a one-dimensional rule is its own factor (a stored pointer would dangle on copies)
+    const QuadratureRule<ct,1> *tensorFactor (int, const QuadratureRule<ct,1> *self) const { return self; }
+    const QuadratureRule<ct,1> *tensorFactor (int k, const void *) const { return tensorFactors_[k]; }
+
+    QuadratureRuleSoA<ct,dim> soa_;
+    std::array<const QuadratureRule<ct,1>*, dim> tensorFactors_;
+  };
+
+  /** \brief Handle referring to a quadrature rule held by QuadratureRules
+      \ingroup Quadrature
+
+      A handle is obtained once by QuadratureRules::handle() and can then be
+      stored, e.g., in data kept per geometry type.  Dereferencing it is a
+      plain pointer access.
+   */
+  template<typename ct, int dim>
+  class QuadratureRuleHandle {
+  public:
+    //! type of the quadrature rule
+    typedef Dune::QuadratureRule<ct, dim> QuadratureRule;
+
+    //! create an invalid handle
+    QuadratureRuleHandle () : rule_(nullptr) {}
+
+    //! create a handle for a rule (which must outlive the handle)
+    explicit QuadratureRuleHandle (const QuadratureRule& rule) : rule_(&rule) {}
+
+    //! access the quadrature rule
+    const QuadratureRule& operator* () const
+    {
+      assert(rule_);
+      return *rule_;
+    }
+
+    //! access the quadrature rule
+    const QuadratureRule* operator-> () const
+    {
+      assert(rule_);
+      return rule_;
+    }
+
+    //! return a pointer to the quadrature rule (or nullptr, if invalid)
+    const QuadratureRule* get () const { return rule_; }
+
+    //! check whether the handle refers to a quadrature rule
+    explicit operator bool () const { return rule_ != nullptr; }
+
+    bool operator== (const QuadratureRuleHandle& other) const { return rule_ == other.rule_; }
+    bool operator!= (const QuadratureRuleHandle& other) const { return rule_ != other.rule_; }
+
+  private:
+    const QuadratureRule* rule_;
   };
 
   // Forward declaration of the factory class,
@@ -138,6 +362,17 @@ namespace Dune {
 
   /** \brief A container for all quadrature rules of dimension <tt>dim</tt>
       \ingroup Quadrature
+
+      Rules are created lazily and thread-safe on first access.  Once a rule
+      of order less than numFastOrders has been created, it is published in a
+      flat table, so that later lookups cost a single atomic load.  Use
+      preload() to create the rules needed by an application up front.
+      Rules of order numCachedOrders or higher are kept in a map guarded by a
+      mutex.
+
+      The rules created by a process can be written to a cache file using
+      writeCache().  Other processes pass this file to readCache() at
+      startup and obtain the rules from the file instead of computing them.
    */
   template<typename ctype, int dim>
   class QuadratureRules {
@@ -146,10 +381,15 @@ namespace Dune {
     typedef Dune::QuadratureRule<ctype, dim> QuadratureRule;
     //! \brief a quadrature rule (for each quadrature order, geometry type,
     //!        and quadrature type)
-    static void initQuadratureRule(QuadratureRule *qr, QuadratureType::Enum qt,
-                                   const GeometryType &t, int p)
+    void initQuadratureRule(QuadratureRule *qr, QuadratureType::Enum qt,
+                            const GeometryType &t, int p)
     {
-      *qr = QuadratureRuleFactory<ctype,dim>::rule(t,p,qt);
+      if(!readCachedRule(*qr, qt, t, p))
+        *qr = QuadratureRuleFactory<ctype,dim>::rule(t,p,qt);
+      qr->updateSoA();
+
+      std::lock_guard<std::mutex> guard(cacheMutex_);
+      createdRules_.emplace_back(Key(qt, LocalGeometryTypeIndex::index(t), p), qr);
     }
 
     typedef NoCopyVector<std::pair<std::once_flag, QuadratureRule> >
@@ -164,7 +404,8 @@ namespace Dune {
         // we only need one quadrature rule for points, not maxint
         qov->resize(1);
       else
-        qov->resize(QuadratureRuleFactory<ctype,dim>::maxOrder(t,qt)+1);
+        qov->resize(std::min(std::size_t(QuadratureRuleFactory<ctype,dim>::maxOrder(t,qt))+1,
+                             std::size_t(numCachedOrders)));
     }
 
     typedef NoCopyVector<std::pair<std::once_flag, QuadratureOrderVector> >
@@ -176,11 +417,53 @@ namespace Dune {
       gtv->resize(LocalGeometryTypeIndex::size(dim));
     }
 
+  public:
+    //! number of quadrature orders covered by the lock-free lookup table
+    static const int numFastOrders = 32;
+
+    //! number of quadrature orders held in preallocated slots per geometry type
+    static const int numCachedOrders = 64;
+
+  private:
+    //! number of geometry types in the lookup table
+    static const std::size_t numTypes = LocalGeometryTypeIndex::size(dim);
+
+    //! identification of a rule by quadrature type, geometry type index, and order
+    typedef std::tuple<int, std::size_t, int> Key;
+
+    //! slot of a rule in the lookup table (or nullptr, if not covered)
+    std::atomic<const QuadratureRule*> *fastSlot(const GeometryType& t, int p, QuadratureType::Enum qt)
+    {
+      // we only have one quadrature rule for points
+      const int order = (dim == 0 ? 0 : p);
+      if((order < 0) || (order >= numFastOrders) || (qt >= QuadratureType::size))
+        return nullptr;
+      return &fastRules_[(qt*numTypes + LocalGeometryTypeIndex::index(t))*numFastOrders + order];
+    }
+
     //! real rule creator
     DUNE_EXPORT const QuadratureRule& _rule(const GeometryType& t, int p, QuadratureType::Enum qt=QuadratureType::GaussLegendre)
     {
       assert(t.dim()==dim);
 
+      // fast path: the rule has already been published
+      std::atomic<const QuadratureRule*> *slot = fastSlot(t, p, qt);
+      if(slot)
+      {
+        const QuadratureRule *rule = slot->load(std::memory_order_acquire);
+        if(rule)
+          return *rule;
+      }
+
+      const QuadratureRule &rule = _createRule(t, p, qt);
+      if(slot)
+        slot->store(&rule, std::memory_order_release);
+      return rule;
+    }
+
+    //! create a rule (or look it up in the cache)
+    const QuadratureRule& _createRule(const GeometryType& t, int p, QuadratureType::Enum qt)
+    {
       DUNE_ASSERT_CALL_ONCE();
 
       static NoCopyVector<std::pair< // indexed by quadrature type
@@ -198,12 +481,34 @@ namespace Dune {
                      &geometryTypeLevel.second, qt, t);
 
       // we only have one quadrature rule for points
-      auto & quadratureOrderLevel = geometryTypeLevel.second[dim == 0 ? 0 : p];
-      std::call_once(quadratureOrderLevel.first, initQuadratureRule,
-                     &quadratureOrderLevel.second, qt, t, p);
+      const std::size_t order = (dim == 0 ? 0 : p);
+      if(order >= geometryTypeLevel.second.size())
+        return _createHighOrderRule(t, p, qt);
+
+      auto & quadratureOrderLevel = geometryTypeLevel.second[order];
+      std::call_once(quadratureOrderLevel.first, &QuadratureRules::initQuadratureRule,
+                     this, &quadratureOrderLevel.second, qt, t, p);
 
       return quadratureOrderLevel.second;
     }
+
+    //! create a rule beyond the preallocated orders (or look it up in the cache)
+    DUNE_EXPORT const QuadratureRule& _createHighOrderRule(const GeometryType& t, int p, QuadratureType::Enum qt)
+    {
+      static std::mutex mutex;
+      static std::map<Key, std::unique_ptr<QuadratureRule> > cache;
+
+      std::lock_guard<std::mutex> guard(mutex);
+      std::unique_ptr<QuadratureRule> &rule = cache[Key(qt, LocalGeometryTypeIndex::index(t), p)];
+      if(!rule)
+      {
+        std::unique_ptr<QuadratureRule> newRule(new QuadratureRule);
+        initQuadratureRule(newRule.get(), qt, t, p);
+        rule = std::move(newRule);
+      }
+      return *rule;
+    }
+
     //! singleton provider
     DUNE_EXPORT static QuadratureRules& instance()
     {
@@ -211,9 +516,193 @@ namespace Dune {
       return instance;
     }
     //! private constructor
-    QuadratureRules () {}
+    QuadratureRules ()
+    {
+      for(std::atomic<const QuadratureRule*> &slot : fastRules_)
+        slot.store(nullptr, std::memory_order_relaxed);
+    }
+
+    //! fill a rule from the cache files read so far (returns false, if it is not contained)
+    bool readCachedRule(QuadratureRule &qr, QuadratureType::Enum qt, const GeometryType &t, int p)
+    {
+      const char *record = nullptr;
+      {
+        std::lock_guard<std::mutex> guard(cacheMutex_);
+        auto it = cachedRules_.find(Key(qt, LocalGeometryTypeIndex::index(t), p));
+        if(it == cachedRules_.end())
+          return false;
+        record = it->second;
+      }
+
+      Impl::QuadratureCacheRecord header;
+      std::memcpy(&header, record, sizeof(header));
+      record += sizeof(header);
+
+      std::int32_t factorOrders[dim > 0 ? dim : 1];
+      std::memcpy(factorOrders, record, dim*sizeof(std::int32_t));
+      record += dim*sizeof(std::int32_t);
+
+      qr = QuadratureRule(t, header.deliveredOrder);
+      qr.reserve(header.size);
+      for(std::uint64_t i = 0; i < header.size; ++i)
+      {
+        ctype values[dim+1];
+        std::memcpy(values, record, sizeof(values));
+        record += sizeof(values);
+
+        FieldVector<ctype,dim> x;
+        for(int k = 0; k < dim; ++k)
+          x[k] = values[k];
+        qr.push_back(QuadraturePoint<ctype,dim>(x, values[dim]));
+      }
+
+      // reestablish the tensor product structure (one-dimensional rules are
+      // their own factor, looking them up here would recurse into this rule)
+      if((dim > 1) && (factorOrders[0] >= 0))
+      {
+        std::array<const Dune::QuadratureRule<ctype,1>*, dim> factors;
+        const GeometryType line(GeometryType::cube, 1);
+        for(int k = 0; k < dim; ++k)
+          factors[k] = &QuadratureRules<ctype,1>::rule(line, factorOrders[k], qt);
+        qr.setTensorFactors(factors);
+      }
+      return true;
+    }
+
+    //! write all rules created so far to a cache file
+    void _writeCache(const std::string &filename)
+    {
+      static_assert(std::is_trivially_copyable<ctype>::value,
+                    "Quadrature cache files require a trivially copyable number type.");
+
+      std::vector<char> data(sizeof(Impl::QuadratureCacheHeader));
+      std::uint32_t numRules = 0;
+      {
+        std::lock_guard<std::mutex> guard(cacheMutex_);
+        for(const auto &created : createdRules_)
+        {
+          const QuadratureRule &qr = *created.second;
+
+          Impl::QuadratureCacheRecord record;
+          record.quadratureType = std::get<0>(created.first);
+          record.topologyId = qr.type().id();
+          record.order = std::get<2>(created.first);
+          record.deliveredOrder = qr.order();
+          record.size = qr.size();
+          append(data, &record, sizeof(record));
+
+          for(int k = 0; k < dim; ++k)
+          {
+            const std::int32_t factorOrder = (qr.isTensorProduct() ? qr.tensorFactor(k).order() : -1);
+            append(data, &factorOrder, sizeof(factorOrder));
+          }
+
+          for(const auto &qp : qr)
+          {
+            ctype values[dim+1];
+            for(int k = 0; k < dim; ++k)
+              values[k] = qp.position()[k];
+            values[dim] = qp.weight();
+            append(data, values, sizeof(values));
+          }
+          ++numRules;
+        }
+      }
+
+      Impl::QuadratureCacheHeader header;
+      std::memcpy(header.magic, Impl::quadratureCacheMagic, sizeof(header.magic));
+      header.version = Impl::QuadratureCacheHeader::currentVersion;
+      header.byteOrder = Impl::QuadratureCacheHeader::byteOrderMark;
+      header.fieldSize = sizeof(ctype);
+      header.fieldDigits = std::numeric_limits<ctype>::digits;
+      header.dimension = dim;
+      header.numRules = numRules;
+      std::memcpy(data.data(), &header, sizeof(header));
+
+      Impl::writeQuadratureCacheFile(filename, data);
+    }
+
+    //! make the rules contained in a cache file available
+    std::size_t _readCache(const std::string &filename)
+    {
+      static_assert(std::is_trivially_copyable<ctype>::value,
+                    "Quadrature cache files require a trivially copyable number type.");
+
+      std::unique_ptr<Impl::QuadratureCacheFile> file(new Impl::QuadratureCacheFile(filename));
+      const char *pos = file->data();
+      const char *end = pos + file->size();
+
+      Impl::QuadratureCacheHeader header;
+      if(file->size() < sizeof(header))
+        DUNE_THROW(IOError, "Quadrature cache file '" << filename << "' is truncated");
+      std::memcpy(&header, pos, sizeof(header));
+      pos += sizeof(header);
+
+      if(std::memcmp(header.magic, Impl::quadratureCacheMagic, sizeof(header.magic)) != 0)
+        DUNE_THROW(IOError, "'" << filename << "' is no quadrature cache file");
+      if((header.version != Impl::QuadratureCacheHeader::currentVersion)
+         || (header.byteOrder != Impl::QuadratureCacheHeader::byteOrderMark))
+        DUNE_THROW(IOError, "Quadrature cache file '" << filename << "' has an incompatible format");
+      if((header.fieldSize != sizeof(ctype))
+         || (header.fieldDigits != std::uint32_t(std::numeric_limits<ctype>::digits))
+         || (header.dimension != std::uint32_t(dim)))
+        DUNE_THROW(IOError, "Quadrature cache file '" << filename << "' does not match the number type or dimension");
+
+      // validate all records before making any of them available
+      std::vector<std::pair<Key, const char*> > records;
+      for(std::uint32_t i = 0; i < header.numRules; ++i)
+      {
+        Impl::QuadratureCacheRecord record;
+        if(std::size_t(end - pos) < sizeof(record))
+          DUNE_THROW(IOError, "Quadrature cache file '" << filename << "' is truncated");
+        std::memcpy(&record, pos, sizeof(record));
+
+        const std::uint64_t recordSize = sizeof(record) + dim*sizeof(std::int32_t)
+                                         + record.size*(dim+1)*sizeof(ctype);
+        if((record.quadratureType < 0) || (record.quadratureType >= QuadratureType::size)
+           || (record.topologyId >= (1u << dim))
+           || (record.size > std::uint64_t(end - pos)) || (recordSize > std::uint64_t(end - pos)))
+          DUNE_THROW(IOError, "Quadrature cache file '" << filename << "' is corrupt");
+
+        const GeometryType t(record.topologyId, dim);
+        records.emplace_back(Key(record.quadratureType, LocalGeometryTypeIndex::index(t), record.order), pos);
+        pos += recordSize;
+      }
+
+      std::lock_guard<std::mutex> guard(cacheMutex_);
+      for(const auto &record : records)
+        cachedRules_.insert(record);
+      cacheFiles_.push_back(std::move(file));
+      return records.size();
+    }
+
+    //! append raw bytes to a buffer
+    static void append(std::vector<char> &data, const void *bytes, std::size_t size)
+    {
+      const char *begin = static_cast<const char*>(bytes);
+      data.insert(data.end(), begin, begin + size);
+    }
+
+    //! rules published for lock-free lookup, indexed by quadrature type,
+    //! geometry type, and order
+    std::atomic<const QuadratureRule*> fastRules_[QuadratureType::size*numTypes*numFastOrders];
+
+    //! mutex protecting the bookkeeping of cache files
+    std::mutex cacheMutex_;
+    //! all rules created so far (in order of creation)
+    std::vector<std::pair<Key, const QuadratureRule*> > createdRules_;
+    //! records of the rules contained in the cache files read
+    std::map<Key, const char*> cachedRules_;
+    //! cache files read (kept open, since the records refer to them)
+    std::vector<std::unique_ptr<Impl::QuadratureCacheFile> > cacheFiles_;
+
   public:
-    //! maximum quadrature order for given geometry type and quadrature type
+    /** \brief maximum quadrature order for given geometry type and quadrature type
+     *
+     *  This is the highest order of the tabulated rules and of the rules
+     *  composed of one-dimensional rules up to their highest_order.  It
+     *  bounds the orders kept in preallocated slots and created by preload().
+     */
     static unsigned
     maxOrder(const GeometryType& t,
              QuadratureType::Enum qt=QuadratureType::GaussLegendre)
@@ -221,7 +710,13 @@ namespace Dune {
       return QuadratureRuleFactory<ctype,dim>::maxOrder(t,qt);
     }
 
-    //! select the appropriate QuadratureRule for GeometryType t and order p
+    /** \brief select the appropriate QuadratureRule for GeometryType t and order p
+     *
+     *  The order p may exceed maxOrder( t, qt ) for rules composed of
+     *  one-dimensional Gauss-type rules (lines, cubes, prisms, pyramids and,
+     *  through conical products, simplices), which are computed at runtime
+     *  for any order.  Such rules are created once and memoized as well.
+     */
     static const QuadratureRule& rule(const GeometryType& t, int p, QuadratureType::Enum qt=QuadratureType::GaussLegendre)
     {
       return instance()._rule(t,p,qt);
@@ -232,6 +727,123 @@ namespace Dune {
       GeometryType gt(t,dim);
       return instance()._rule(gt,p,qt);
     }
+
+    //! obtain a handle to the QuadratureRule for GeometryType t and order p
+    static QuadratureRuleHandle<ctype, dim> handle(const GeometryType& t, int p, QuadratureType::Enum qt=QuadratureType::GaussLegendre)
+    {
+      return QuadratureRuleHandle<ctype, dim>(rule(t,p,qt));
+    }
+
+    /** \brief create the rules up to a given order for a set of geometry types
+     *
+     *  Calling this at startup moves the cost of creating the rules out of
+     *  the (possibly threaded) assembly.
+     *
+     *  \param[in]  maxOrder  maximum order to create (orders above maxOrder( t, qt )
+     *                        are skipped)
+     *  \param[in]  types     geometry types to create the rules for
+     *  \param[in]  qt        quadrature type
+     */
+    static void preload(int maxOrder, const std::vector<GeometryType>& types,
+                        QuadratureType::Enum qt=QuadratureType::GaussLegendre)
+    {
+      for(const GeometryType &t : types)
+      {
+        const int pMax = (dim == 0 ? 0 : std::min(maxOrder, int(QuadratureRules::maxOrder(t, qt))));
+        for(int p = 0; p <= pMax; ++p)
+          rule(t, p, qt);
+      }
+    }
+
+    /** \brief write all rules created so far to a cache file
+     *
+     *  Typically, one process creates the rules needed by an application
+     *  (e.g., using preload()) and writes them to a file, which is read by
+     *  all processes of later runs.  The file is specific to the number type
+     *  and the dimension.
+     *
+     *  \note Rules created concurrently with this call might be missing from
+     *        the file.
+     *
+     *  \param[in]  filename  name of the cache file (it is replaced atomically)
+     */
+    static void writeCache(const std::string &filename)
+    {
+      instance()._writeCache(filename);
+    }
+
+    /** \brief use the rules contained in a cache file
+     *
+     *  The file is mapped into memory (where supported) and kept open.  Rules
+     *  contained in the file are copied from it on first use instead of being
+     *  computed; rules already created are not affected.  Therefore, the
+     *  cache should be read at startup.
+     *
+     *  \param[in]  filename  name of a file written by writeCache()
+     *
+     *  \returns the number of rules contained in the file
+     *
+     *  \throws IOError if the file cannot be read or does not match the number
+     *          type or dimension
+     */
+    static std::size_t readCache(const std::string &filename)
+    {
+      return instance()._readCache(filename);
+    }
+
+    /** \brief create the rules up to a given order for all geometry types
+     *         of dimension <tt>dim</tt>
+     *
+     *  \param[in]  maxOrder  maximum order to create
+     *  \param[in]  qt        quadrature type
+     */
+    static void preload(int maxOrder, QuadratureType::Enum qt=QuadratureType::GaussLegendre)
+    {
+      std::vector<GeometryType> types;
+      for(std::size_t i = 0; i < LocalGeometryTypeIndex::size(dim)-1; ++i)
+        types.push_back(LocalGeometryTypeIndex::type(dim, i));
+      preload(maxOrder, types, qt);
+    }
+  };
+
+  /** \brief Handle to a quadrature rule whose geometry type and order are
+             known at compile time
+      \ingroup Quadrature
+
+      The handle is an empty object.  The rule is looked up once, on first
+      dereference, and kept in a function-local static afterwards.
+
+      \tparam ct          number type
+      \tparam dim         dimension
+      \tparam topologyId  topology id of the geometry type
+      \tparam order       order of the quadrature rule
+      \tparam qt          quadrature type
+   */
+  template<typename ct, int dim, unsigned int topologyId, int order,
+           QuadratureType::Enum qt = QuadratureType::GaussLegendre>
+  class StaticQuadratureRuleHandle {
+  public:
+    //! type of the quadrature rule
+    typedef Dune::QuadratureRule<ct, dim> QuadratureRule;
+
+    //! access the quadrature rule
+    static const QuadratureRule& rule ()
+    {
+      static const QuadratureRule& rule = QuadratureRules<ct, dim>::rule(GeometryType(topologyId, dim), order, qt);
+      return rule;
+    }
+
+    //! access the quadrature rule
+    const QuadratureRule& operator* () const { return rule(); }
+
+    //! access the quadrature rule
+    const QuadratureRule* operator-> () const { return &rule(); }
+
+    //! return a pointer to the quadrature rule
+    const QuadratureRule* get () const { return &rule(); }
+
+    //! convert into a QuadratureRuleHandle
+    operator QuadratureRuleHandle<ct, dim> () const { return QuadratureRuleHandle<ct, dim>(rule()); }
   };
 
 } // end namespace Dune
@@ -240,24 +852,6 @@ namespace Dune {
 
 namespace Dune {
 
-  //! \internal Helper template for the initialization of the quadrature rules
-  template<typename ct, bool fundamental = std::numeric_limits<ct>::is_specialized>
-  struct GaussQuadratureInitHelper;
-  template<typename ct>
-  struct GaussQuadratureInitHelper<ct, true> {
-    static void init(int p,
-                     std::vector< FieldVector<ct, 1> > & _points,
-                     std::vector< ct > & _weight,
-                     int & delivered_order);
-  };
-  template<typename ct>
-  struct GaussQuadratureInitHelper<ct, false> {
-    static void init(int p,
-                     std::vector< FieldVector<ct, 1> > & _points,
-                     std::vector< ct > & _weight,
-                     int & delivered_order);
-  };
-
   //! \brief Gauss quadrature rule in 1D
   template<typename ct>
   class GaussQuadratureRule1D :
@@ -266,6 +860,13 @@ namespace Dune {
   public:
     // compile time parameters
     enum { dim=1 };
+    /** \brief The highest order of the tabulated rules
+     *
+     *  Rules up to this order (31 points) are read from
+     *  Impl::gaussJacobiTable, for float and double bit-identical to the
+     *  former literal tables (checked in test-quadrature).  Higher orders are
+     *  computed at runtime to about one ulp, see QuadratureRules::rule().
+     */
     enum { highest_order=61 };
 
     ~GaussQuadratureRule1D(){}
@@ -278,8 +879,7 @@ namespace Dune {
       std::vector< FieldVector<ct, dim> > _points;
       std::vector< ct > _weight;
 
-      GaussQuadratureInitHelper<ct>::init
-        (p, _points, _weight, this->delivered_order);
+      Impl::computeGaussJacobiRule(p, 0, _points, _weight, this->delivered_order);
 
       assert(_points.size() == _weight.size());
       for (size_t i = 0; i < _points.size(); i++)
@@ -290,32 +890,6 @@ namespace Dune {
   extern template GaussQuadratureRule1D<float>::GaussQuadratureRule1D(int);
   extern template GaussQuadratureRule1D<double>::GaussQuadratureRule1D(int);
 
-} // namespace Dune
-
-#define DUNE_INCLUDING_IMPLEMENTATION
-#include "quadraturerules/gauss_imp.hh"
-
-namespace Dune {
-
-  //! \internal Helper template for the initialization of the quadrature rules
-  template<typename ct,
-      bool fundamental = std::numeric_limits<ct>::is_specialized>
-  struct Jacobi1QuadratureInitHelper;
-  template<typename ct>
-  struct Jacobi1QuadratureInitHelper<ct, true> {
-    static void init(int p,
-                     std::vector< FieldVector<ct, 1> > & _points,
-                     std::vector< ct > & _weight,
-                     int & delivered_order);
-  };
-  template<typename ct>
-  struct Jacobi1QuadratureInitHelper<ct, false> {
-    static void init(int p,
-                     std::vector< FieldVector<ct, 1> > & _points,
-                     std::vector< ct > & _weight,
-                     int & delivered_order);
-  };
-
   /** \brief Jacobi-Gauss quadrature for alpha=1, beta=0
       \ingroup Quadrature
    */
@@ -327,7 +901,11 @@ namespace Dune {
     /** \brief The space dimension */
     enum { dim=1 };
 
-    /** \brief The highest quadrature order available */
+    /** \brief The highest order of the tabulated rules
+     *
+     *  As for the Gauss-Legendre rules, the rules up to this order are read
+     *  from Impl::gaussJacobiTable (alpha = 1) and higher orders are computed.
+     */
     enum { highest_order=61 };
 
     ~Jacobi1QuadratureRule1D(){}
@@ -342,8 +920,7 @@ namespace Dune {
 
       int deliveredOrder_;
 
-      Jacobi1QuadratureInitHelper<ct>::init
-        (p, _points, _weight, deliveredOrder_);
+      Impl::computeGaussJacobiRule(p, 1, _points, _weight, deliveredOrder_);
       this->delivered_order = deliveredOrder_;
       assert(_points.size() == _weight.size());
       for (size_t i = 0; i < _points.size(); i++)
@@ -356,32 +933,6 @@ namespace Dune {
   extern template Jacobi1QuadratureRule1D<double>::Jacobi1QuadratureRule1D(int);
 #endif // !DOXYGEN
 
-} // namespace Dune
-
-#define DUNE_INCLUDING_IMPLEMENTATION
-#include "quadraturerules/jacobi_1_0_imp.hh"
-
-namespace Dune {
-
-  //! \internal Helper template for the initialization of the quadrature rules
-  template<typename ct,
-      bool fundamental = std::numeric_limits<ct>::is_specialized>
-  struct Jacobi2QuadratureInitHelper;
-  template<typename ct>
-  struct Jacobi2QuadratureInitHelper<ct, true> {
-    static void init(int p,
-                     std::vector< FieldVector<ct, 1> > & _points,
-                     std::vector< ct > & _weight,
-                     int & delivered_order);
-  };
-  template<typename ct>
-  struct Jacobi2QuadratureInitHelper<ct, false> {
-    static void init(int p,
-                     std::vector< FieldVector<ct, 1> > & _points,
-                     std::vector< ct > & _weight,
-                     int & delivered_order);
-  };
-
   /** \brief Jacobi-Gauss quadrature for alpha=2, beta=0
       \ingroup Quadrature
    */
@@ -393,7 +944,11 @@ namespace Dune {
     /** \brief The space dimension */
     enum { dim=1 };
 
-    /** \brief The highest quadrature order available */
+    /** \brief The highest order of the tabulated rules
+     *
+     *  As for the Gauss-Legendre rules, the rules up to this order are read
+     *  from Impl::gaussJacobiTable (alpha = 2) and higher orders are computed.
+     */
     enum { highest_order=61 };
 
     ~Jacobi2QuadratureRule1D(){}
@@ -408,8 +963,7 @@ namespace Dune {
 
       int deliveredOrder_;
 
-      Jacobi2QuadratureInitHelper<ct>::init
-        (p, _points, _weight, deliveredOrder_);
+      Impl::computeGaussJacobiRule(p, 2, _points, _weight, deliveredOrder_);
 
       this->delivered_order = deliveredOrder_;
       assert(_points.size() == _weight.size());
@@ -423,32 +977,6 @@ namespace Dune {
   extern template Jacobi2QuadratureRule1D<double>::Jacobi2QuadratureRule1D(int);
 #endif // !DOXYGEN
 
-} // namespace Dune
-
-#define DUNE_INCLUDING_IMPLEMENTATION
-#include "quadraturerules/jacobi_2_0_imp.hh"
-
-namespace Dune {
-
-  //! \internal Helper template for the initialization of the quadrature rules
-  template<typename ct,
-      bool fundamental = std::numeric_limits<ct>::is_specialized>
-  struct GaussLobattoQuadratureInitHelper;
-  template<typename ct>
-  struct GaussLobattoQuadratureInitHelper<ct, true> {
-    static void init(int p,
-                     std::vector< FieldVector<ct, 1> > & _points,
-                     std::vector< ct > & _weight,
-                     int & delivered_order);
-  };
-  template<typename ct>
-  struct GaussLobattoQuadratureInitHelper<ct, false> {
-    static void init(int p,
-                     std::vector< FieldVector<ct, 1> > & _points,
-                     std::vector< ct > & _weight,
-                     int & delivered_order);
-  };
-
   /** \brief Jacobi-Gauss quadrature for alpha=2, beta=0
       \ingroup Quadrature
    */
@@ -460,7 +988,13 @@ namespace Dune {
     /** \brief The space dimension */
     enum { dim=1 };
 
-    /** \brief The highest quadrature order available */
+    /** \brief The highest order covered by the former tables
+     *
+     *  All Gauss-Lobatto rules are computed.  Up to this order (17 points),
+     *  they agree with the former literal tables to 3e-16, the error of
+     *  those tables.  Higher orders are computed at runtime as well, but are
+     *  not preloaded, see QuadratureRules::rule().
+     */
     enum { highest_order=31 };
 
     ~GaussLobattoQuadratureRule1D(){}
@@ -475,8 +1009,7 @@ namespace Dune {
 
       int deliveredOrder_;
 
-      GaussLobattoQuadratureInitHelper<ct>::init
-        (p, _points, _weight, deliveredOrder_);
+      Impl::computeGaussLobattoRule(p, _points, _weight, deliveredOrder_);
 
       this->delivered_order = deliveredOrder_;
       assert(_points.size() == _weight.size());
@@ -492,12 +1025,12 @@ namespace Dune {
 
 } // namespace Dune
 
-#define DUNE_INCLUDING_IMPLEMENTATION
-#include "quadraturerules/gausslobatto_imp.hh"
-
 #include "quadraturerules/tensorproductquadrature.hh"
 
 #include "quadraturerules/simplexquadrature.hh"
+#include "quadraturerules/symmetricsimplexquadrature.hh"
+#include "quadraturerules/symmetricprismquadrature.hh"
+#include "quadraturerules/pyramidquadrature.hh"
 
 namespace Dune {
 
@@ -732,6 +1265,7 @@ namespace Dune {
       {
         switch (qt) {
         case QuadratureType::GaussLegendre :
+        case QuadratureType::Symmetric :
           return GaussQuadratureRule1D<ctype>::highest_order;
         case QuadratureType::GaussJacobi_1_0 :
           return Jacobi1QuadratureRule1D<ctype>::highest_order;
@@ -751,6 +1285,7 @@ namespace Dune {
       {
         switch (qt) {
         case QuadratureType::GaussLegendre :
+        case QuadratureType::Symmetric :
           return GaussQuadratureRule1D<ctype>(p);
         case QuadratureType::GaussJacobi_1_0 :
           return Jacobi1QuadratureRule1D<ctype>(p);
@@ -778,10 +1313,19 @@ namespace Dune {
       if (t.isSimplex())
         order = std::max
           (order, unsigned(SimplexQuadratureRule<ctype,dim>::highest_order));
+      if (t.isSimplex() && qt == QuadratureType::Symmetric)
+        order = std::max
+          (order, unsigned(SymmetricSimplexQuadratureRule<ctype,dim>::highest_order));
       return order;
     }
     static QuadratureRule<ctype, dim> rule(const GeometryType& t, int p, QuadratureType::Enum qt)
     {
+      if (t.isSimplex()
+        && qt == QuadratureType::Symmetric
+        && p <= SymmetricSimplexQuadratureRule<ctype,dim>::highest_order)
+      {
+        return SymmetricSimplexQuadratureRule<ctype,dim>(p);
+      }
       if (t.isSimplex()
         && qt == QuadratureType::GaussLegendre
         && p <= SimplexQuadratureRule<ctype,dim>::highest_order)
@@ -804,13 +1348,28 @@ namespace Dune {
       if (t.isSimplex())
         order = std::max
           (order, unsigned(SimplexQuadratureRule<ctype,dim>::highest_order));
+      if (t.isSimplex() && qt == QuadratureType::Symmetric)
+        order = std::max
+          (order, unsigned(SymmetricSimplexQuadratureRule<ctype,dim>::highest_order));
       if (t.isPrism())
         order = std::max
           (order, unsigned(PrismQuadratureRule<ctype,dim>::highest_order));
+      if (t.isPrism() && qt == QuadratureType::Symmetric)
+        order = std::max
+          (order, unsigned(SymmetricPrismQuadratureRule<ctype,dim>::highest_order));
+      if (t.isPyramid() && qt == QuadratureType::Symmetric)
+        order = std::max
+          (order, unsigned(PyramidQuadratureRule<ctype,dim>::highest_order));
       return order;
     }
     static QuadratureRule<ctype, dim> rule(const GeometryType& t, int p, QuadratureType::Enum qt)
     {
+      if (t.isSimplex()
+        && qt == QuadratureType::Symmetric
+        && p <= SymmetricSimplexQuadratureRule<ctype,dim>::highest_order)
+      {
+        return SymmetricSimplexQuadratureRule<ctype,dim>(p);
+      }
       if (t.isSimplex()
         && qt == QuadratureType::GaussLegendre
         && p <= SimplexQuadratureRule<ctype,dim>::highest_order)
@@ -823,6 +1382,18 @@ namespace Dune {
       {
         return PrismQuadratureRule<ctype,dim>(p);
       }
+      if (t.isPrism()
+        && qt == QuadratureType::Symmetric
+        && p <= SymmetricPrismQuadratureRule<ctype,dim>::highest_order)
+      {
+        return SymmetricPrismQuadratureRule<ctype,dim>(p);
+      }
+      if (t.isPyramid()
+        && qt == QuadratureType::Symmetric
+        && p <= PyramidQuadratureRule<ctype,dim>::highest_order)
+      {
+        return PyramidQuadratureRule<ctype,dim>(p);
+      }
       return TensorProductQuadratureRule<ctype,dim>(t.id(), p, qt);
     }
   };
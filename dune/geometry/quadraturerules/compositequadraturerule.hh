@@ -57,6 +57,7 @@ namespace Dune {
 
       }
 
+      this->updateSoA();
     }
 
   };
@@ -0,0 +1,313 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_QUADRATURERULES_GAUSSJACOBI_HH
+#define DUNE_GEOMETRY_QUADRATURERULES_GAUSSJACOBI_HH
+
+/** \file
+ *  \brief Computation of Gauss-Jacobi and Gauss-Lobatto rules from the
+ *         recurrence of the Jacobi polynomials
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <dune/common/fvector.hh>
+
+namespace Dune
+{
+
+  namespace Impl
+  {
+
+    // constexprCos
+    // ------------
+
+    //! cosine usable in constant expressions (for 0 <= x <= pi)
+    inline constexpr long double constexprCos ( long double x )
+    {
+      // cos( x ) = -cos( pi - x ) keeps the Taylor series short
+      const long double pi = 3.141592653589793238462643383279502884L;
+      const bool reflect = (x > pi/2);
+      const long double y = (reflect ? pi - x : x);
+
+      long double term = 1, sum = 1;
+      for( int k = 1; k < 20; ++k )
+      {
+        term *= -y*y / ((2*k-1)*(2*k));
+        sum += term;
+      }
+      return (reflect ? -sum : sum);
+    }
+
+
+
+    // jacobiPolynomial
+    // ----------------
+
+    /** \brief evaluate the Jacobi polynomial \f$P_n^{(\alpha,\beta)}\f$ and
+     *         \f$P_{n-1}^{(\alpha,\beta)}\f$ in t
+     */
+    template< class Real >
+    inline constexpr void jacobiPolynomial ( int n, int alpha, int beta, Real t, Real &p, Real &pPrev )
+    {
+      const int ab = alpha + beta;
+      pPrev = Real( 1 );
+      p = (n > 0 ? Real( alpha - beta ) / 2 + Real( ab + 2 ) / 2 * t : Real( 1 ));
+      for( int k = 2; k <= n; ++k )
+      {
+        const Real a = Real( 2*k ) * Real( k + ab ) * Real( 2*k + ab - 2 );
+        const Real b = Real( 2*k + ab - 1 ) * (Real( 2*k + ab ) * Real( 2*k + ab - 2 ) * t + Real( alpha*alpha - beta*beta ));
+        const Real c = Real( 2*(k + alpha - 1) ) * Real( k + beta - 1 ) * Real( 2*k + ab );
+        const Real pNext = (b*p - c*pPrev) / a;
+        pPrev = p;
+        p = pNext;
+      }
+    }
+
+    //! evaluate the derivative of \f$P_n^{(\alpha,\beta)}\f$ in t (for |t| < 1)
+    template< class Real >
+    inline constexpr Real jacobiPolynomialDerivative ( int n, int alpha, int beta, Real t )
+    {
+      Real p = Real( 0 ), pPrev = Real( 0 );
+      jacobiPolynomial( n, alpha, beta, t, p, pPrev );
+      const int ab = alpha + beta;
+      return (Real( n ) * (Real( alpha - beta ) - Real( 2*n + ab ) * t) * p + Real( 2*(n + alpha) ) * Real( n + beta ) * pPrev)
+             / (Real( 2*n + ab ) * (Real( 1 ) - t*t));
+    }
+
+
+
+    // jacobiRoots
+    // -----------
+
+    /** \brief compute the roots of \f$P_n^{(\alpha,\beta)}\f$ in descending
+     *         order
+     *
+     *  Each root is found by Newton's method, deflating the roots already
+     *  found, which makes the iteration independent of the quality of the
+     *  initial guesses.
+     */
+    inline constexpr void jacobiRoots ( int n, int alpha, int beta, long double *roots )
+    {
+      const long double pi = 3.141592653589793238462643383279502884L;
+      const long double tolerance = 4*std::numeric_limits< long double >::epsilon();
+      for( int i = 0; i < n; ++i )
+      {
+        long double t = constexprCos( pi*(i + 0.75L + alpha/2.0L) / (n + (alpha + beta + 1) / 2.0L) );
+        for( int iteration = 0; iteration < 100; ++iteration )
+        {
+          long double p = 0, pPrev = 0;
+          jacobiPolynomial( n, alpha, beta, t, p, pPrev );
+          long double deflation = 0;
+          for( int j = 0; j < i; ++j )
+            deflation += 1 / (t - roots[ j ]);
+          const long double dt = p / (jacobiPolynomialDerivative( n, alpha, beta, t ) - p*deflation);
+          t -= dt;
+          if( (dt < 0 ? -dt : dt) <= tolerance )
+            break;
+        }
+        roots[ i ] = t;
+      }
+    }
+
+    /** \brief polish a root of \f$P_n^{(\alpha,\beta)}\f$ in the number type ct
+     *
+     *  Newton's method is iterated as long as the corrections decrease, so
+     *  the root is obtained to the full precision of ct, even if
+     *  std::numeric_limits is not specialized for it.
+     */
+    template< class ct >
+    inline ct jacobiRoot ( int n, int alpha, int beta, long double root )
+    {
+      using std::abs;
+      ct t = ct( double( root ) );
+      ct lastCorrection = ct( 2 );
+      for( int iteration = 0; iteration < 100; ++iteration )
+      {
+        ct p = ct( 0 ), pPrev = ct( 0 );
+        jacobiPolynomial( n, alpha, beta, t, p, pPrev );
+        const ct dt = p / jacobiPolynomialDerivative( n, alpha, beta, t );
+        if( !(abs( dt ) < lastCorrection) )
+          break;
+        t -= dt;
+        lastCorrection = abs( dt );
+      }
+      return t;
+    }
+
+
+
+    // gaussJacobiTable
+    // ----------------
+
+    //! number of points of the largest tabulated Gauss-Jacobi rule
+    static const int gaussJacobiTableSize = 31;
+
+    /** \brief tabulated Gauss-Jacobi rules for the weights \f$(1-x)^\alpha\f$,
+     *         \f$\alpha = 0, 1, 2\f$, on [0,1]
+     *
+     *  The n-point rule (n <= gaussJacobiTableSize) starts at entry n(n-1) of
+     *  gaussJacobiTable[ alpha ] and alternates points and weights.  The
+     *  values are correctly rounded to double, which the computation in long
+     *  double does not achieve for all of them.  The weights are scaled as
+     *  in gaussJacobiRule( int, int, long double *, long double * ).
+     */
+    extern const double gaussJacobiTable[ 3 ][ gaussJacobiTableSize*(gaussJacobiTableSize+1) ];
+
+    //! copy the n-point Gauss-Jacobi rule from gaussJacobiTable (returns false, if it is not tabulated)
+    template< class ct >
+    inline bool tabulatedGaussJacobiRule ( int n, int alpha, std::vector< FieldVector< ct, 1 > > &points,
+                                           std::vector< ct > &weights, std::true_type )
+    {
+      if( (n > gaussJacobiTableSize) || (alpha < 0) || (alpha > 2) )
+        return false;
+
+      const double *entry = gaussJacobiTable[ alpha ] + n*(n-1);
+      points.resize( n );
+      weights.resize( n );
+      for( int i = 0; i < n; ++i )
+      {
+        points[ i ] = ct( entry[ 2*i ] );
+        weights[ i ] = ct( entry[ 2*i+1 ] );
+      }
+      return true;
+    }
+
+    //! other number types than float and double compute all rules in their own precision
+    template< class ct >
+    inline bool tabulatedGaussJacobiRule ( int, int, std::vector< FieldVector< ct, 1 > > &,
+                                           std::vector< ct > &, std::false_type )
+    {
+      return false;
+    }
+
+
+
+    // GaussJacobiField
+    // ----------------
+
+    /** \brief number type the rules for ct are computed in
+     *
+     *  Rules for the built-in floating point types are computed in long
+     *  double, so they are accurate to the last bit (or close to it).  Other
+     *  number types, e.g., multiprecision types, are used directly.
+     */
+    template< class ct >
+    using GaussJacobiField = typename std::conditional< std::is_floating_point< ct >::value, long double, ct >::type;
+
+
+
+    // gaussJacobiRule
+    // ---------------
+
+    /** \brief compute the n-point Gauss-Jacobi rule for the weight
+     *         \f$(1-x)^\alpha\f$ on [0,1]
+     *
+     *  The weights are scaled as in the tabulated Gauss-Jacobi rules, i.e.,
+     *  they sum up to \f$2^\alpha \int_0^1 (1-x)^\alpha\,dx\f$.
+     */
+    inline constexpr void gaussJacobiRule ( int n, int alpha, long double *points, long double *weights )
+    {
+      jacobiRoots( n, alpha, 0, points );
+
+      // 2^(alpha+1) Gamma(n+alpha+1) Gamma(n+1) / (Gamma(n+alpha+1) n!) = 2^(alpha+1)
+      const long double c = (1 << (alpha+1));
+      for( int i = 0; i < n; ++i )
+      {
+        const long double t = points[ i ];
+        const long double dp = jacobiPolynomialDerivative( n, alpha, 0, t );
+        weights[ i ] = c / ((1 - t*t)*dp*dp) / 2;
+        points[ i ] = (1 + t) / 2;
+      }
+    }
+
+    /** \brief compute the Gauss-Jacobi rule of order p for the weight
+     *         \f$(1-x)^\alpha\f$ on [0,1] in the number type ct
+     *
+     *  The weights are scaled as in gaussJacobiRule( int, int, long double *, long double * ).
+     *  For float and double, rules with up to gaussJacobiTableSize points are
+     *  taken from gaussJacobiTable.  All other rules are computed in
+     *  GaussJacobiField< ct >; for float and double, they are accurate to
+     *  about one unit in the last place.
+     */
+    template< class ct >
+    inline void computeGaussJacobiRule ( int p, int alpha, std::vector< FieldVector< ct, 1 > > &points,
+                                         std::vector< ct > &weights, int &deliveredOrder )
+    {
+      const int n = p/2 + 1;
+      deliveredOrder = 2*n-1;
+      typedef std::integral_constant< bool, std::is_same< ct, float >::value || std::is_same< ct, double >::value > Tabulated;
+      if( tabulatedGaussJacobiRule( n, alpha, points, weights, Tabulated() ) )
+        return;
+
+      std::vector< long double > roots( n );
+      jacobiRoots( n, alpha, 0, roots.data() );
+
+      typedef GaussJacobiField< ct > Field;
+      points.resize( n );
+      weights.resize( n );
+      const Field c = Field( 1 << (alpha+1) );
+      for( int i = 0; i < n; ++i )
+      {
+        const Field t = jacobiRoot< Field >( n, alpha, 0, roots[ i ] );
+        const Field dp = jacobiPolynomialDerivative( n, alpha, 0, t );
+        weights[ i ] = ct( c / ((Field( 1 ) - t*t)*dp*dp) / 2 );
+        points[ i ] = ct( (Field( 1 ) + t) / 2 );
+      }
+    }
+
+
+
+    // gaussLobattoRule
+    // ----------------
+
+    //! compute the n-point Gauss-Lobatto rule on [0,1] (n >= 2)
+    inline constexpr void gaussLobattoRule ( int n, long double *points, long double *weights )
+    {
+      // the interior points are the roots of P_{n-1}' = n/2 P_{n-2}^{(1,1)}
+      jacobiRoots( n-2, 1, 1, points+1 );
+
+      const long double w = 2.0L / (n*(n-1));
+      points[ 0 ] = -1;
+      points[ n-1 ] = 1;
+      for( int i = 0; i < n; ++i )
+      {
+        long double p = 0, pPrev = 0;
+        jacobiPolynomial( n-1, 0, 0, points[ i ], p, pPrev );
+        weights[ i ] = w / (p*p) / 2;
+        points[ i ] = (1 + points[ i ]) / 2;
+      }
+    }
+
+    //! compute the Gauss-Lobatto rule of order p on [0,1] in the number type ct
+    template< class ct >
+    inline void computeGaussLobattoRule ( int p, std::vector< FieldVector< ct, 1 > > &points,
+                                          std::vector< ct > &weights, int &deliveredOrder )
+    {
+      const int n = p/2 + 2;
+      std::vector< long double > roots( n );
+      jacobiRoots( n-2, 1, 1, roots.data()+1 );
+
+      typedef GaussJacobiField< ct > Field;
+      points.resize( n );
+      weights.resize( n );
+      const Field w = Field( 2 ) / (Field( n ) * Field( n-1 ));
+      for( int i = 0; i < n; ++i )
+      {
+        const Field t = (i == 0 ? Field( -1 ) : (i == n-1 ? Field( 1 ) : jacobiRoot< Field >( n-2, 1, 1, roots[ i ] )));
+        Field q = Field( 0 ), qPrev = Field( 0 );
+        jacobiPolynomial( n-1, 0, 0, t, q, qPrev );
+        weights[ i ] = ct( w / (q*q) / 2 );
+        points[ i ] = ct( (Field( 1 ) + t) / 2 );
+      }
+      deliveredOrder = 2*n-3;
+    }
+
+  } // namespace Impl
+
+} // namespace Dune
+
+#endif // #ifndef DUNE_GEOMETRY_QUADRATURERULES_GAUSSJACOBI_HH
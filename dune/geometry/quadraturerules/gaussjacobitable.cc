@@ -0,0 +1,1618 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+#include "config.h"
+
+#include <dune/geometry/quadraturerules/gaussjacobi.hh>
+
+namespace Dune
+{
+
+  namespace Impl
+  {
+
+    // gaussJacobiTable
+    // ----------------
+
+    /*
+     * The values are those of the former 100-digit tables generated by
+     * maxima (gauss_imp.hh, jacobi_1_0_imp.hh, jacobi_2_0_imp.hh), correctly
+     * rounded to double and printed with the shortest decimal representation
+     * that reads back to the same double.
+     */
+    const double gaussJacobiTable[ 3 ][ gaussJacobiTableSize*(gaussJacobiTableSize+1) ] = {
+      // alpha = 0 (Gauss-Legendre)
+      {
+        // 1 point
+        0.5, 1.0,
+        // 2 points
+        0.7886751345948129, 0.5,
+        0.2113248654051871, 0.5,
+        // 3 points
+        0.8872983346207417, 0.2777777777777778,
+        0.5, 0.4444444444444444,
+        0.11270166537925831, 0.2777777777777778,
+        // 4 points
+        0.9305681557970263, 0.17392742256872692,
+        0.6699905217924281, 0.32607257743127305,
+        0.33000947820757187, 0.32607257743127305,
+        0.06943184420297371, 0.17392742256872692,
+        // 5 points
+        0.953089922969332, 0.11846344252809454,
+        0.7692346550528415, 0.23931433524968324,
+        0.5, 0.28444444444444444,
+        0.23076534494715845, 0.23931433524968324,
+        0.046910077030668004, 0.11846344252809454,
+        // 6 points
+        0.966234757101576, 0.08566224618958518,
+        0.8306046932331322, 0.1803807865240693,
+        0.6193095930415985, 0.23395696728634552,
+        0.38069040695840156, 0.23395696728634552,
+        0.16939530676686773, 0.1803807865240693,
+        0.03376524289842399, 0.08566224618958518,
+        // 7 points
+        0.9745539561713793, 0.06474248308443485,
+        0.8707655927996972, 0.13985269574463832,
+        0.7029225756886985, 0.19091502525255946,
+        0.5, 0.2089795918367347,
+        0.2970774243113014, 0.19091502525255946,
+        0.12923440720030277, 0.13985269574463832,
+        0.025446043828620736, 0.06474248308443485,
+        // 8 points
+        0.9801449282487681, 0.05061426814518813,
+        0.8983332387068134, 0.11119051722668724,
+        0.7627662049581645, 0.15685332293894363,
+        0.591717321247825, 0.181341891689181,
+        0.4082826787521751, 0.181341891689181,
+        0.2372337950418355, 0.15685332293894363,
+        0.10166676129318664, 0.11119051722668724,
+        0.019855071751231884, 0.05061426814518813,
+        // 9 points
+        0.984080119753813, 0.040637194180787206,
+        0.9180155536633179, 0.0903240803474287,
+        0.8066857163502952, 0.13030534820146772,
+        0.6621267117019045, 0.15617353852000143,
+        0.5, 0.1651196775006299,
+        0.33787328829809554, 0.15617353852000143,
+        0.1933142836497048, 0.13030534820146772,
+        0.0819844463366821, 0.0903240803474287,
+        0.015919880246186954, 0.040637194180787206,
+        // 10 points
+        0.9869532642585859, 0.03333567215434407,
+        0.9325316833444922, 0.0747256745752903,
+        0.8397047841495122, 0.10954318125799102,
+        0.7166976970646236, 0.13463335965499817,
+        0.5744371694908156, 0.14776211235737644,
+        0.4255628305091844, 0.14776211235737644,
+        0.2833023029353764, 0.13463335965499817,
+        0.1602952158504878, 0.10954318125799102,
+        0.06746831665550775, 0.0747256745752903,
+        0.01304673574141414, 0.03333567215434407,
+        // 11 points
+        0.9891143290730285, 0.02783428355808683,
+        0.9435312998840476, 0.0627901847324523,
+        0.8650760027870247, 0.09314510546386713,
+        0.759548064603406, 0.11659688229599524,
+        0.6347715779761725, 0.13140227225512333,
+        0.5, 0.1364625433889503,
+        0.3652284220238275, 0.13140227225512333,
+        0.2404519353965941, 0.11659688229599524,
+        0.13492399721297535, 0.09314510546386713,
+        0.05646870011595235, 0.0627901847324523,
+        0.010885670926971503, 0.02783428355808683,
+        // 12 points
+        0.9907803171233597, 0.023587668193255914,
+        0.9520586281852375, 0.05346966299765921,
+        0.8849513370971523, 0.08003916427167311,
+        0.7936589771433087, 0.10158371336153296,
+        0.6839157494990901, 0.1167462682691774,
+        0.5626167042557345, 0.12457352290670139,
+        0.43738329574426554, 0.12457352290670139,
+        0.3160842505009099, 0.1167462682691774,
+        0.2063410228566913, 0.10158371336153296,
+        0.11504866290284765, 0.08003916427167311,
+        0.04794137181476257, 0.05346966299765921,
+        0.009219682876640375, 0.023587668193255914,
+        // 13 points
+        0.9920915273592941, 0.02024200238265794,
+        0.958799199611489, 0.046060749918864226,
+        0.9007890453666549, 0.06943675510989362,
+        0.8211746697201701, 0.08907299038097287,
+        0.7242463755182235, 0.10390802376844425,
+        0.6152291579775674, 0.11314159013144862,
+        0.5, 0.11627577661543695,
+        0.3847708420224326, 0.11314159013144862,
+        0.2757536244817766, 0.10390802376844425,
+        0.17882533027982989, 0.08907299038097287,
+        0.09921095463334505, 0.06943675510989362,
+        0.04120080038851102, 0.046060749918864226,
+        0.007908472640705926, 0.02024200238265794,
+        // 14 points
+        0.9931419043484062, 0.01755973016587593,
+        0.9642174418317867, 0.040079043579880104,
+        0.9136006575348825, 0.06075928534395159,
+        0.8436464524058427, 0.07860158357909677,
+        0.757624318179077, 0.09276919873896891,
+        0.6595561844639449, 0.1025992318606478,
+        0.5540274743536718, 0.1076319267315789,
+        0.44597252564632817, 0.1076319267315789,
+        0.3404438155360551, 0.1025992318606478,
+        0.24237568182092295, 0.09276919873896891,
+        0.15635354759415726, 0.07860158357909677,
+        0.0863993424651175, 0.06075928534395159,
+        0.03578255816821324, 0.040079043579880104,
+        0.006858095651593831, 0.01755973016587593,
+        // 15 points
+        0.9939962590102427, 0.015376620998058635,
+        0.968636696200353, 0.03518302374405406,
+        0.9241032917052137, 0.05357961023358597,
+        0.862208865680085, 0.06978533896307716,
+        0.7854860863042694, 0.08313460290849696,
+        0.6970756735387816, 0.0930805000077811,
+        0.6005970469987173, 0.09921574266355579,
+        0.5, 0.10128912096278064,
+        0.39940295300128276, 0.09921574266355579,
+        0.3029243264612183, 0.0930805000077811,
+        0.21451391369573058, 0.08313460290849696,
+        0.13779113431991497, 0.06978533896307716,
+        0.0758967082947864, 0.05357961023358597,
+        0.031363303799647045, 0.03518302374405406,
+        0.006003740989757286, 0.015376620998058635,
+        // 16 points
+        0.994700467495825, 0.013576229705877048,
+        0.9722875115366163, 0.031126761969323947,
+        0.9328156011939158, 0.04757925584124639,
+        0.8777022041775016, 0.06231448562776694,
+        0.8089381222013219, 0.07479799440828837,
+        0.7290083888286137, 0.08457825969750127,
+        0.6408017753896295, 0.09130170752246179,
+        0.5475062549188188, 0.09472530522753425,
+        0.4524937450811813, 0.09472530522753425,
+        0.35919822461037054, 0.09130170752246179,
+        0.2709916111713863, 0.08457825969750127,
+        0.19106187779867811, 0.07479799440828837,
+        0.12229779582249849, 0.06231448562776694,
+        0.06718439880608412, 0.04757925584124639,
+        0.02771248846338371, 0.031126761969323947,
+        0.005299532504175033, 0.013576229705877048,
+        // 17 points
+        0.9952877376572087, 0.012074151434273966,
+        0.9753377608843838, 0.0277297646869936,
+        0.9401195768634929, 0.04251807415858959,
+        0.8907570019484007, 0.055941923596701984,
+        0.8288355796083454, 0.06756818423426274,
+        0.7563452685432385, 0.07702288053840514,
+        0.6756158817269382, 0.08400205107822502,
+        0.5892420907479239, 0.08828135268349632,
+        0.5, 0.08972323517810327,
+        0.41075790925207606, 0.08828135268349632,
+        0.32438411827306185, 0.08400205107822502,
+        0.2436547314567615, 0.07702288053840514,
+        0.1711644203916546, 0.06756818423426274,
+        0.1092429980515993, 0.055941923596701984,
+        0.05988042313650705, 0.04251807415858959,
+        0.02466223911561612, 0.0277297646869936,
+        0.004712262342791332, 0.012074151434273966,
+        // 18 points
+        0.9957825842104655, 0.010808006763241656,
+        0.9779119747856989, 0.0248572744474849,
+        0.9463012332487779, 0.038212865127444526,
+        0.9018524794862616, 0.050471022053143584,
+        0.8458435215301766, 0.06127760335573923,
+        0.7798854155369738, 0.07032145733532533,
+        0.7058755807314213, 0.07734233756313262,
+        0.6259431128457528, 0.08213824187291636,
+        0.5423875065208676, 0.0845711914815718,
+        0.45761249347913235, 0.0845711914815718,
+        0.37405688715424723, 0.08213824187291636,
+        0.2941244192685787, 0.07734233756313262,
+        0.22011458446302623, 0.07032145733532533,
+        0.1541564784698234, 0.06127760335573923,
+        0.09814752051373844, 0.050471022053143584,
+        0.05369876675122213, 0.038212865127444526,
+        0.022088025214301123, 0.0248572744474849,
+        0.004217415789534527, 0.010808006763241656,
+        // 19 points
+        0.9962034219217922, 0.009730894114863239,
+        0.980104076067415, 0.0224071133828498,
+        0.951577951807409, 0.03452227136882061,
+        0.9113573282685714, 0.045745010811225,
+        0.8604830886676147, 0.055783322773666995,
+        0.8002726523308406, 0.06437698126966811,
+        0.7322853706879805, 0.0713033510868033,
+        0.6582820499818149, 0.07638302103292983,
+        0.5801793228201126, 0.07948442169697717,
+        0.5, 0.08052722492439185,
+        0.4198206771798873, 0.07948442169697717,
+        0.34171795001818506, 0.07638302103292983,
+        0.2677146293120195, 0.0713033510868033,
+        0.19972734766915948, 0.06437698126966811,
+        0.1395169113323853, 0.055783322773666995,
+        0.08864267173142859, 0.045745010811225,
+        0.04842204819259105, 0.03452227136882061,
+        0.019895923932584984, 0.0224071133828498,
+        0.0037965780782077984, 0.009730894114863239,
+        // 20 points
+        0.9965642995925474, 0.008807003569576059,
+        0.9819859636389568, 0.02030071490019347,
+        0.956117214125663, 0.031336024167054534,
+        0.9195584859111094, 0.04163837078835238,
+        0.8731659532300754, 0.05096505990862022,
+        0.8180268403632576, 0.059097265980759206,
+        0.7554335009754135, 0.06584431922458832,
+        0.6868530443577098, 0.07104805465919102,
+        0.6138929255708225, 0.07458649323630187,
+        0.5382632605667487, 0.07637669356536292,
+        0.46173673943325133, 0.07637669356536292,
+        0.38610707442917747, 0.07458649323630187,
+        0.3131469556422902, 0.07104805465919102,
+        0.24456649902458646, 0.06584431922458832,
+        0.1819731596367425, 0.059097265980759206,
+        0.1268340467699246, 0.05096505990862022,
+        0.0804415140888906, 0.04163837078835238,
+        0.04388278587433705, 0.031336024167054534,
+        0.018014036361043106, 0.02030071490019347,
+        0.0034357004074525377, 0.008807003569576059,
+        // 21 points
+        0.9968760853101948, 0.008008614128887167,
+        0.9836134192831532, 0.018476894885426247,
+        0.9600496670752005, 0.028567212713428602,
+        0.9266816822916586, 0.03805005681418965,
+        0.884219981737839, 0.04672221172801693,
+        0.8335694020987061, 0.05439864958357419,
+        0.7758094179436099, 0.06091570802686427,
+        0.7121710601037194, 0.06613446931666873,
+        0.6440106584012005, 0.06994369739553657,
+        0.5727809270804476, 0.07226220199498502,
+        0.5, 0.07304056682484521,
+        0.42721907291955247, 0.07226220199498502,
+        0.35598934159879947, 0.06994369739553657,
+        0.2878289398962806, 0.06613446931666873,
+        0.2241905820563901, 0.06091570802686427,
+        0.16643059790129383, 0.05439864958357419,
+        0.11578001826216104, 0.04672221172801693,
+        0.07331831770834135, 0.03805005681418965,
+        0.03995033292479958, 0.028567212713428602,
+        0.016386580716846854, 0.018476894885426247,
+        0.00312391468980525, 0.008008614128887167,
+        // 22 points
+        0.9971472927411996, 0.0073139976491361,
+        0.9850302489177144, 0.016887450792407076,
+        0.963478386093587, 0.026146667576341643,
+        0.93290628886015, 0.034898234212260244,
+        0.8939084029896041, 0.042970803108533864,
+        0.8472436315933414, 0.05020707222144048,
+        0.7938202017534558, 0.05646614804026961,
+        0.7346779189933785, 0.06162618840525621,
+        0.6709679104460421, 0.06558675239353119,
+        0.6039302133441107, 0.06827074917300759,
+        0.5348696366598611, 0.06962593642781599,
+        0.4651303633401389, 0.06962593642781599,
+        0.3960697866558894, 0.06827074917300759,
+        0.3290320895539579, 0.06558675239353119,
+        0.26532208100662147, 0.06162618840525621,
+        0.2061797982465442, 0.05646614804026961,
+        0.1527563684066586, 0.05020707222144048,
+        0.10609159701039592, 0.042970803108533864,
+        0.06709371113984994, 0.034898234212260244,
+        0.036521613906413, 0.026146667576341643,
+        0.014969751082285637, 0.016887450792407076,
+        0.002852707258800354, 0.0073139976491361,
+        // 23 points
+        0.9973846674987761, 0.006705929743570886,
+        0.9862712356090576, 0.015494002928489722,
+        0.9664855434130081, 0.024018835865542335,
+        0.9383761791352209, 0.032116210704262925,
+        0.9024442008094199, 0.039640705888359475,
+        0.8593306815659751, 0.04645788303001758,
+        0.8098049378818231, 0.052446045732270706,
+        0.7547507389230038, 0.05749832011120568,
+        0.6951505190151455, 0.06152454215336477,
+        0.6320678404851725, 0.06445286109404108,
+        0.5666284121492331, 0.0662310197023483,
+        0.5, 0.06682728609305309,
+        0.43337158785076696, 0.0662310197023483,
+        0.36793215951482755, 0.06445286109404108,
+        0.3048494809848546, 0.06152454215336477,
+        0.24524926107699624, 0.05749832011120568,
+        0.1901950621181769, 0.052446045732270706,
+        0.14066931843402491, 0.04645788303001758,
+        0.09755579919058005, 0.039640705888359475,
+        0.06162382086477917, 0.032116210704262925,
+        0.033514456586991946, 0.024018835865542335,
+        0.013728764390942384, 0.015494002928489722,
+        0.0026153325012239384, 0.006705929743570886,
+        // 24 points
+        0.9975936099985107, 0.0061706148999936,
+        0.9873642779856547, 0.014265694314466832,
+        0.9691372760013663, 0.022138719408709904,
+        0.9432077635022005, 0.02964929245771839,
+        0.9100009929869515, 0.03667324070554015,
+        0.8700620957892772, 0.04309508076597664,
+        0.8240468259684878, 0.04880932605205694,
+        0.7727107356944197, 0.05372213505798282,
+        0.7168967538130225, 0.0577528340268628,
+        0.6575213398480817, 0.060835236463901696,
+        0.5955594337368082, 0.06291872817341415,
+        0.5320284464313028, 0.06396909767337608,
+        0.4679715535686972, 0.06396909767337608,
+        0.40444056626319186, 0.06291872817341415,
+        0.3424786601519183, 0.060835236463901696,
+        0.2831032461869774, 0.0577528340268628,
+        0.22728926430558022, 0.05372213505798282,
+        0.17595317403151223, 0.04880932605205694,
+        0.12993790421072282, 0.04309508076597664,
+        0.08999900701304854, 0.03667324070554015,
+        0.056792236497799485, 0.02964929245771839,
+        0.030862723998633622, 0.022138719408709904,
+        0.012635722014345251, 0.014265694314466832,
+        0.00240639000148932, 0.0061706148999936,
+        // 25 points
+        0.997778484895249, 0.005696899250513144,
+        0.9883319607297587, 0.013177493307516068,
+        0.9714872856144872, 0.020469578350653158,
+        0.9474959989391377, 0.027452347987917597,
+        0.916721314380417, 0.034019166906178455,
+        0.8796296315186788, 0.04007035016750051,
+        0.8367831842367341, 0.04551413099148183,
+        0.7888314651206115, 0.05026797453352532,
+        0.7365013657228575, 0.054259812237131826,
+        0.6805861529046939, 0.05742912957285582,
+        0.6219334418604943, 0.059727881767892385,
+        0.5614323463053552, 0.06112122149515502,
+        0.5, 0.06158802686335772,
+        0.4385676536946448, 0.06112122149515502,
+        0.3780665581395058, 0.059727881767892385,
+        0.31941384709530607, 0.05742912957285582,
+        0.26349863427714254, 0.054259812237131826,
+        0.21116853487938853, 0.05026797453352532,
+        0.16321681576326583, 0.04551413099148183,
+        0.12037036848132118, 0.04007035016750051,
+        0.083278685619583, 0.034019166906178455,
+        0.05250400106086232, 0.027452347987917597,
+        0.02851271438551283, 0.020469578350653158,
+        0.011668039270241244, 0.013177493307516068,
+        0.002221515104750951, 0.005696899250513144,
+        // 26 points
+        0.9979428505728085, 0.005275686308671503,
+        0.9891927229782355, 0.012208925546315955,
+        0.9735795333308571, 0.018981191647181383,
+        0.9513189309921536, 0.025487912648573904,
+        0.922722971394249, 0.03163702316478742,
+        0.8881929744103394, 0.037342074882829875,
+        0.8482136302099786, 0.04252294715674262,
+        0.803346146508809, 0.04710690017795707,
+        0.7542203574122529, 0.05102958054721271,
+        0.7015258775617431, 0.05423592026428829,
+        0.6460024197429785, 0.05668090827315983,
+        0.5884294101784451, 0.05833022174264829,
+        0.5296150467146566, 0.05916070763963114,
+        0.4703849532853434, 0.05916070763963114,
+        0.4115705898215549, 0.05833022174264829,
+        0.35399758025702155, 0.05668090827315983,
+        0.29847412243825683, 0.05423592026428829,
+        0.24577964258774715, 0.05102958054721271,
+        0.19665385349119097, 0.04710690017795707,
+        0.15178636979002136, 0.04252294715674262,
+        0.11180702558966057, 0.037342074882829875,
+        0.07727702860575099, 0.03163702316478742,
+        0.04868106900784646, 0.025487912648573904,
+        0.026420466669142877, 0.018981191647181383,
+        0.010807277021764504, 0.012208925546315955,
+        0.0020571494271915355, 0.005275686308671503,
+        // 27 points
+        0.9980896314444943, 0.00489949802564718,
+        0.9899617379807506, 0.011343115798090312,
+        0.9754502789073525, 0.017648526878709856,
+        0.9547411603387456, 0.02372470626030753,
+        0.9281039540091472, 0.029491768429916798,
+        0.8958858195352541, 0.0348744118831228,
+        0.8585067368697118, 0.03980243388652888,
+        0.8164539859732476, 0.04421157927187847,
+        0.7702757822897285, 0.04804436368501425,
+        0.7205741258750135, 0.0512508189088729,
+        0.6679969518192544, 0.053789142894266596,
+        0.6132296827197684, 0.055626244178422594,
+        0.556986292804765, 0.056738173054482574,
+        0.5, 0.0571104336894785,
+        0.44301370719523503, 0.056738173054482574,
+        0.3867703172802316, 0.055626244178422594,
+        0.33200304818074555, 0.053789142894266596,
+        0.27942587412498654, 0.0512508189088729,
+        0.22972421771027154, 0.04804436368501425,
+        0.18354601402675244, 0.04421157927187847,
+        0.14149326313028815, 0.03980243388652888,
+        0.10411418046474588, 0.0348744118831228,
+        0.07189604599085275, 0.029491768429916798,
+        0.04525883966125445, 0.02372470626030753,
+        0.024549721092647497, 0.017648526878709856,
+        0.010038262019249388, 0.011343115798090312,
+        0.0019103685555057165, 0.00489949802564718,
+        // 28 points
+        0.9982212487869773, 0.0045621412965472586,
+        0.9906515826854364, 0.01056605629638563,
+        0.9771296403144691, 0.01645071389115219,
+        0.9578165131960661, 0.022136467379502114,
+        0.9329462612871975, 0.027553672837858374,
+        0.9028206854585896, 0.0326364619834998,
+        0.8678054390068158, 0.03732310711728439,
+        0.8283255470194325, 0.041556708614450606,
+        0.7848602359057009, 0.04528587219651642,
+        0.7379371124775591, 0.04846532899896496,
+        0.6881257580445393, 0.05105648378903038,
+        0.6360308138175891, 0.05302788296142321,
+        0.5822846410666904, 0.05435559612914707,
+        0.5275396449420171, 0.0550235065082376,
+        0.47246035505798284, 0.0550235065082376,
+        0.41771535893330963, 0.05435559612914707,
+        0.363969186182411, 0.05302788296142321,
+        0.31187424195546065, 0.05105648378903038,
+        0.2620628875224409, 0.04846532899896496,
+        0.21513976409429914, 0.04528587219651642,
+        0.17167445298056752, 0.041556708614450606,
+        0.1321945609931841, 0.03732310711728439,
+        0.09717931454141042, 0.0326364619834998,
+        0.06705373871280247, 0.027553672837858374,
+        0.04218348680393396, 0.022136467379502114,
+        0.022870359685530903, 0.01645071389115219,
+        0.009348417314563623, 0.01056605629638563,
+        0.001778751213022775, 0.0045621412965472586,
+        // 29 points
+        0.9983397211302983, 0.004258451939373205,
+        0.9912727526307066, 0.009866042528061354,
+        0.9786427978890438, 0.015370246101046812,
+        0.9605901164765294, 0.020701031259341418,
+        0.9373189024600513, 0.025797413451248963,
+        0.9090927438076262, 0.030601545328539568,
+        0.8762314258672386, 0.03505896662752564,
+        0.8391072688013432, 0.03911916356788189,
+        0.798140898569114, 0.042736128683086266,
+        0.7537964775621139, 0.04586887856962938,
+        0.7065764440870044, 0.0484819170472043,
+        0.65701581893382, 0.05054563687995748,
+        0.6056761430830006, 0.05203665503886469,
+        0.5531391150663396, 0.05293807754866047,
+        0.5, 0.05323969085915712,
+        0.4468608849336604, 0.05293807754866047,
+        0.39432385691699945, 0.05203665503886469,
+        0.34298418106618, 0.05054563687995748,
+        0.2934235559129957, 0.0484819170472043,
+        0.24620352243788618, 0.04586887856962938,
+        0.2018591014308861, 0.042736128683086266,
+        0.16089273119865674, 0.03911916356788189,
+        0.12376857413276143, 0.03505896662752564,
+        0.09090725619237378, 0.030601545328539568,
+        0.0626810975399486, 0.025797413451248963,
+        0.03940988352347061, 0.020701031259341418,
+        0.021357202110956135, 0.015370246101046812,
+        0.008727247369293412, 0.009866042528061354,
+        0.001660278869701707, 0.004258451939373205,
+        // 30 points
+        0.9984467420373248, 0.0039840962480833025,
+        0.9918340616398736, 0.00923323415554548,
+        0.9800109324841537, 0.014392353941661684,
+        0.9631000237146372, 0.019399596284813525,
+        0.9412802678960264, 0.024201336415297026,
+        0.9147828811913842, 0.028746578108809533,
+        0.8838887160524131, 0.032987114941090245,
+        0.8489252473966579, 0.0368779873688526,
+        0.8102630914946214, 0.04037794761471011,
+        0.76831207407101, 0.04344989360054149,
+        0.7235168847690446, 0.04606126111889306,
+        0.6763523627654391, 0.04818436858732213,
+        0.6273184630839449, 0.049796710293397634,
+        0.5769349568042917, 0.05088119487420275,
+        0.5257359212776589, 0.05142632644677942,
+        0.47426407872234116, 0.05142632644677942,
+        0.4230650431957082, 0.05088119487420275,
+        0.3726815369160551, 0.049796710293397634,
+        0.32364763723456097, 0.04818436858732213,
+        0.2764831152309554, 0.04606126111889306,
+        0.23168792592899004, 0.04344989360054149,
+        0.18973690850537858, 0.04037794761471011,
+        0.1510747526033421, 0.0368779873688526,
+        0.11611128394758691, 0.032987114941090245,
+        0.08521711880861581, 0.028746578108809533,
+        0.05871973210397366, 0.024201336415297026,
+        0.03689997628536284, 0.019399596284813525,
+        0.019989067515846243, 0.014392353941661684,
+        0.008165938360126395, 0.00923323415554548,
+        0.0015532579626752298, 0.0039840962480833025,
+        // 31 points
+        0.9985437409097385, 0.0037354157896243878,
+        0.9923429548325763, 0.008659310395155292,
+        0.9812519625464748, 0.013504509592489711,
+        0.9653784989483241, 0.018216136956192733,
+        0.9448800149741355, 0.022746853763600552,
+        0.9199601600731336, 0.027051541212458428,
+        0.8908665742083125, 0.031087393280514214,
+        0.8578883922934266, 0.03481429161770518,
+        0.8213533614621302, 0.03819519329938831,
+        0.7816245807035747, 0.04119649588079463,
+        0.7390968910224512, 0.04378837030423894,
+        0.6941929508041165, 0.04594505694682074,
+        0.6473590349908508, 0.047645121456159754,
+        0.5990605996677854, 0.04887166769316436,
+        0.5497776560761708, 0.049612505613336154,
+        0.5, 0.04986027239671323,
+        0.45022234392382926, 0.049612505613336154,
+        0.4009394003322147, 0.04887166769316436,
+        0.3526409650091492, 0.047645121456159754,
+        0.30580704919588353, 0.04594505694682074,
+        0.26090310897754876, 0.04378837030423894,
+        0.21837541929642537, 0.04119649588079463,
+        0.17864663853786983, 0.03819519329938831,
+        0.14211160770657336, 0.03481429161770518,
+        0.10913342579168753, 0.031087393280514214,
+        0.08003983992686634, 0.027051541212458428,
+        0.05511998502586448, 0.022746853763600552,
+        0.03462150105167592, 0.018216136956192733,
+        0.018748037453525167, 0.013504509592489711,
+        0.007657045167423758, 0.008659310395155292,
+        0.001456259090261463, 0.0037354157896243878
+      },
+      // alpha = 1
+      {
+        // 1 point
+        0.3333333333333333, 1.0,
+        // 2 points
+        0.6449489742783178, 0.36391723651204566,
+        0.1550510257216822, 0.6360827634879543,
+        // 3 points
+        0.787659461760847, 0.13965395980290823,
+        0.4094668644407347, 0.4584822127191725,
+        0.08858795951270394, 0.40186382747791927,
+        // 4 points
+        0.8602401356562195, 0.06236194190001616,
+        0.5835904323689168, 0.2596950952164649,
+        0.2768430136381238, 0.4069291360205427,
+        0.05710419611451768, 0.27101382686297626,
+        // 5 points
+        0.9014649142011736, 0.03149582904338455,
+        0.6954642733536361, 0.14781774014523333,
+        0.43797481024738616, 0.2927739741693396,
+        0.19801341787360818, 0.3343492761887391,
+        0.03980985705146874, 0.19356318045330337,
+        // 6 points
+        0.9269456713197411, 0.017476603627219065,
+        0.7692338620300545, 0.08791033110101795,
+        0.5586715187715501, 0.19732230178131052,
+        0.3369846902811543, 0.2815851075763979,
+        0.1480785996684843, 0.27108499446303724,
+        0.029316427159784893, 0.14462066145101737,
+        // 7 points
+        0.9437374394630779, 0.010428724405614808,
+        0.8197593082631076, 0.05481671344374695,
+        0.6473752828868303, 0.13276939293098294,
+        0.45284637366944464, 0.21425013139174734,
+        0.26578982278458946, 0.25478179459917666,
+        0.11467905316090424, 0.2210185163817492,
+        0.022479386438712497, 0.11193472684698211,
+        // 8 points
+        0.9553660447100302, 0.006590382884497598,
+        0.8556337429578544, 0.035685805311972414,
+        0.7131752428555694, 0.0908786390093978,
+        0.5451866848034267, 0.1583991989846383,
+        0.37193216458327233, 0.21209471887186002,
+        0.21430847939563075, 0.22501159894177472,
+        0.09132360789979396, 0.18223804727274726,
+        0.01777991514736345, 0.08910160872311186,
+        // 9 points
+        0.9637421871167905, 0.004361694171546262,
+        0.8819210212100013, 0.024120008569570757,
+        0.7628230151850396, 0.063609642982108,
+        0.618117234695294, 0.11680239059033022,
+        0.46197040108101095, 0.1687166436898407,
+        0.3096675799276378, 0.20061761838673658,
+        0.1761166561629953, 0.1970674843446914,
+        0.07438738970919605, 0.15214851021861633,
+        0.014412409648876549, 0.07255600704655975,
+        // 10 points
+        0.9699709678385136, 0.002998281204812788,
+        0.9017109877901468, 0.016838639565966373,
+        0.8009789210368988, 0.04554918290652606,
+        0.6759444616766651, 0.08680381281430125,
+        0.5367387657156606, 0.13210615112670077,
+        0.39463984688578685, 0.16911421938165466,
+        0.26115967600845624, 0.18539378735544684,
+        0.14711144964307024, 0.17242260057835207,
+        0.061732071877148124, 0.12857430901816513,
+        0.011917613432415597, 0.060199016048074046,
+        // 11 points
+        0.9747263796024797, 0.002127334586489083,
+        0.9169583865525949, 0.012087841920959552,
+        0.8308248996228186, 0.033327246903361384,
+        0.722203284890968, 0.0652830934276667,
+        0.5984972797671392, 0.10318272134459516,
+        0.468137613089584, 0.13906375031636609,
+        0.3400081579146652, 0.16375820597612695,
+        0.22284060704383785, 0.16931884576803524,
+        0.12461922514444307, 0.151240096114374,
+        0.052035451127180554, 0.109876182265743,
+        0.010018280461680407, 0.050734681376282856,
+        // 12 points
+        0.9784379368341496, 0.0015503644418760566,
+        0.928942101264411, 0.008889615591336924,
+        0.8545525437649358, 0.024872018332844532,
+        0.759598889525227, 0.04975356081853086,
+        0.649600650277255, 0.08090330741382723,
+        0.5309508493128177, 0.11322768742733526,
+        0.41054508120145766, 0.1402186799952602,
+        0.29538088426258025, 0.15539263363106207,
+        0.19215105452985404, 0.153793205360082,
+        0.10685449088347666, 0.13321350125334638,
+        0.04444646315540772, 0.09485570396075493,
+        0.008539054988427419, 0.043329721773743536,
+        // 13 points
+        0.9813896349890121, 0.0011561134098723857,
+        0.938524459100731, 0.006676718501547544,
+        0.8736948213066894, 0.0188978489591855,
+        0.7901570282734375, 0.03842791432943964,
+        0.6921010017196016, 0.0638735743244063,
+        0.5844439640213405, 0.09199156135210479,
+        0.47258438600411773, 0.11824096262818465,
+        0.3621313972822388, 0.13763105897513084,
+        0.2586235407057625, 0.14569939303163645,
+        0.16725101139155774, 0.13942693656428878,
+        0.09259522469900264, 0.11790787591329417,
+        0.03839813873967835, 0.0826405788396786,
+        0.0073646510260893215, 0.03742946317123035,
+        // 14 points
+        0.9837752340986002, 0.0008794274174943185,
+        0.9463027000602754, 0.005108202635375308,
+        0.8893428088195156, 0.014592968266425243,
+        0.8153897394434746, 0.030064607487857286,
+        0.7276764528892646, 0.050846930814297524,
+        0.6300366883704039, 0.07488619291797165,
+        0.526737861339873, 0.09903890904640601,
+        0.42229465730757026, 0.11957111804506317,
+        0.32127174398893615, 0.13278470125217084,
+        0.228084270649258, 0.13566331920836566,
+        0.14680486768121373, 0.1264260511486584,
+        0.08098549968195519, 0.1048919070038335,
+        0.03350140453201314, 0.07259215611088739,
+        0.006416760792818457, 0.03265350864519368,
+        // 15 points
+        0.9857305452631743, 0.0006806847682757921,
+        0.9527004099058333, 0.0039724693862900765,
+        0.902286700679378, 0.011434444789442352,
+        0.8364309606056102, 0.023808380710195157,
+        0.7576647390313427, 0.040832618545239674,
+        0.6690151950299599, 0.061219539172937085,
+        0.5738891609066858, 0.08280147036884515,
+        0.4759423084632349, 0.10282472462377294,
+        0.37893868864697805, 0.11834838411942586,
+        0.28660608625752704, 0.1266879103230228,
+        0.20249275505010406, 0.12583621329719383,
+        0.12983102555359105, 0.11479765101388258,
+        0.07141295311515884, 0.09378327988811985,
+        0.029482298647942485, 0.06423808974993184,
+        0.00564068897251171, 0.028734139243425046,
+        // 16 points
+        0.9873530206260416, 0.0005349873301110724,
+        0.9580244176904754, 0.0031343769471916393,
+        0.9131083765371413, 0.00907846477227727,
+        0.8541381477752107, 0.019068335769331875,
+        0.7831225539648681, 0.03307916871127159,
+        0.702480137925041, 0.05031846621294008,
+        0.6149571518764895, 0.0692956331585716,
+        0.5235341160251683, 0.08799476437848784,
+        0.4313243435956254, 0.10412827568761317,
+        0.34146792754782307, 0.11543775921853565,
+        0.25702480784517084, 0.12000170977622701,
+        0.18087055965788368, 0.11650848041971167,
+        0.11559843757981594, 0.1044571888079183,
+        0.06343094558383675, 0.08425886231485658,
+        0.026143513681394052, 0.0572249051802863,
+        0.004997299663771921, 0.02547862131466837,
+        // 17 points
+        0.9887140406322438, 0.00042623257841386717,
+        0.9625011978233501, 0.0025053668787824415,
+        0.9222430345922984, 0.007294460966842813,
+        0.8691660595674137, 0.015432844429611877,
+        0.8048835785249665, 0.027027394904601564,
+        0.7313489527340514, 0.041606556020590726,
+        0.6507965584533822, 0.0581490481754101,
+        0.5656739668866343, 0.07518465097422447,
+        0.4785675968530796, 0.09095558079828456,
+        0.3921241347220957, 0.10361948385859267,
+        0.3089701177521959, 0.1114698358471211,
+        0.23163212577717218, 0.11314722276494303,
+        0.16246000342813655, 0.10781586333505495,
+        0.10355543293519706, 0.09528373874923689,
+        0.056707968769078236, 0.0760514576514848,
+        0.023340094123774274, 0.05128485584041036,
+        0.004457993567787392, 0.02274540622639379,
+        // 18 points
+        0.9898668482025972, 0.00034373816819639177,
+        0.9663007519456326, 0.0020260503586020944,
+        0.9300208896996932, 0.005924886128865675,
+        0.8820198253620791, 0.012612077764761068,
+        0.8236074297748696, 0.022263740194818724,
+        0.7563771934061506, 0.03461660096179858,
+        0.6821630391136516, 0.048975180002583434,
+        0.6029893605598321, 0.0642696122552571,
+        0.5210158208707761, 0.07915832457721576,
+        0.43847844922413814, 0.09216480198048256,
+        0.3576286499766346, 0.10183385771274818,
+        0.2806717900601717, 0.10689057560562805,
+        0.20970703958884296, 0.10638466926367132,
+        0.14667010367761796, 0.09980445383540543,
+        0.09328039592854495, 0.08714781414928617,
+        0.05099404158789055, 0.06894223784384405,
+        0.02096364839376648, 0.04621270032675413,
+        0.004001479383867387, 0.020428678870081266,
+        // 19 points
+        0.9908518052709557, 0.00028025518835677265,
+        0.9695526370802209, 0.0016557615218479643,
+        0.9366958480743651, 0.0048601834240865616,
+        0.893093134981845, 0.01039956265655676,
+        0.8398186157087111, 0.018482183858633195,
+        0.7781842229767616, 0.02897969422421945,
+        0.7097076516539024, 0.04142334512551561,
+        0.6360750448792709, 0.05503611628869596,
+        0.559099492649032, 0.06879791590381479,
+        0.4806763935785519, 0.08153774174367337,
+        0.4027367861650771, 0.09204397143227683,
+        0.3271998007638117, 0.09918209293741316,
+        0.25592540348210296, 0.1020083732534388,
+        0.19066859490476334, 0.09986827648083876,
+        0.1330361885580988, 0.09246985633715682,
+        0.08444722278420982, 0.07992474009798349,
+        0.046097933048431086, 0.0627525505714658,
+        0.018931837031588218, 0.04184930350395978,
+        0.003611642818556893, 0.018448075450066152,
+        // 20 points
+        0.9916999557929327, 0.00023076381435137058,
+        0.9723569466474369, 0.0013661245521718439,
+        0.9424655423631864, 0.004022915227928156,
+        0.9026958717934537, 0.008646438225380306,
+        0.8539367530358905, 0.015455335860102925,
+        0.7972775083365947, 0.024408092253360207,
+        0.7339838582356595, 0.03519413375841203,
+        0.6654696989055137, 0.04725059234709779,
+        0.5932655334835065, 0.05980348368525803,
+        0.5189842887035737, 0.0719298383077255,
+        0.4442852869630112, 0.08263541363333148,
+        0.3708371805843969, 0.09094117788270695,
+        0.30028067683595017, 0.09597092321988783,
+        0.2341918863135922, 0.09703221011970818,
+        0.17404711263554218, 0.09368338372511566,
+        0.12118986732367606, 0.0857805916759564,
+        0.07680083708962197, 0.07350047967329572,
+        0.041871431117765194, 0.057336474758261195,
+        0.017181218145255715, 0.03806993892740333,
+        0.003276106669050099, 0.016741688352545112,
+        // 21 points
+        0.9924354907256214, 0.00019172373705944365,
+        0.9747919756603657, 0.0011369970533995283,
+        0.9474855444063973, 0.003357512043133831,
+        0.9110742658026157, 0.00724410573948988,
+        0.8662997589709566, 0.01301319484729121,
+        0.8140736165126974, 0.020678419515940627,
+        0.755459054449687, 0.03003974522638557,
+        0.6916493150129622, 0.04069109877964302,
+        0.6239433897212819, 0.05204609359179111,
+        0.5537195807282936, 0.06337990610025468,
+        0.4824074446124389, 0.07388402529699876,
+        0.4114586915619052, 0.08272952079399523,
+        0.3423176329587308, 0.08913374937230921,
+        0.27639177909378315, 0.09242510522204482,
+        0.21502318535802029, 0.092100541446515,
+        0.15946112944406526, 0.08787114127030075,
+        0.1108366733203635, 0.07969195514279794,
+        0.0701396190623258, 0.06777358068880635,
+        0.038198288245073556, 0.05257452016640661,
+        0.015662280557573547, 0.03477585215239003,
+        0.0029852372832130628, 0.015261211813046379,
+        // 22 points
+        0.9930774850443482, 0.00016059643387490163,
+        0.9769196632371289, 0.0009538558113180135,
+        0.9518795932297199, 0.0028235337062788484,
+        0.9184257249898493, 0.0061124282263008076,
+        0.87718159746542, 0.011027750204255282,
+        0.8289156136217265, 0.017617344880221816,
+        0.7745269160648226, 0.02575846056273068,
+        0.7150286804747624, 0.035160035120304585,
+        0.6515292548958145, 0.04537845719632199,
+        0.5852115179512991, 0.055845741646885265,
+        0.5173108459509911, 0.06590811757077107,
+        0.44909210098681734, 0.07487223293386004,
+        0.3818260692567502, 0.0820555915638818,
+        0.31676578871044725, 0.08683750029083566,
+        0.25512320697168694, 0.08870674180083961,
+        0.19804660411818262, 0.08730240757260693,
+        0.14659920015766542, 0.0824448098128229,
+        0.10173934345216393, 0.07415410818640573,
+        0.06430264113215889, 0.06265519399875046,
+        0.03498632835121645, 0.048368473343781,
+        0.014335933483699706, 0.03188810690955699,
+        0.0027314460088842295, 0.013968512227395627,
+        // 23 points
+        0.9936411423413659, 0.00013553408563029976,
+        0.9787895175170725, 0.0008060783183419482,
+        0.9557470550763801, 0.0023911649934135358,
+        0.9249098542075925, 0.005191620446910721,
+        0.8868058750607934, 0.009401868666227654,
+        0.8420871815760148, 0.015090083903947555,
+        0.7915189583921992, 0.02218746826207121,
+        0.7359664575449969, 0.03048748451352573,
+        0.6763802055359521, 0.03965518934812491,
+        0.6137797438222284, 0.0492461120626532,
+        0.5492361859337144, 0.058733459668941806,
+        0.4838538912019968, 0.06754184722435728,
+        0.41875156920453116, 0.07508529186083901,
+        0.3550431384266733, 0.08080690215257659,
+        0.2938186667005872, 0.08421756232457495,
+        0.23612571946996597, 0.08493096269792265,
+        0.18295143477620673, 0.08269256057546194,
+        0.13520563098638086, 0.07740045437700328,
+        0.09370523422563984, 0.06911669325016076,
+        0.059160284613890765, 0.05806819763322012,
+        0.03216172768263549, 0.04463725220786037,
+        0.013170985000368889, 0.02934304620092188,
+        0.0025086896389827445, 0.012833165225312597,
+        // 24 points
+        0.9941387002099848, 0.00011517301504794584,
+        0.9804414867720773, 0.000685792380690194,
+        0.9591684333956145, 0.00203815713912692,
+        0.9306567200768073, 0.004436613641500169,
+        0.895356294621761, 0.008061266812448582,
+        0.8538239525472524, 0.01299144166781244,
+        0.8067147162308662, 0.01919585570453531,
+        0.7547715409190972, 0.0265301923014002,
+        0.6988136087122555, 0.03474229649484084,
+        0.6397234134973043, 0.04348472766572341,
+        0.5784328451129381, 0.05233393229745876,
+        0.515908493620298, 0.0608148740330323,
+        0.4531364059378609, 0.06842960472039025,
+        0.39110653542718576, 0.07468800138191238,
+        0.3307971297342993, 0.07913874651520938,
+        0.2731593030949705, 0.08139860229396258,
+        0.2191020363269966, 0.08117812499761112,
+        0.1694778408374138, 0.078302178644712,
+        0.12506931209983138, 0.07272392358209172,
+        0.08657678275502653, 0.06453135870842411,
+        0.05460726328354278, 0.05394596868921663,
+        0.029664814214068847, 0.04131359852028912,
+        0.012142303771074897, 0.027088908241430266,
+        0.0023121076177984915, 0.011830660551133368,
+        // 25 points
+        0.9945800980399754, 9.849406172470012e-05,
+        0.9819080873346961, 0.0005870930138403858,
+        0.9622094865907312, 0.0017477203242162495,
+        0.9357731085313031, 0.0038130962814205208,
+        0.9029847330954238, 0.006948690769948243,
+        0.8643225686575713, 0.011238939421764729,
+        0.8203504266385679, 0.016678447464177036,
+        0.7717095332090876, 0.023168745974481427,
+        0.7191091887702756, 0.030520840608464907,
+        0.6633164283801916, 0.03846345091061473,
+        0.6051448381551349, 0.04665650137559238,
+        0.5454426920332588, 0.054709113379930174,
+        0.4850805823554159, 0.06220107820158806,
+        0.4249387248171482, 0.06870658133314383,
+        0.365894122984637, 0.07381880949267258,
+        0.3088077795622951, 0.07717401233298538,
+        0.2545121408770103, 0.07847361442854744,
+        0.20379895758313782, 0.0775030784648953,
+        0.15740773838866595, 0.07414640177550565,
+        0.11601496458748702, 0.06839537544316109,
+        0.08022422091233478, 0.06035303547197594,
+        0.050557380369212625, 0.050231079775796245,
+        0.027446943464319775, 0.038341446674833767,
+        0.01122946060565249, 0.025083277227021077,
+        0.002137754840779325, 0.010941075791698132,
+        // 26 points
+        0.9949734758572125, 8.472664822184481e-05,
+        0.9832159998661838, 0.0005055010659316268,
+        0.9649243392355685, 0.0015070512700602152,
+        0.9403473057218672, 0.0032947018344271508,
+        0.9098175190772665, 0.006019673135257074,
+        0.8737479163770056, 0.00976757724698835,
+        0.8326263048793097, 0.0145506577774056,
+        0.7870087961593148, 0.02030423177222358,
+        0.7375122949172582, 0.026887564422585945,
+        0.6848061597563768, 0.03408916470242993,
+        0.6296031526463668, 0.04163624742448221,
+        0.5726498006750369, 0.04920787783957516,
+        0.514716300858142, 0.05645111126600676,
+        0.4565861046963798, 0.062999273375648,
+        0.39904532340024124, 0.06849140575169568,
+        0.3428720970842849, 0.07259183277120186,
+        0.2888260716927312, 0.07500879353237673,
+        0.23763812593281705, 0.07551112719749782,
+        0.19000048705998282, 0.07394209946166916,
+        0.14655736897811106, 0.07022960671117587,
+        0.10789625871486705, 0.06439218521754601,
+        0.07453996747497746, 0.056540476704254085,
+        0.0469395479727239, 0.046874054295514264,
+        0.025468147750456013, 0.03567383035949472,
+        0.010415712035092527, 0.023291144014004343,
+        0.001982402312500992, 0.010148084202326,
+        // 27 points
+        0.9953255513271093, 7.328186742973457e-05,
+        0.9843872802327865, 0.00043758356959546944,
+        0.9673578569938135, 0.0013062911624820413,
+        0.9444527826987508, 0.002860989938171969,
+        0.9159603411903557, 0.0052394197419052225,
+        0.8822389102341397, 0.008525852555960639,
+        0.8437125821466905, 0.012744306803107931,
+        0.8008658592874873, 0.017854968449436015,
+        0.7542375697640191, 0.023754027990444248,
+        0.7044140944718857, 0.030276968611937426,
+        0.6520219943065595, 0.037205164746128436,
+        0.5977201313878155, 0.04427548090437452,
+        0.5421913837761863, 0.05119240661403538,
+        0.48613405803158183, 0.05764213229207181,
+        0.4302531076729568, 0.06330786957011048,
+        0.37525126799976294, 0.06788565307649293,
+        0.32182021876716727, 0.07109983236886887,
+        0.27063188584038284, 0.07271747407265305,
+        0.22232999118307128, 0.07256094481011321,
+        0.1775219573659193, 0.0705180327514259,
+        0.13677126821055244, 0.06654908535523464,
+        0.1005903811326854, 0.0606907874757048,
+        0.06943427879893221, 0.053056371577006115,
+        0.043694735804558, 0.043832238902747164,
+        0.023695348239150107, 0.03327121392996553,
+        0.009687231019540806, 0.02168341697171635,
+        0.001843386661593832, 0.00943820389088011,
+        // 28 points
+        0.9956419077642228, 6.370515996210102e-05,
+        0.9854402875829232, 0.0003806839593599655,
+        0.9695474769380219, 0.0011377791456507987,
+        0.9481510589669756, 0.0024959822378719794,
+        0.9215021099473594, 0.004580509469313366,
+        0.8899131284723935, 0.00747273156832763,
+        0.8537544904322089, 0.011204271895438859,
+        0.8134501334282395, 0.01575357142381089,
+        0.7694725945042181, 0.021045103910673282,
+        0.7223374729826939, 0.026951298943627147,
+        0.6725973867373375, 0.033297101792837465,
+        0.6208354938051186, 0.039866973328430734,
+        0.5676586556635289, 0.046414016592978634,
+        0.5136903224747329, 0.052670814440463364,
+        0.459563223773905, 0.058361479776322917,
+        0.4059119503245875, 0.06321436026746542,
+        0.35336551412264616, 0.06697480576198529,
+        0.30253997377549535, 0.0694174006753446,
+        0.2540312117051822, 0.07035708558254015,
+        0.20840794782456448, 0.06965864122232915,
+        0.16620507152150776, 0.0672440818443173,
+        0.12791736994972228, 0.06309759998920904,
+        0.09399372568531336, 0.0572678172849677,
+        0.06483185036310753, 0.049867221727995285,
+        0.04077361101977503, 0.04106881180888533,
+        0.022100981357786813, 0.03110015822865166,
+        0.009032518495310017, 0.020235768381379887,
+        0.0017184952934022467, 0.008800223579860048,
+        // 29 points
+        0.9959272163607105, 5.564241358714028e-05,
+        0.9863904025392899, 0.00033272798661125553,
+        0.971524630855992, 0.0009955114404107458,
+        0.951493945616477, 0.00218709002937152,
+        0.9265180152719408, 0.004021182485231803,
+        0.8968705411002962, 0.006575340169921764,
+        0.8628763693862447, 0.009885829532976953,
+        0.8249079573005494, 0.01394442666818688,
+        0.7833812996605872, 0.0186972816363556,
+        0.7387513739119413, 0.024045918539722308,
+        0.6915071564230855, 0.029850342461892686,
+        0.6421662656731861, 0.035934130597285924,
+        0.5912692913707834, 0.042091296318608834,
+        0.5393738717727237, 0.048094635463988296,
+        0.4870485841530377, 0.05370519726261225,
+        0.4348667153860257, 0.058682471004410874,
+        0.38339998090610705, 0.06279484606213871,
+        0.33321226086401434, 0.0658298886821548,
+        0.2848534221035185, 0.0676039847196542,
+        0.23885329363336638, 0.06797092298173053,
+        0.19571586157012352, 0.06682903797752356,
+        0.15591374708438294, 0.06412659178073493,
+        0.11988302768489704, 0.059865149830889544,
+        0.08801845813988722, 0.054100791868598445,
+        0.06066914207658227, 0.04694309426636408,
+        0.03813469699711213, 0.03855192568110301,
+        0.020661933636159154, 0.029132249771473696,
+        0.008441948804031173, 0.0189277332934335,
+        0.0016058778525400944, 0.00822475907302615,
+        // 30 points
+        0.9961854092532896, 4.881538648506998e-05,
+        0.9872505879667329, 0.00029208248188191137,
+        0.9733158613935449, 0.0008747452449452054,
+        0.9545253157432502, 0.0019243214656368085,
+        0.9310719621711364, 0.0035440571118462425,
+        0.9031965197235615, 0.0058071970466875514,
+        0.8711850490619495, 0.008752554092761194,
+        0.8353660404570976, 0.012381570965051129,
+        0.7961070500327451, 0.01665700904270025,
+        0.7538109306754932, 0.02150333048441229,
+        0.7089116992693157, 0.02680876976084624,
+        0.6618700835772074, 0.0324290202705405,
+        0.6131687947901147, 0.038192394231707255,
+        0.5633075743824563, 0.04390625227933979,
+        0.5127980661561917, 0.04936444568948249,
+        0.4621585661189247, 0.054355471106708415,
+        0.41190870408132424, 0.05867100684562145,
+        0.36256411155259194, 0.06211448255080994,
+        0.3146311306484368, 0.06450933095755146,
+        0.2686016183001324, 0.06570658184089415,
+        0.22494789906742613, 0.065591483529644,
+        0.18411791831743823, 0.06408887558478726,
+        0.1465306454397049, 0.061167085875742946,
+        0.1125717741109366, 0.05684018439459309,
+        0.08258976331894716, 0.05116849259793774,
+        0.05689225853525517, 0.04425731927748618,
+        0.03574292537490614, 0.03625397463788724,
+        0.01935870848902584, 0.027343237690232395,
+        0.00790741531996209, 0.017742000029102662,
+        0.001503977326638774, 0.007703907526677142,
+        // 31 points
+        0.9964198154713466, 4.300369105210563e-05,
+        0.9880318304951723, 0.0002574514681284442,
+        0.974943704254424, 0.0007717057396996698,
+        0.9572825118149126, 0.0016996901827239321,
+        0.9352185227478345, 0.003135161039546822,
+        0.908964277736526, 0.005146855981905777,
+        0.8787726390975521, 0.007774659106840381,
+        0.8449343774921062, 0.01102693954563673,
+        0.8077753782079415, 0.014879176692396105,
+        0.7676535050807022, 0.01927393500347561,
+        0.724955155054066, 0.02412219864885693,
+        0.6800915374180713, 0.02930602312747382,
+        0.6334947138634949, 0.03468240935401617,
+        0.5856134376099926, 0.04008825767952755,
+        0.5369088317321096, 0.04534621667933986,
+        0.48784994832762435, 0.05027120597876521,
+        0.43890925130751685, 0.05467736526761174,
+        0.39055806631605955, 0.0583851640330498,
+        0.34326204160227936, 0.06122839910606623,
+        0.2974766635554076, 0.06306081016811024,
+        0.25364287008646663, 0.06376205679777035,
+        0.21218280408880402, 0.06324282395146252,
+        0.17349574784677543, 0.061448855091384,
+        0.13795427748555525, 0.058363752291383506,
+        0.10590067435078988, 0.05401042910942297,
+        0.07764362749241416, 0.048451153296285694,
+        0.05345525785126261, 0.04178617160801826,
+        0.03356848869388058, 0.034150971286601516,
+        0.018174769095265803, 0.02571233502559234,
+        0.007422051826455696, 0.01666384739763897,
+        0.0014114759654438001, 0.007230975650216756
+      },
+      // alpha = 2
+      {
+        // 1 point
+        0.25, 1.3333333333333333,
+        // 2 points
+        0.5441518440112253, 0.4031435283193017,
+        0.12251482265544138, 0.9301898050140316,
+        // 3 points
+        0.7050022098884984, 0.11980281203432279,
+        0.34700376603835187, 0.5849850770394641,
+        0.07299402407314973, 0.6285454442595465,
+        // 4 points
+        0.7958514178967728, 0.04140896299967226,
+        0.5170472951043675, 0.2745355486916923,
+        0.2386007375518623, 0.5738351591968568,
+        0.04850054944699733, 0.4435536624451119,
+        // 5 points
+        0.8510542129470164, 0.01645530081239603,
+        0.6343334726308868, 0.12822240289184766,
+        0.3898863870655193, 0.35680064488636,
+        0.17348032077169573, 0.5047958475996459,
+        0.03457893991821509, 0.32705913714308366,
+        // 6 points
+        0.8868056161775618, 0.007324303227477191,
+        0.715681127311714, 0.0628811887397802,
+        0.5090364131647521, 0.20515828451846485,
+        0.30243691802289124, 0.37830874699416484,
+        0.13156394165798513, 0.42950599894712255,
+        0.02590455509366719, 0.25015481090632374,
+        // 7 points
+        0.9111831665630028, 0.003570752134756827,
+        0.7735172465914375, 0.03265170252921878,
+        0.6000215132789929, 0.11768884515811447,
+        0.41400214459705975, 0.2525855148355652,
+        0.24055412604805754, 0.36693521311918104,
+        0.10308902914804902, 0.3627952984507446,
+        0.020132773773400506, 0.1971060071057525,
+        // 8 points
+        0.9285089649599069, 0.001874071136138789,
+        0.8157717035832838, 0.017898086852057633,
+        0.6695522718243615, 0.06898745512093993,
+        0.5055970781844892, 0.1632577055541761,
+        0.3416519914772022, 0.2737887336866131,
+        0.19547516848873991, 0.34113907668775506,
+        0.0829006174856511, 0.3072723730688905,
+        0.016097759551921033, 0.15911583122676223,
+        // 9 points
+        0.9412458642132742, 0.0010450493860778517,
+        0.8474368420132373, 0.010297594582434892,
+        0.7232685717403354, 0.041624466317408945,
+        0.5796940563511631, 0.10537312361019935,
+        0.4294536453878128, 0.19416251145802604,
+        0.2858910883392204, 0.27713758275921885,
+        0.16175951676407463, 0.310694276642222,
+        0.06808452959376758, 0.26195814813358653,
+        0.01316588559711449, 0.1310405804441589,
+        // 10 points
+        0.9508742926405231, 0.0006129601467886434,
+        0.8717100745744085, 0.006182092778946315,
+        0.7653476795481079, 0.025879556274234116,
+        0.6396094886547097, 0.06879030018621203,
+        0.5038071264148739, 0.13541826006725646,
+        0.3680078504493377, 0.21153515506785664,
+        0.24228119613252355, 0.2698088775257513,
+        0.13595023405022896, 0.28027803083466535,
+        0.05689815053365792, 0.22509174561123252,
+        0.010968452456174135, 0.10973635484038999,
+        // 11 points
+        0.9583251437866482, 0.00037520194403911226,
+        0.8906910993543922, 0.0038520823021729565,
+        0.7987843585909147, 0.01656001705287609,
+        0.6883242398629567, 0.04565836367239047,
+        0.5662398391545683, 0.09435865415522772,
+        0.44019839985886244, 0.15716087119374245,
+        0.318117951906234, 0.2185288892841797,
+        0.20766834159705988, 0.2567342373990238,
+        0.11578862662939522, 0.2519181720014696,
+        0.048249692094286256, 0.19498344412265797,
+        0.009278973831348835, 0.09320340020555351,
+        // 12 points
+        0.9642065352926715, 0.00023820143923324665,
+        0.9057950735445437, 0.002479813594178078,
+        0.8257185142147869, 0.010883368576415357,
+        0.7282464529530727, 0.030865468095545707,
+        0.618623863458456, 0.06618937457843765,
+        0.5027573604490322, 0.11563220735490944,
+        0.3868920099976898, 0.1710590542807556,
+        0.2772734577993151, 0.21829576465692632,
+        0.17981078905242326, 0.24100242995041807,
+        0.09975762554261415, 0.22633673899789628,
+        0.04142781045429459, 0.17022646146962256,
+        0.007952045702638437, 0.08012445033899501,
+        // 13 points
+        0.968928894228589, 0.0001560679730565849,
+        0.9179996455372067, 0.0016428835671635418,
+        0.8476910439472324, 0.007329564556957514,
+        0.761249766308277, 0.021254277355330555,
+        0.6627093135603885, 0.046913038372407526,
+        0.556674622629455, 0.08501998685902645,
+        0.44810263890570984, 0.13176180671373117,
+        0.3420695126460753, 0.1784984030224598,
+        0.24353289958712845, 0.21336008642348697,
+        0.15709997419650928, 0.22444614852330957,
+        0.08681178015758544, 0.20363932285078007,
+        0.0359533627001701, 0.14970683267537616,
+        0.0068908313099587315, 0.06960491444024738,
+        // 14 points
+        0.9727771207411833, 0.00010510464667559942,
+        0.9279957387467523, 0.0011163973637875139,
+        0.8658249007315969, 0.0050471355806299524,
+        0.7887742384345607, 0.014899502701131436,
+        0.6999909171699065, 0.03365190694854585,
+        0.6031073967275968, 0.06277732914029183,
+        0.5020891397499784, 0.10086473414735622,
+        0.40107137869715437, 0.14295604117005845,
+        0.3041895281416563, 0.18101372901784352,
+        0.21540975706889556, 0.20555969615788602,
+        0.13836652595947407, 0.2081034616428068,
+        0.07621362247485387, 0.18365908845868473,
+        0.03149425981865759, 0.13255838187984223,
+        0.006028808871066649, 0.06102082447779318,
+        // 15 points
+        0.9759538743350237, 7.25151422780349e-05,
+        0.9362818217355188, 0.0007759490522557822,
+        0.8809495287153136, 0.0035462945409363866,
+        0.8119254772750096, 0.010622651943097276,
+        0.7316979730525232, 0.024444200440824196,
+        0.643164601768785, 0.04667432993910656,
+        0.5495243555935513, 0.07717366634109808,
+        0.4541612357544771, 0.11330621269696499,
+        0.36052169358705766, 0.14989550316840522,
+        0.2719899659294862, 0.17996622328246373,
+        0.19176570627765363, 0.1961650715776367,
+        0.12274828621549784, 0.19252823067411926,
+        0.06743186583899861, 0.16612523060641707,
+        0.027814561918260053, 0.11811060302719283,
+        0.00531905200284374, 0.053926650900537214,
+        // 16 points
+        0.978606437498697, 5.1113642278774006e-05,
+        0.9432242857122456, 0.0005503124159022071,
+        0.893685974548804, 0.0025378399982753474,
+        0.831555883026462, 0.007694127704267097,
+        0.7588252579491415, 0.017979395405919436,
+        0.6778299174145608, 0.03499018198244828,
+        0.5911723853165031, 0.05921510663100695,
+        0.5016375561531876, 0.08942874259811973,
+        0.4121029641168596, 0.12244815167135044,
+        0.3254462100241296, 0.1533921878047438,
+        0.24445243174451137, 0.17645063070359748,
+        0.17172475948300212, 0.18602495758945065,
+        0.1096006092587706, 0.17798629389017287,
+        0.060076437716637995, 0.15074329872767428,
+        0.024742967619434984, 0.10584337006935811,
+        0.004727687122934593, 0.04799762249876788,
+        // 17 points
+        0.9808438938474126, 3.672321680050202e-05,
+        0.9490970165965446, 0.00039742610134189585,
+        0.9045054233143287, 0.0018466962351084523,
+        0.8483270857099506, 0.005655535035824529,
+        0.7821731030812211, 0.013386069167279262,
+        0.7079450013850855, 0.02646567904144686,
+        0.6277775385468143, 0.045654568954546754,
+        0.5439766780904757, 0.07055515732420044,
+        0.45895305335301906, 0.09931702444790433,
+        0.3751525416408179, 0.12865428044951455,
+        0.2949858662980235, 0.1542209677884094,
+        0.22075922519215138, 0.17130161571173821,
+        0.15460792826588562, 0.1756904750903703,
+        0.09843493683054136, 0.16457590338827283,
+        0.05385601482718483, 0.1372315591826875,
+        0.022152705311830233, 0.09535104807481298,
+        0.004229765486490768, 0.042992604123074485,
+        // 18 points
+        0.9827484075942869, 2.6840344498172485e-05,
+        0.9541078955173167, 0.00029174803465647483,
+        0.913769864110793, 0.00136436481475062,
+        0.862756720700055, 0.004214201135828769,
+        0.8023851498364175, 0.010082886553745023,
+        0.7342173081350133, 0.020200995153418725,
+        0.6600181272253155, 0.03540911290037991,
+        0.5817090526709179, 0.05577559061459163,
+        0.5013181027502736, 0.08031456678547888,
+        0.420927275870318, 0.10689369747584047,
+        0.3426185978020083, 0.13238390480829,
+        0.26842018278660207, 0.1530511786893972,
+        0.20025369592363035, 0.165134663239831,
+        0.13988457083516925, 0.16550872915007825,
+        0.0888762591164974, 0.15230053701379076,
+        0.048549645304224634, 0.12533563068691805,
+        0.019948351047343018, 0.0863150907167753,
+        0.0038065822475018764, 0.03872959521506409,
+        // 19 points
+        0.984382806551702, 1.9922809327876472e-05,
+        0.9584169024234072, 0.00021737057252801766,
+        0.92176068172914, 0.001022123435563885,
+        0.8752531629838267, 0.0031801773017942373,
+        0.8199803570632374, 0.007679153890769253,
+        0.7572365191732979, 0.01555913925021236,
+        0.688491790914095, 0.027643244311728793,
+        0.6153572448045471, 0.044245762516148035,
+        0.5395469627920881, 0.0649272612879853,
+        0.4628377985520203, 0.08836225259929596,
+        0.3870277027693322, 0.11236643174441163,
+        0.3138935674182182, 0.13410027228244115,
+        0.24514956909516858, 0.15043000208139018,
+        0.18240698366909186, 0.1583929928595227,
+        0.12713640986156027, 0.15568954488904696,
+        0.08063327636666141, 0.141112468797904,
+        0.043987395090842735, 0.11483259911481634,
+        0.018056978337900563, 0.07848342536092974,
+        0.00344389040386249, 0.03506918822751693,
+        // 20 points
+        0.9857957888406419, 1.4996883973348539e-05,
+        0.9621487121504982, 0.0001641564083492808,
+        0.9286990149187505, 0.0007755532384700472,
+        0.8861413029145472, 0.002428182817069033,
+        0.8353789146315618, 0.005909777767885943,
+        0.7774925920354867, 0.012089956683629518,
+        0.7137156110152877, 0.02172836322449211,
+        0.6454070457773675, 0.03525422431297342,
+        0.5740226581828268, 0.052563677026646605,
+        0.5010838154828485, 0.07288201367307477,
+        0.42814504093325667, 0.09472916165698421,
+        0.3567608701024531, 0.11600961898235713,
+        0.2884527121812724, 0.13422572581390196,
+        0.22467641938430505, 0.14678968188807254,
+        0.16679125348100943, 0.15138956150768937,
+        0.1160309076554868, 0.14635166621290827,
+        0.07347719178528528, 0.1309385772702926,
+        0.040036900461906784, 0.10553025771650235,
+        0.016422088133987833, 0.07165500930295424,
+        0.0031306837407435897, 0.031903170945106606,
+        // 21 points
+        0.9870255665787578, 1.1433934187240684e-05,
+        0.9654016073657424, 0.00012550893358717093,
+        0.93476043640123, 0.0005953999959462023,
+        0.8956817429254668, 0.0018742944501358967,
+        0.8489227735376889, 0.004592965682865899,
+        0.7953925737461315, 0.009474486138446127,
+        0.7361326205972873, 0.017197240256853662,
+        0.6722961409869296, 0.02822928389744864,
+        0.6051255339761019, 0.042665081462034724,
+        0.5359281386930321, 0.06009811216766876,
+        0.46605076663517464, 0.07955912026541126,
+        0.396853476985619, 0.09954033550102391,
+        0.32968309899010273, 0.11811229080832998,
+        0.2658470140108159, 0.1331241870513334,
+        0.20658770608253357, 0.14246377909877248,
+        0.1530585749557192, 0.1443411095395722,
+        0.10630147973769312, 0.13755421420250968,
+        0.06722644166793863, 0.12169541861951477,
+        0.03659386328114012, 0.09726429982522235,
+        0.014999364972075522, 0.06566824457697128,
+        0.0028583506000918945, 0.029146526925497723,
+        // 22 points
+        0.9881024599908779, 8.819828241607839e-06,
+        0.9682538838165636, 9.70527116790671e-05,
+        0.9400856692108185, 0.0004620588367041,
+        0.9040851784977527, 0.001461453138691387,
+        0.8608917527628662, 0.0036026650111700793,
+        0.8112752068392205, 0.007485551813034276,
+        0.7561205591789348, 0.013704274083879236,
+        0.6964118629859517, 0.022723073539700163,
+        0.6332145255726629, 0.03474679389549966,
+        0.5676562502726098, 0.0496098140438383,
+        0.5009068926479351, 0.06670592951879768,
+        0.43415757484015516, 0.08497667125409722,
+        0.3685994249559413, 0.10296728493918768,
+        0.305402318442599, 0.11894934651370924,
+        0.24569399962450333, 0.13109834760198852,
+        0.19053995518421663, 0.13770523931252282,
+        0.1409243977569516, 0.1373943986576711,
+        0.09773269667536864, 0.12931789581147773,
+        0.061735561623069604, 0.11329783210115506,
+        0.03357522684802669, 0.08989485493810659,
+        0.013753657987385804, 0.060392249686495286,
+        0.0026200747203711594, 0.026731726095686546,
+        // 23 points
+        0.9890507733735792, 6.8766674434483865e-06,
+        0.9707685195733889, 7.583423894827645e-05,
+        0.9447885021959102, 0.0003621778022397484,
+        0.9115232476013713, 0.0011503146829848223,
+        0.8715161336713438, 0.0028504970810935434,
+        0.8254231835351608, 0.005960272673820516,
+        0.774000884826104, 0.010993963182723315,
+        0.7180934230399323, 0.01838949716531372,
+        0.6586187096898888, 0.02840664653778502,
+        0.596553268151267, 0.04103337000606946,
+        0.5329161809469259, 0.05591706970939041,
+        0.468752347721409, 0.07233501875091632,
+        0.4051153234824939, 0.0892133159204275,
+        0.34305001669057444, 0.10519713019027352,
+        0.28357553025983784, 0.11876764043126845,
+        0.22766842664110568, 0.12839401932339697,
+        0.17624669127824913, 0.1327030992078617,
+        0.13015465696203926, 0.1306458637267027,
+        0.09014913455773985, 0.1216392044936975,
+        0.05688697073444691, 0.10566366342365997,
+        0.03091420521685777, 0.08330302639229947,
+        0.012656799185455403, 0.05572024457122335,
+        0.002410403998251781, 0.024604587153793638,
+        // 24 points
+        0.989890171217452, 5.414795649621589e-06,
+        0.9729966238607434, 5.9827415782008054e-05,
+        0.9489617024727325, 0.00028652627442289543,
+        0.9181367783042759, 0.0009133865187289247,
+        0.8809865112004902, 0.002273816875030567,
+        0.8380732394393358, 0.004780991554881356,
+        0.7900471558143551, 0.008877010801018947,
+        0.7376361331966651, 0.014962934669149535,
+        0.6816345890584223, 0.023319199638437954,
+        0.6228914041763614, 0.03402821314534665,
+        0.5622970377001163, 0.04691155780914074,
+        0.5007700206965443, 0.0614930815650364,
+        0.43924302801385906, 0.07699630754163361,
+        0.3786487375725983, 0.09238041135649377,
+        0.31990569051427054, 0.10641402040729545,
+        0.2639043660726026, 0.1177809496131257,
+        0.21149368193776055, 0.12520739568151817,
+        0.16346812440203068, 0.127596703251215,
+        0.12055570270051878, 0.12415608188927507,
+        0.0834069082711567, 0.11449987238004643,
+        0.052584839764321836, 0.09871617322318442,
+        0.02855661419100575, 0.07738771704125658,
+        0.011686003969767841, 0.05156450302852562,
+        0.0022249354526130537, 0.022721236857137894,
+        // 25 points
+        0.9906367009503252, 4.302755109283993e-06,
+        0.9749800156322561, 4.7621489885358696e-05,
+        0.9526814786656008, 0.00022863334127788971,
+        0.9240421075913751, 0.0007312150296955577,
+        0.8894615186907394, 0.0018277460972511352,
+        0.8494243882656276, 0.003862047153394015,
+        0.8044924465194527, 0.0072126346647461755,
+        0.7552962978229513, 0.012240073388680427,
+        0.7025264744308617, 0.01922488755916926,
+        0.6469237071357921, 0.0283043763775116,
+        0.5892685115570648, 0.03941749238248018,
+        0.5303702240359852, 0.05226654254025416,
+        0.47105563652267973, 0.06630287633400961,
+        0.41215738812559294, 0.08074110304100429,
+        0.3545022754336093, 0.09460303776621984,
+        0.2988996452854617, 0.10678891732884994,
+        0.24613003267995573, 0.11616990625280986,
+        0.19693420312547233, 0.12169297572076376,
+        0.1520027529734087, 0.12248726661861464,
+        0.1119664131211797, 0.11796031209467198,
+        0.07738719047941864, 0.10787312067535583,
+        0.048750465519715944, 0.09238508110486278,
+        0.02645812972355433, 0.07206284363820172,
+        0.01082268301359031, 0.04785247342860094,
+        0.0020600819290978833, 0.021045846549913108,
+        // 26 points
+        0.9913035622385111, 3.4481143597572057e-06,
+        0.9767531733280232, 3.8220538832553876e-05,
+        0.9560108839274216, 0.00018390348515753564,
+        0.9293359602715748, 0.000589871155559649,
+        0.8970739084211864, 0.0014798035104965335,
+        0.8596446098087925, 0.0031405704910335663,
+        0.8175357317097885, 0.005895624378770345,
+        0.7712960967780432, 0.010065291143529335,
+        0.7215284411637628, 0.015918365002230504,
+        0.668881523761727, 0.02362092686671659,
+        0.6140416543163907, 0.033189123832940294,
+        0.5577237395010013, 0.04445264224788491,
+        0.5006619595031363, 0.057034757480220716,
+        0.44360019493065156, 0.07035322704434978,
+        0.387282328057455, 0.08364408140790913,
+        0.3324425444646479, 0.09600780433395996,
+        0.27979576130124917, 0.10647477415668082,
+        0.23002830680682207, 0.11408446398904176,
+        0.18378897246210799, 0.11797105492644576,
+        0.1416805541841086, 0.11744702857526888,
+        0.10425199229337394, 0.11207611814273342,
+        0.07199121113320914, 0.10172775705914329,
+        0.04531874608969985, 0.0866068216720466,
+        0.024582215935673443, 0.06725495107308428,
+        0.010051548959057058, 0.04452377548054358,
+        0.0019128971711032702, 0.01954892722439377,
+        // 27 points
+        0.9919016921030859, 2.7850163885725377e-06,
+        0.9783447246593427, 3.091244161938983e-05,
+        0.959002435079877, 0.00014903331117075786,
+        0.9340992449559258, 0.0004792697453785258,
+        0.9039353597784711, 0.0012062483461918194,
+        0.8688762741806576, 0.002570049171197176,
+        0.8293472971383945, 0.004846921295440349,
+        0.7858281353779031, 0.00831925976793136,
+        0.7388469893624736, 0.013237853538866284,
+        0.6889741108323418, 0.019780617380051897,
+        0.6368148674104017, 0.02801276453548875,
+        0.5830023879264334, 0.03785356234773461,
+        0.528189873835533, 0.049054403415291985,
+        0.4730426684520477, 0.061191949265376834,
+        0.418230179544705, 0.07367865526297174,
+        0.3644177529904575, 0.08579121209195123,
+        0.31225859594442323, 0.09671552705946981,
+        0.2623858474559274, 0.10560502304928052,
+        0.21540489269445431, 0.11164745632802937,
+        0.17188601397207018, 0.11413432354470714,
+        0.13235746756523284, 0.11252637554842859,
+        0.09729906987367218, 0.10650885445527124,
+        0.06713636929901125, 0.09603082810201882,
+        0.04223546938345161, 0.08132436136446987,
+        0.02289854263907702, 0.06290119746144747,
+        0.009359937258201115, 0.04152785829844876,
+        0.001780943143570461, 0.018206031188710486,
+        // 28 points
+        0.9924402145386935, 2.265958598962605e-06,
+        0.979778596064075, 2.5181912163124576e-05,
+        0.9617001463459458, 0.00012162122081087652,
+        0.9384000294379855, 0.00039203170518316386,
+        0.9101403003668531, 0.00098956454411888,
+        0.877240543649788, 0.002115799069802587,
+        0.8400732837976638, 0.004006769963826888,
+        0.7990595276685625, 0.006910213443566889,
+        0.7546639187593059, 0.011056091906312425,
+        0.7073894438877856, 0.01662340411686909,
+        0.6577717217542248, 0.023706932206672516,
+        0.6063729282730147, 0.032287839965026446,
+        0.5537754238684314, 0.04221188066485391,
+        0.5005751534419837, 0.05317840198085356,
+        0.4473748931198532, 0.06474239890218385,
+        0.3947774199723313, 0.07633065037704359,
+        0.3433786819261913, 0.08727159968574143,
+        0.29376104516135143, 0.09683723892284496,
+        0.24648669543635304, 0.10429397623233903,
+        0.20209126804688327, 0.10895843305145539,
+        0.1610777785030256, 0.11025344726075972,
+        0.1239109225098249, 0.10775932245541835,
+        0.09101180937213292, 0.10125559748899071,
+        0.06275318712545885, 0.09074930386242808,
+        0.03945520864053971, 0.0764867860250257,
+        0.02138176483568374, 0.058947665956702554,
+        0.00873728447239214, 0.03882216114018575,
+        0.0016621883340103443, 0.016996753313554908,
+        // 29 points
+        0.9929267893183628, 1.8562837720810216e-06,
+        0.9810749076596257, 2.0651933794836736e-05,
+        0.9641411217247746, 9.990263394095784e-05,
+        0.9422958895903871, 0.00032270419081951345,
+        0.9157689585742376, 0.0008167123025929538,
+        0.884840951374607, 0.001751756104040544,
+        0.8498394858283587, 0.0033297320995347166,
+        0.8111354807272445, 0.005767322345572895,
+        0.7691391534023485, 0.009272946255348385,
+        0.7242956444888707, 0.014020098613333672,
+        0.6770802877492443, 0.020119768446834975,
+        0.6279935659165262, 0.02759491436298458,
+        0.5775558026309174, 0.0363599568488671,
+        0.5263016453375968, 0.04620793050943087,
+        0.47477439700098734, 0.056807342508455635,
+        0.4235202564181098, 0.06770995846565736,
+        0.37308252802933745, 0.07836975770978971,
+        0.3239958625177051, 0.08817225630680597,
+        0.2767805891942974, 0.09647238670452894,
+        0.23193720020633643, 0.10263824376203651,
+        0.1899410449901283, 0.10609734435298944,
+        0.15123729113160148, 0.10638166879143081,
+        0.11623620488298535, 0.10316769886192091,
+        0.08530880093329034, 0.09630795187080586,
+        0.05878290626605056, 0.08585111618606221,
+        0.03693967529168127, 0.07204878416716869,
+        0.020010572775378637, 0.05534795630399539,
+        0.008174723674418611, 0.036370658936657294,
+        0.0015549290312566655, 0.015903955474160493,
+        // 30 points
+        0.993367884997289, 1.5304356923035597e-06,
+        0.9822506759732044, 1.7043782109768465e-05,
+        0.9663568116103163, 8.256807322596643e-05,
+        0.9458357764492203, 0.00026721996206630565,
+        0.9208898151139506, 0.0006779008760458223,
+        0.8917663186820247, 0.0014581866872854375,
+        0.8587545173866958, 0.002781045433058291,
+        0.8221823987382739, 0.004835687651116839,
+        0.7824133817283033, 0.007809512179248872,
+        0.7398426798885769, 0.011866692315905243,
+        0.694893362648009, 0.01712539544532892,
+        0.6480121455331503, 0.023635897735454423,
+        0.5996649478704976, 0.0313619145197526,
+        0.5503322608308271, 0.04016730562047343,
+        0.5005043712628965, 0.049809942439445094,
+        0.4506764885015599, 0.05994396892391193,
+        0.40134382243741856, 0.0701309974240169,
+        0.35299666168535027, 0.0798600120911968,
+        0.3061155007205122, 0.08857497394178218,
+        0.2611662643784975, 0.09570840225375843,
+        0.21859567715188458, 0.10071861176163013,
+        0.17882682326730875, 0.10312786947459454,
+        0.14225494159995722, 0.10255853931504913,
+        0.10924349706265211, 0.09876432908795536,
+        0.08012056711232554, 0.09165404412254467,
+        0.05517557808804577, 0.08130576744926203,
+        0.034656419565989735, 0.06797009893843162,
+        0.018766946274613224, 0.052062011945063366,
+        0.007664767864806791, 0.03414270443637352,
+        0.0014577278339065036, 0.014913159011553405,
+        // 31 points
+        0.9937689943617639, 1.2693806267646786e-06,
+        0.9833203701304175, 1.4149388753376678e-05,
+        0.9683740118091605, 6.863667359946889e-05,
+        0.9490615100934993, 0.00022251841136167533,
+        0.9255615822969552, 0.0005657189666091238,
+        0.8980931407181669, 0.0012200416212609546,
+        0.8669124518396083, 0.002333953705311331,
+        0.8323105489456515, 0.004072567301324925,
+        0.7946104527758169, 0.006603470707394317,
+        0.7541641319977899, 0.010079521769918299,
+        0.7113492068095686, 0.01462008082783842,
+        0.6665654183773304, 0.020292403450688883,
+        0.6202308940878964, 0.027095006903869536,
+        0.5727782422577025, 0.03494475743428021,
+        0.5246505122103465, 0.043669199881071166,
+        0.4762970571775839, 0.05300528235407393,
+        0.4281693385154156, 0.06260514491381267,
+        0.3807167103369647, 0.07204908076371079,
+        0.3343822238776351, 0.08086518702868965,
+        0.2895984907391476, 0.08855464875380006,
+        0.2467836436155711, 0.09462109265174808,
+        0.20633743219330797, 0.09860204997970906,
+        0.16863749064420983, 0.10010031595245304,
+        0.13403581149838767, 0.09881291012170007,
+        0.10285545867509341, 0.09455543857311113,
+        0.07538754998514038, 0.08727993087125599,
+        0.05188853615392921, 0.0770846559194444,
+        0.03257779777966461, 0.06421499003447563,
+        0.017635564693986534, 0.04905514352007359,
+        0.007201060193187964, 0.03211210056592243,
+        0.0013693652091001038, 0.014012064905444366
+      }
+    };
+
+  } // namespace Impl
+
+} // namespace Dune
@@ -0,0 +1,86 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_QUADRATURERULES_PYRAMIDQUADRATURE_HH
+#define DUNE_GEOMETRY_QUADRATURERULES_PYRAMIDQUADRATURE_HH
+
+#include <algorithm>
+
+namespace Dune {
+
+  /************************************************
+   * Collapsed quadrature rules for pyramids
+   *************************************************/
+
+  /** \brief Quadrature rules for pyramids
+      \ingroup Quadrature
+   */
+  template<typename ct, int dim>
+  class PyramidQuadratureRule;
+
+  /** \brief Collapsed quadrature rules for pyramids
+      \ingroup Quadrature
+
+      The pyramid is the image of the unit cube under the Duffy
+      transformation \f$(\xi,\eta,z) \mapsto ((1-z)\xi,(1-z)\eta,z)\f$ with
+      Jacobian determinant \f$(1-z)^2\f$.  This rule combines a Gauss-Legendre
+      rule in \f$\xi\f$ and \f$\eta\f$ with a Gauss-Jacobi rule for the weight
+      \f$(1-z)^2\f$ in \f$z\f$, i.e., the Jacobian is absorbed into the
+      weights instead of raising the order of the rule in \f$z\f$ by two.
+
+      A rule of order p integrates exactly all functions that are polynomials
+      of degree at most p in each of \f$\xi\f$, \f$\eta\f$ and \f$z\f$.  This
+      space contains all polynomials of total degree p on the pyramid, but
+      also the rational functions like \f$xy/(1-z)\f$ spanning the usual
+      pyramidal shape functions.  Compared to the conical product rule, the
+      rule needs one point less in \f$z\f$-direction, e.g., 216 instead of
+      252 points for order 10.  It is selected by QuadratureType::Symmetric.
+   */
+  template<typename ct>
+  class PyramidQuadratureRule<ct,3> : public QuadratureRule<ct,3>
+  {
+  public:
+    /** \brief The space dimension */
+    enum { d = 3 };
+
+    /** \brief The highest order of the tabulated one-dimensional rules it is composed of
+     *
+     *  Higher orders are computed at runtime as well, see QuadratureRules::rule().
+     */
+    enum { highest_order = int(GaussQuadratureRule1D<ct>::highest_order) < int(Jacobi2QuadratureRule1D<ct>::highest_order)
+                           ? int(GaussQuadratureRule1D<ct>::highest_order) : int(Jacobi2QuadratureRule1D<ct>::highest_order) };
+
+  private:
+    friend class QuadratureRuleFactory<ct,d>;
+    PyramidQuadratureRule (int p) : QuadratureRule<ct,3>(GeometryType(GeometryType::pyramid, d))
+    {
+      const GeometryType lineType(GeometryType::cube, 1);
+      const QuadratureRule<ct,1> &gauss
+        = QuadratureRules<ct,1>::rule(lineType, p, QuadratureType::GaussLegendre);
+      const QuadratureRule<ct,1> &jacobi
+        = QuadratureRules<ct,1>::rule(lineType, p, QuadratureType::GaussJacobi_2_0);
+      this->delivered_order = std::min(gauss.order(), jacobi.order());
+
+      this->reserve(gauss.size()*gauss.size()*jacobi.size());
+      for (const auto &qz : jacobi)
+      {
+        const ct z = qz.position()[0];
+        const ct scale = ct(1) - z;
+        // the Gauss-Jacobi weights are those of the weight (1-t)^2 on [-1,1],
+        // i.e., of the weight 4(1-z)^2 on [0,1]
+        const ct weightZ = qz.weight() / ct(4);
+        for (const auto &qy : gauss)
+          for (const auto &qx : gauss)
+          {
+            FieldVector<ct,3> local;
+            local[0] = scale * qx.position()[0];
+            local[1] = scale * qy.position()[0];
+            local[2] = z;
+            this->push_back(QuadraturePoint<ct,d>(local, qx.weight() * qy.weight() * weightZ));
+          }
+      }
+    }
+  };
+
+} // end namespace Dune
+
+#endif // DUNE_GEOMETRY_QUADRATURERULES_PYRAMIDQUADRATURE_HH
@@ -0,0 +1,146 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+#include "config.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DUNE_GEOMETRY_QUADRATURECACHE_MMAP 1
+#define DUNE_GEOMETRY_QUADRATURECACHE_MKSTEMP 1
+#endif
+
+#include <dune/common/exceptions.hh>
+
+#include <dune/geometry/quadraturerules/quadraturecache.hh>
+
+namespace Dune
+{
+
+  namespace Impl
+  {
+
+    // Implementation of QuadratureCacheFile
+    // -------------------------------------
+
+    QuadratureCacheFile::QuadratureCacheFile ( const std::string &filename )
+      : data_( nullptr ), size_( 0 ), mapped_( false )
+    {
+#ifdef DUNE_GEOMETRY_QUADRATURECACHE_MMAP
+      const int fd = ::open( filename.c_str(), O_RDONLY );
+      if( fd < 0 )
+        DUNE_THROW( IOError, "Unable to open quadrature cache file '" << filename << "'" );
+
+      struct stat status;
+      if( ::fstat( fd, &status ) != 0 )
+      {
+        ::close( fd );
+        DUNE_THROW( IOError, "Unable to determine size of quadrature cache file '" << filename << "'" );
+      }
+
+      size_ = status.st_size;
+      if( size_ > 0 )
+      {
+        void *address = ::mmap( nullptr, size_, PROT_READ, MAP_SHARED, fd, 0 );
+        if( address != MAP_FAILED )
+        {
+          data_ = static_cast< const char * >( address );
+          mapped_ = true;
+        }
+      }
+      ::close( fd );
+      if( mapped_ || (size_ == 0) )
+        return;
+#endif // #ifdef DUNE_GEOMETRY_QUADRATURECACHE_MMAP
+
+      // fall back to reading the file
+      std::ifstream in( filename.c_str(), std::ios::binary );
+      if( !in )
+        DUNE_THROW( IOError, "Unable to open quadrature cache file '" << filename << "'" );
+      buffer_.assign( std::istreambuf_iterator< char >( in ), std::istreambuf_iterator< char >() );
+      data_ = buffer_.data();
+      size_ = buffer_.size();
+    }
+
+
+    QuadratureCacheFile::~QuadratureCacheFile ()
+    {
+#ifdef DUNE_GEOMETRY_QUADRATURECACHE_MMAP
+      if( mapped_ )
+        ::munmap( const_cast< char * >( data_ ), size_ );
+#endif // #ifdef DUNE_GEOMETRY_QUADRATURECACHE_MMAP
+    }
+
+
+
+    // writeQuadratureCacheFile
+    // ------------------------
+
+    void writeQuadratureCacheFile ( const std::string &filename, const std::vector< char > &data )
+    {
+      // the temporary file lives next to the target (rename is atomic only
+      // within a file system) and has a unique name, so that concurrent
+      // writers never write into each other's files
+#ifdef DUNE_GEOMETRY_QUADRATURECACHE_MKSTEMP
+      std::vector< char > tmptemplate( filename.begin(), filename.end() );
+      const char suffix[] = ".tmp.XXXXXX";
+      tmptemplate.insert( tmptemplate.end(), suffix, suffix + sizeof( suffix ) );
+      const int fd = ::mkstemp( tmptemplate.data() );
+      if( fd < 0 )
+        DUNE_THROW( IOError, "Unable to create temporary file for quadrature cache file '" << filename << "'" );
+      const std::string tmpname( tmptemplate.data() );
+
+      // mkstemp creates the file accessible to the owner only
+      bool written = (::fchmod( fd, 0644 ) == 0);
+      for( std::size_t pos = 0; written && (pos < data.size()); )
+      {
+        const ::ssize_t count = ::write( fd, data.data() + pos, data.size() - pos );
+        if( count > 0 )
+          pos += count;
+        else
+          written = (count < 0) && (errno == EINTR);
+      }
+      written &= (::close( fd ) == 0);
+#else // #ifdef DUNE_GEOMETRY_QUADRATURECACHE_MKSTEMP
+      // a random process tag plus a counter distinguishes concurrent writers
+      static const unsigned long tag = std::random_device()();
+      static std::atomic< unsigned long > counter( 0 );
+      std::ostringstream tmpstream;
+      tmpstream << filename << ".tmp." << std::hex << tag << "." << counter++;
+      const std::string tmpname = tmpstream.str();
+
+      bool written;
+      {
+        std::ofstream out( tmpname.c_str(), std::ios::binary | std::ios::trunc );
+        out.write( data.data(), data.size() );
+        out.close();
+        written = bool( out );
+      }
+#endif // #else // #ifdef DUNE_GEOMETRY_QUADRATURECACHE_MKSTEMP
+      if( !written )
+      {
+        std::remove( tmpname.c_str() );
+        DUNE_THROW( IOError, "Unable to write quadrature cache file '" << tmpname << "'" );
+      }
+
+      if( std::rename( tmpname.c_str(), filename.c_str() ) != 0 )
+      {
+        std::remove( tmpname.c_str() );
+        DUNE_THROW( IOError, "Unable to rename '" << tmpname << "' to '" << filename << "'" );
+      }
+    }
+
+  } // namespace Impl
+
+} // namespace Dune
@@ -0,0 +1,116 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_QUADRATURERULES_QUADRATURECACHE_HH
+#define DUNE_GEOMETRY_QUADRATURERULES_QUADRATURECACHE_HH
+
+/** \file
+ *  \brief File format of the quadrature cache files written by
+ *         QuadratureRules::writeCache()
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Dune
+{
+
+  namespace Impl
+  {
+
+    // QuadratureCacheHeader
+    // ---------------------
+
+    /** \brief header of a quadrature cache file
+     *
+     *  A cache file consists of this header followed by numRules records.
+     *  Each record is a QuadratureCacheRecord, followed by the orders of the
+     *  dimension tensor factors (as std::int32_t, -1 if the rule is no tensor
+     *  product) and the size*(dimension+1) coordinates and weights of the
+     *  points.  All data is stored in the byte order of the writer and
+     *  without padding; readers must not assume any alignment.
+     */
+    struct QuadratureCacheHeader
+    {
+      //! version of the file format, increase on any change of the layout
+      static const std::uint32_t currentVersion = 1;
+      //! value of byteOrder written by the writer
+      static const std::uint32_t byteOrderMark = 0x01020304u;
+
+      char magic[ 8 ];
+      std::uint32_t version;
+      std::uint32_t byteOrder;
+      std::uint32_t fieldSize;
+      std::uint32_t fieldDigits;
+      std::uint32_t dimension;
+      std::uint32_t numRules;
+    };
+
+    //! magic string at the beginning of each quadrature cache file
+    static const char quadratureCacheMagic[ 8 ] = { 'D', 'U', 'N', 'E', 'Q', 'R', 'C', '\0' };
+
+
+
+    // QuadratureCacheRecord
+    // ---------------------
+
+    //! description of a single quadrature rule in a quadrature cache file
+    struct QuadratureCacheRecord
+    {
+      std::int32_t quadratureType;
+      std::uint32_t topologyId;
+      std::int32_t order;
+      std::int32_t deliveredOrder;
+      std::uint64_t size;
+    };
+
+
+
+    // QuadratureCacheFile
+    // -------------------
+
+    /** \brief read-only view of a quadrature cache file
+     *
+     *  On POSIX systems, the file is mapped into memory, so that all
+     *  processes reading the same file share its pages.  Elsewhere, the file
+     *  is read into a buffer.
+     */
+    class QuadratureCacheFile
+    {
+    public:
+      //! open a file (throws IOError on failure)
+      explicit QuadratureCacheFile ( const std::string &filename );
+
+      QuadratureCacheFile ( const QuadratureCacheFile & ) = delete;
+      QuadratureCacheFile &operator= ( const QuadratureCacheFile & ) = delete;
+
+      ~QuadratureCacheFile ();
+
+      //! contents of the file
+      const char *data () const { return data_; }
+
+      //! size of the file in bytes
+      std::size_t size () const { return size_; }
+
+    private:
+      const char *data_;
+      std::size_t size_;
+      bool mapped_;
+      std::vector< char > buffer_;
+    };
+
+    /** \brief write the contents of a quadrature cache file
+     *
+     *  The data is written to a uniquely named temporary file in the same
+     *  directory first, which is then renamed, so that concurrent readers
+     *  never see a partially written file and concurrent writers do not
+     *  interfere.
+     */
+    void writeQuadratureCacheFile ( const std::string &filename, const std::vector< char > &data );
+
+  } // namespace Impl
+
+} // namespace Dune
+
+#endif // #ifndef DUNE_GEOMETRY_QUADRATURERULES_QUADRATURECACHE_HH
@@ -0,0 +1,291 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_QUADRATURERULES_STATICQUADRATURERULE_HH
+#define DUNE_GEOMETRY_QUADRATURERULES_STATICQUADRATURERULE_HH
+
+/** \file
+ *  \brief Quadrature rules of fixed geometry type and order, computed at
+ *         compile time
+ */
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+#include <dune/common/fvector.hh>
+
+#include <dune/geometry/quadraturerules.hh>
+#include <dune/geometry/quadraturerules/gaussjacobi.hh>
+#include <dune/geometry/type.hh>
+
+namespace Dune
+{
+
+  namespace Impl
+  {
+
+    // StaticQuadratureTable
+    // ---------------------
+
+    //! number of points of the one-dimensional rule of order p
+    inline constexpr std::size_t staticQuadratureSize1D ( int p, QuadratureType::Enum qt )
+    {
+      return (qt == QuadratureType::GaussLobatto ? p/2 + 2 : p/2 + 1);
+    }
+
+    //! number of points of the rule for a topology, constructed as in TensorProductQuadratureRule
+    inline constexpr std::size_t staticQuadratureSize ( unsigned int topologyId, int dim, int p, QuadratureType::Enum qt )
+    {
+      if( dim == 0 )
+        return 1;
+      else if( dim == 1 )
+        return staticQuadratureSize1D( p, qt );
+
+      const unsigned int baseId = baseTopologyId( topologyId, dim );
+      const int p1D = (isPrism( topologyId, dim ) ? p : p + dim-1);
+      return staticQuadratureSize( baseId, dim-1, p, qt ) * staticQuadratureSize1D( p1D, qt );
+    }
+
+    /** \brief points and weights of a StaticQuadratureRule, filled in a
+     *         constant expression
+     */
+    template< class ct, int dim, unsigned int topologyId, int order, QuadratureType::Enum qt >
+    struct StaticQuadratureTable
+    {
+      static const std::size_t size = staticQuadratureSize( topologyId, dim, order, qt );
+
+      // the rule is a tensor or conical product of a base rule with a 1D rule
+      static const unsigned int baseId = baseTopologyId( topologyId, dim );
+      static const bool prism = isPrism( topologyId, dim );
+      typedef StaticQuadratureTable< ct, dim-1, baseId, order, qt > BaseTable;
+      typedef StaticQuadratureTable< ct, 1, 0, (prism ? order : order + dim-1), qt > OneDTable;
+
+      constexpr StaticQuadratureTable ()
+        : points(), weights(), deliveredOrder( order )
+      {
+        constexpr BaseTable base;
+        constexpr OneDTable oneD;
+
+        std::size_t k = 0;
+        for( std::size_t i = 0; i < BaseTable::size; ++i )
+        {
+          for( std::size_t j = 0; j < OneDTable::size; ++j, ++k )
+          {
+            const ct z = oneD.points[ j ][ 0 ];
+            const ct scale = (prism ? ct( 1 ) : ct( 1 ) - z);
+            for( int l = 0; l < dim-1; ++l )
+              points[ k ][ l ] = scale * base.points[ i ][ l ];
+            points[ k ][ dim-1 ] = z;
+
+            weights[ k ] = base.weights[ i ] * oneD.weights[ j ];
+            for( int l = 0; l < dim-1; ++l )
+              weights[ k ] *= scale;
+          }
+        }
+      }
+
+      ct points[ size ][ dim ];
+      ct weights[ size ];
+      int deliveredOrder;
+    };
+
+    template< class ct, unsigned int topologyId, int order, QuadratureType::Enum qt >
+    struct StaticQuadratureTable< ct, 1, topologyId, order, qt >
+    {
+      static const std::size_t size = staticQuadratureSize1D( order, qt );
+
+      constexpr StaticQuadratureTable ()
+        : points(), weights(), deliveredOrder( 0 )
+      {
+        long double x[ size ] = {}, w[ size ] = {};
+        switch( qt )
+        {
+        case QuadratureType::GaussJacobi_1_0 :
+          gaussJacobiRule( size, 1, x, w );
+          break;
+        case QuadratureType::GaussJacobi_2_0 :
+          gaussJacobiRule( size, 2, x, w );
+          break;
+        case QuadratureType::GaussLobatto :
+          gaussLobattoRule( size, x, w );
+          break;
+        default :
+          gaussJacobiRule( size, 0, x, w );
+          break;
+        }
+
+        for( std::size_t i = 0; i < size; ++i )
+        {
+          points[ i ][ 0 ] = ct( x[ i ] );
+          weights[ i ] = ct( w[ i ] );
+        }
+        deliveredOrder = (qt == QuadratureType::GaussLobatto ? 2*int( size )-3 : 2*int( size )-1);
+      }
+
+      ct points[ size ][ 1 ];
+      ct weights[ size ];
+      int deliveredOrder;
+    };
+
+    template< class ct, unsigned int topologyId, int order, QuadratureType::Enum qt >
+    struct StaticQuadratureTable< ct, 0, topologyId, order, qt >
+    {
+      static const std::size_t size = 1;
+
+      constexpr StaticQuadratureTable ()
+        : points(), weights{ ct( 1 ) }, deliveredOrder( std::numeric_limits< int >::max() )
+      {}
+
+      ct points[ size ][ 1 ];
+      ct weights[ size ];
+      int deliveredOrder;
+    };
+
+
+
+
+    // staticQuadraturePoints
+    // ----------------------
+
+    template< class ct, int dim, class Table, std::size_t... k >
+    inline constexpr std::array< ct, dim >
+    staticQuadraturePoint ( const Table &table, std::size_t i, std::index_sequence< k... > )
+    {
+      return std::array< ct, dim >{{ table.points[ i ][ k ]... }};
+    }
+
+    //! copy the points of a StaticQuadratureTable into a std::array
+    template< class ct, int dim, class Table, std::size_t... i >
+    inline constexpr std::array< std::array< ct, dim >, sizeof...( i ) >
+    staticQuadraturePoints ( const Table &table, std::index_sequence< i... > )
+    {
+      return std::array< std::array< ct, dim >, sizeof...( i ) >{{ staticQuadraturePoint< ct, dim >( table, i, std::make_index_sequence< dim >() )... }};
+    }
+
+
+
+    // staticQuadratureWeights
+    // -----------------------
+
+    //! copy the weights of a StaticQuadratureTable into a std::array
+    template< class ct, class Table, std::size_t... i >
+    inline constexpr std::array< ct, sizeof...( i ) >
+    staticQuadratureWeights ( const Table &table, std::index_sequence< i... > )
+    {
+      return std::array< ct, sizeof...( i ) >{{ table.weights[ i ]... }};
+    }
+
+
+
+
+    // StaticQuadratureRuleCopy
+    // ------------------------
+
+    //! QuadratureRule holding a copy of the points of a StaticQuadratureRule
+    template< class ct, int dim >
+    class StaticQuadratureRuleCopy
+      : public QuadratureRule< ct, dim >
+    {
+    public:
+      template< class StaticRule >
+      explicit StaticQuadratureRuleCopy ( const StaticRule & )
+        : QuadratureRule< ct, dim >( StaticRule::type(), StaticRule::order() )
+      {
+        for( std::size_t i = 0; i < StaticRule::size; ++i )
+          this->push_back( QuadraturePoint< ct, dim >( StaticRule::position( i ), StaticRule::weight( i ) ) );
+        this->updateSoA();
+      }
+    };
+
+  } // namespace Impl
+
+
+
+  // StaticQuadratureRule
+  // --------------------
+
+  /** \brief Quadrature rule of fixed geometry type and order whose points
+   *         and weights are constant expressions
+   *  \ingroup Quadrature
+   *
+   *  The rule is constructed like TensorProductQuadratureRule, i.e., by
+   *  tensor and conical products of one-dimensional rules.  The
+   *  one-dimensional rules are computed at compile time by Newton's method
+   *  on the Jacobi polynomials, so the number of points is a compile-time
+   *  constant and the points and weights are available as constexpr
+   *  std::arrays.  Loops over the points can thus be fully unrolled.
+   *
+   *  \note The rules coincide with the runtime rules up to rounding and the
+   *        order of the points, except where QuadratureRules provides
+   *        special rules (e.g., for low order simplices).
+   *
+   *  \tparam ct          number type (must be usable in constant expressions)
+   *  \tparam dim         dimension
+   *  \tparam topologyId  topology id of the geometry type
+   *  \tparam p           requested order
+   *  \tparam qt          quadrature type of the one-dimensional rules
+   */
+  template< class ct, int dim, unsigned int topologyId, int p,
+            QuadratureType::Enum qt = QuadratureType::GaussLegendre >
+  class StaticQuadratureRule
+  {
+    static_assert( (dim >= 0) && (topologyId < Impl::numTopologies( dim )), "Invalid topology id." );
+    static_assert( p >= 0, "Quadrature order must be nonnegative." );
+    static_assert( (qt == QuadratureType::GaussLegendre) || (qt == QuadratureType::GaussJacobi_1_0)
+                   || (qt == QuadratureType::GaussJacobi_2_0) || (qt == QuadratureType::GaussLobatto),
+                   "Unsupported quadrature type." );
+
+    typedef Impl::StaticQuadratureTable< ct, dim, topologyId, p, qt > Table;
+    static constexpr Table table_ = Table();
+
+  public:
+    //! dimension of the integration domain
+    static const int dimension = dim;
+
+    //! number of quadrature points
+    static const std::size_t size = Table::size;
+
+    //! coordinates of the quadrature points
+    static constexpr std::array< std::array< ct, dim >, size > points = Impl::staticQuadraturePoints< ct, dim >( table_, std::make_index_sequence< size >() );
+
+    //! weights of the quadrature points
+    static constexpr std::array< ct, size > weights = Impl::staticQuadratureWeights< ct >( table_, std::make_index_sequence< size >() );
+
+    //! return the geometry type of the integration domain
+    static constexpr GeometryType type () { return GeometryType( topologyId, dim ); }
+
+    //! return the order of the quadrature rule
+    static constexpr int order () { return table_.deliveredOrder; }
+
+    //! return the i-th quadrature point
+    static FieldVector< ct, dim > position ( std::size_t i )
+    {
+      FieldVector< ct, dim > x;
+      for( int k = 0; k < dim; ++k )
+        x[ k ] = points[ i ][ k ];
+      return x;
+    }
+
+    //! return the i-th quadrature weight
+    static constexpr ct weight ( std::size_t i ) { return weights[ i ]; }
+
+    //! create a (dynamic) QuadratureRule with the same points and weights
+    static QuadratureRule< ct, dim > quadratureRule ()
+    {
+      return Impl::StaticQuadratureRuleCopy< ct, dim >( StaticQuadratureRule() );
+    }
+  };
+
+  template< class ct, int dim, unsigned int topologyId, int p, QuadratureType::Enum qt >
+  constexpr typename StaticQuadratureRule< ct, dim, topologyId, p, qt >::Table StaticQuadratureRule< ct, dim, topologyId, p, qt >::table_;
+
+  template< class ct, int dim, unsigned int topologyId, int p, QuadratureType::Enum qt >
+  constexpr std::array< std::array< ct, dim >, StaticQuadratureRule< ct, dim, topologyId, p, qt >::size > StaticQuadratureRule< ct, dim, topologyId, p, qt >::points;
+
+  template< class ct, int dim, unsigned int topologyId, int p, QuadratureType::Enum qt >
+  constexpr std::array< ct, StaticQuadratureRule< ct, dim, topologyId, p, qt >::size > StaticQuadratureRule< ct, dim, topologyId, p, qt >::weights;
+
+} // namespace Dune
+
+#endif // #ifndef DUNE_GEOMETRY_QUADRATURERULES_STATICQUADRATURERULE_HH
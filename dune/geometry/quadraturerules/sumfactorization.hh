@@ -0,0 +1,194 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_QUADRATURERULES_SUMFACTORIZATION_HH
+#define DUNE_GEOMETRY_QUADRATURERULES_SUMFACTORIZATION_HH
+
+/** \file
+ *  \brief helpers for sum-factorized evaluation on tensor product quadrature rules
+ */
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include <dune/geometry/quadraturerules.hh>
+
+namespace Dune
+{
+
+  // tensorSizes
+  // -----------
+
+  /** \brief obtain the number of points per direction of a tensor product rule
+   *
+   *  The result can be passed as rows (for evaluation in the quadrature
+   *  points) or as columns (for integration against test functions) to
+   *  TensorContraction.
+   */
+  template< class ct, int dim >
+  inline std::array< std::size_t, dim > tensorSizes ( const QuadratureRule< ct, dim > &rule )
+  {
+    assert( rule.isTensorProduct() );
+    std::array< std::size_t, dim > sizes;
+    for( int k = 0; k < dim; ++k )
+      sizes[ k ] = rule.tensorFactor( k ).size();
+    return sizes;
+  }
+
+
+
+  // TensorContraction
+  // -----------------
+
+  /** \brief apply a Kronecker product of one-dimensional matrices by sum factorization
+   *
+   *  Let \f$A_0, \dots, A_{dim-1}\f$ be matrices of size
+   *  \f$r_k \times c_k\f$, stored row-wise.  This class computes
+   *  \f[
+   *    y_{i_0 \dots i_{dim-1}} = \sum_{j_0, \dots, j_{dim-1}}
+   *      (A_0)_{i_0 j_0} \cdots (A_{dim-1})_{i_{dim-1} j_{dim-1}}\, x_{j_0 \dots j_{dim-1}}
+   *  \f]
+   *  as a sequence of one-dimensional contractions, requiring
+   *  \f$O(p^{dim+1})\f$ instead of \f$O(p^{2 dim})\f$ operations for
+   *  \f$r_k, c_k \leq p\f$.  Multi-indices are flattened with direction 0
+   *  varying slowest, matching the point numbering of tensor product
+   *  quadrature rules (see QuadratureRule::isTensorProduct).
+   *
+   *  Typically, \f$(A_k)_{qj} = \varphi_j(x_q)\f$ holds the values of
+   *  one-dimensional shape functions in the points of the k-th tensor factor
+   *  of a quadrature rule.  Then apply() evaluates a tensor product function
+   *  in all quadrature points and applyTransposed() integrates against all
+   *  tensor product shape functions, given the weighted integrand values.
+   *
+   *  The object keeps the intermediate buffers, so it should be reused for
+   *  repeated contractions.  It is not safe to use the same object
+   *  concurrently from several threads.
+   *
+   *  \tparam  T    field type of the matrices and vectors
+   *  \tparam  dim  number of directions
+   */
+  template< class T, int dim >
+  class TensorContraction
+  {
+    static_assert( dim > 0, "TensorContraction requires at least one direction." );
+
+  public:
+    typedef T field_type;
+
+    static const int dimension = dim;
+
+    /** \brief constructor
+     *
+     *  \param[in]  rows  number of rows of the matrix in each direction
+     *  \param[in]  cols  number of columns of the matrix in each direction
+     */
+    TensorContraction ( const std::array< std::size_t, dim > &rows, const std::array< std::size_t, dim > &cols )
+      : rows_( rows ), cols_( cols )
+    {
+      // intermediate tensors have rows in the first and columns in the last directions
+      std::size_t maxSize = 0;
+      for( int k = 0; k <= dim; ++k )
+      {
+        std::size_t size = 1;
+        for( int l = 0; l < dim; ++l )
+          size *= (l < k ? rows_[ l ] : cols_[ l ]);
+        maxSize = std::max( maxSize, size );
+        // the transposed contraction uses the mirrored layout
+        size = 1;
+        for( int l = 0; l < dim; ++l )
+          size *= (l < k ? cols_[ l ] : rows_[ l ]);
+        maxSize = std::max( maxSize, size );
+      }
+      buffer_[ 0 ].resize( maxSize );
+      buffer_[ 1 ].resize( maxSize );
+    }
+
+    /** \brief number of rows in direction k */
+    std::size_t rows ( int k ) const { return rows_[ k ]; }
+
+    /** \brief number of columns in direction k */
+    std::size_t cols ( int k ) const { return cols_[ k ]; }
+
+    /** \brief total number of entries of the row tensor */
+    std::size_t rowSize () const { return product( rows_ ); }
+
+    /** \brief total number of entries of the column tensor */
+    std::size_t colSize () const { return product( cols_ ); }
+
+    /** \brief compute \f$y = (A_0 \otimes \dots \otimes A_{dim-1})\, x\f$
+     *
+     *  \param[in]   matrices  pointers to the row-wise stored matrices \f$A_k\f$
+     *  \param[in]   x         input tensor of size colSize()
+     *  \param[out]  y         output tensor of size rowSize()
+     */
+    void apply ( const std::array< const T *, dim > &matrices, const T *x, T *y ) const
+    {
+      contract( matrices, cols_, rows_, false, x, y );
+    }
+
+    /** \brief compute \f$x = (A_0 \otimes \dots \otimes A_{dim-1})^T\, y\f$
+     *
+     *  \param[in]   matrices  pointers to the row-wise stored matrices \f$A_k\f$
+     *  \param[in]   y         input tensor of size rowSize()
+     *  \param[out]  x         output tensor of size colSize()
+     */
+    void applyTransposed ( const std::array< const T *, dim > &matrices, const T *y, T *x ) const
+    {
+      contract( matrices, rows_, cols_, true, y, x );
+    }
+
+  private:
+    static std::size_t product ( const std::array< std::size_t, dim > &sizes )
+    {
+      std::size_t size = 1;
+      for( int k = 0; k < dim; ++k )
+        size *= sizes[ k ];
+      return size;
+    }
+
+    // contract direction by direction, mapping an in-tensor to an out-tensor
+    void contract ( const std::array< const T *, dim > &matrices,
+                    const std::array< std::size_t, dim > &in, const std::array< std::size_t, dim > &out,
+                    bool transposed, const T *x, T *y ) const
+    {
+      // current tensor has sizes out[ 0 ], ..., out[ k-1 ], in[ k ], ..., in[ dim-1 ]
+      std::size_t outer = 1, inner = product( in );
+      const T *src = x;
+      for( int k = 0; k < dim; ++k )
+      {
+        inner /= in[ k ];
+        T *dst = (k == dim-1 ? y : buffer_[ k % 2 ].data());
+        const T *A = matrices[ k ];
+        // row-wise matrix of size rows_[ k ] x cols_[ k ], applied directly or transposed
+        const std::size_t rowStride = (transposed ? 1 : cols_[ k ]);
+        const std::size_t colStride = (transposed ? cols_[ k ] : 1);
+        for( std::size_t o = 0; o < outer; ++o )
+        {
+          for( std::size_t i = 0; i < out[ k ]; ++i )
+          {
+            T *dstRow = dst + (o*out[ k ] + i)*inner;
+            for( std::size_t l = 0; l < inner; ++l )
+              dstRow[ l ] = T( 0 );
+            for( std::size_t j = 0; j < in[ k ]; ++j )
+            {
+              const T a = A[ i*rowStride + j*colStride ];
+              const T *srcRow = src + (o*in[ k ] + j)*inner;
+              for( std::size_t l = 0; l < inner; ++l )
+                dstRow[ l ] += a * srcRow[ l ];
+            }
+          }
+        }
+        outer *= out[ k ];
+        src = dst;
+      }
+    }
+
+    std::array< std::size_t, dim > rows_, cols_;
+    mutable std::array< std::vector< T >, 2 > buffer_;
+  };
+
+} // namespace Dune
+
+#endif // #ifndef DUNE_GEOMETRY_QUADRATURERULES_SUMFACTORIZATION_HH
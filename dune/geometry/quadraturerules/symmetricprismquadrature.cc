@@ -0,0 +1,149 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#include "config.h"
+#include "../quadraturerules.hh"
+
+// Fully symmetric quadrature rules for the prism
+//
+// Each orbit lists the barycentric coordinates of a point in the triangle
+// and its height z <= 1/2; the orbit consists of all distinct permutations
+// of the barycentric coordinates combined with the heights z and 1-z.  The
+// orbit structures were chosen as small as possible and the parameters were
+// obtained by a least squares fit of the moments of the prism invariant
+// polynomials, followed by a Newton iteration in extended precision.
+//
+// No fully symmetric rule of order 3 has less than 8 points.  The rule of
+// order 3 therefore uses a chiral orbit: the even permutations of the
+// barycentric coordinates at height z and the odd ones at height 1-z.  It is
+// the product of the six point triangle rule of Strang and Fix and the two
+// point Gauss rule, split between the two Gauss points.
+
+namespace Dune {
+
+  namespace Impl {
+
+    namespace {
+
+      // prism, order 1, 1 point
+      const SymmetricPrismQuadratureOrbit prismOrbits1[] = {
+        { 5.00000000000000000000e-1, { 3.33333333333333333333e-1, 3.33333333333333333333e-1, 3.33333333333333333333e-1 }, 5.00000000000000000000e-1 },
+      };
+
+      // prism, order 2, 5 points
+      const SymmetricPrismQuadratureOrbit prismOrbits2[] = {
+        { 1.81639671771999530609e-1, { 3.33333333333333333333e-1, 3.33333333333333333333e-1, 3.33333333333333333333e-1 }, 1.61332106020947986392e-1 },
+        { 4.55735521520003129276e-2, { 1.46079263812764269986e-2, 1.46079263812764269986e-2, 9.70784147237447146003e-1 }, 5.00000000000000000000e-1 },
+      };
+
+      // prism, order 3, 6 points (chiral, see above)
+      const SymmetricPrismQuadratureOrbit prismOrbits3[] = {
+        { 8.33333333333333333333e-2, { 1.09039009072877212325e-1, 2.31933368553030572497e-1, 6.59027622374092215178e-1 }, 2.11324865405187117745e-1 },
+      };
+
+      // prism, order 4, 11 points
+      const SymmetricPrismQuadratureOrbit prismOrbits4[] = {
+        { 5.39559874077677523945e-2, { 3.33333333333333333333e-1, 3.33333333333333333333e-1, 3.33333333333333333333e-1 }, 6.65690129954826007921e-2 },
+        { 6.82073063027388215327e-2, { 6.26883802760095754558e-2, 4.68655809861995212272e-1, 4.68655809861995212272e-1 }, 5.00000000000000000000e-1 },
+        { 3.12443510460413384355e-2, { 1.00740405798910636273e-1, 1.00740405798910636273e-1, 7.98519188402178727453e-1 }, 1.62180088158870141302e-1 },
+      };
+
+      // prism, order 5, 16 points
+      const SymmetricPrismQuadratureOrbit prismOrbits5[] = {
+        { 1.03571417174152882329e-1, { 3.33333333333333333333e-1, 3.33333333333333333333e-1, 3.33333333333333333333e-1 }, 5.00000000000000000000e-1 },
+        { 1.90377945154988221473e-2, { 5.17646178271647527403e-2, 5.17646178271647527403e-2, 8.96470764345670494519e-1 }, 5.00000000000000000000e-1 },
+        { 3.81871306961309521696e-2, { 1.66396769631117104815e-1, 1.66396769631117104815e-1, 6.67206460737765790370e-1 }, 9.64182568057780078889e-2 },
+        { 1.83654025170941563685e-2, { 4.67002083221593105664e-3, 4.97664989583892034472e-1, 4.97664989583892034472e-1 }, 3.01369162775169549598e-1 },
+      };
+
+      // prism, order 6, 28 points
+      const SymmetricPrismQuadratureOrbit prismOrbits6[] = {
+        { 2.97084463507915066174e-2, { 3.33333333333333333333e-1, 3.33333333333333333333e-1, 3.33333333333333333333e-1 }, 5.00000000000000000000e-1 },
+        { 2.47831159927542147697e-2, { 5.63840493458482642330e-2, 4.71807975327075867883e-1, 4.71807975327075867883e-1 }, 5.00000000000000000000e-1 },
+        { 3.61977931258268472125e-2, { 2.08467579498895612925e-1, 2.08467579498895612925e-1, 5.83064841002208774150e-1 }, 1.89142115175864620892e-1 },
+        { 8.75875956445670703935e-3, { 4.58899328137920574263e-2, 4.77055033593103971287e-1, 4.77055033593103971287e-1 }, 4.66133418815164651658e-3 },
+        { 9.54568353279565644611e-3, { 6.42120132978196091194e-2, 6.42120132978196091194e-2, 8.71575973404360781761e-1 }, 1.31318932916391617395e-1 },
+        { 1.14881313887450974810e-2, { 3.73781072156567496294e-3, 2.05219105088096435286e-1, 7.91043084190337889751e-1 }, 5.00000000000000000000e-1 },
+      };
+
+      // prism, order 7, 38 points
+      const SymmetricPrismQuadratureOrbit prismOrbits7[] = {
+        { 1.61585858608071680596e-2, { 3.33333333333333333333e-1, 3.33333333333333333333e-1, 3.33333333333333333333e-1 }, 2.10327639685291197810e-2 },
+        { 2.19629414736416816705e-3, { 1.60678394834661559765e-2, 1.60678394834661559765e-2, 9.67864321033067688047e-1 }, 2.75869352402659875566e-1 },
+        { 1.41710397440534909578e-2, { 1.07382804494258894180e-1, 1.07382804494258894180e-1, 7.85234391011482211640e-1 }, 8.81009368484602236819e-2 },
+        { 9.35405086339886375957e-3, { 2.40720917495725920816e-2, 4.87963954125213703959e-1, 4.87963954125213703959e-1 }, 8.32600388749045250955e-2 },
+        { 1.28722421194042269247e-2, { 1.48789001447794720345e-2, 2.22182893833914489688e-1, 7.62938206021306038277e-1 }, 5.00000000000000000000e-1 },
+        { 1.96767555860884304189e-2, { 1.45061253435109782839e-1, 3.17777694387359207679e-1, 5.37161052177531009482e-1 }, 3.00284793049276398443e-1 },
+      };
+
+      // prism, order 8, 50 points
+      const SymmetricPrismQuadratureOrbit prismOrbits8[] = {
+        { 8.71209062983393181719e-3, { 3.33333333333333333333e-1, 3.33333333333333333333e-1, 3.33333333333333333333e-1 }, 3.81434146459516153054e-1 },
+        { 1.78405011761943067037e-2, { 1.28351335685880305979e-1, 1.28351335685880305979e-1, 7.43297328628239388042e-1 }, 5.00000000000000000000e-1 },
+        { 2.40916697612308979866e-2, { 6.83269215512806296389e-2, 4.65836539224359685181e-1, 4.65836539224359685181e-1 }, 5.00000000000000000000e-1 },
+        { 8.17238543475459921902e-3, { 2.15378165298649193535e-1, 2.15378165298649193535e-1, 5.69243669402701612931e-1 }, 3.65848132819528890178e-2 },
+        { 1.91353045272449255000e-2, { 2.43942118048661330785e-1, 2.43942118048661330785e-1, 5.12115763902677338430e-1 }, 2.39577124032915923352e-1 },
+        { 2.84392919875544027456e-3, { 2.96220430639021914615e-2, 2.96220430639021914615e-2, 9.40755913872195617077e-1 }, 3.26321333056220747781e-1 },
+        { 3.73952809463060883827e-3, { 6.70634813621739731974e-2, 6.70634813621739731974e-2, 8.65873037275652053605e-1 }, 4.04576904010037780853e-2 },
+        { 8.05356333334448555293e-3, { 5.51143878546008296811e-2, 4.72442806072699585159e-1, 4.72442806072699585159e-1 }, 6.62139448515225134276e-2 },
+        { 8.75925353297301383217e-3, { 2.56231837334773294368e-2, 2.37550307659277172643e-1, 7.36826508607245497920e-1 }, 2.11324865405187117745e-1 },
+      };
+
+      // prism, order 9, 66 points
+      const SymmetricPrismQuadratureOrbit prismOrbits9[] = {
+        { 2.55780698713653248489e-3, { 2.14888071037547181216e-2, 2.14888071037547181216e-2, 9.57022385792490563757e-1 }, 5.00000000000000000000e-1 },
+        { 1.45967038584387278531e-2, { 2.40423933625861289984e-1, 3.79788033187069355008e-1, 3.79788033187069355008e-1 }, 5.00000000000000000000e-1 },
+        { 1.24114971974526477764e-2, { 2.76648386016220269548e-2, 4.86167580699188986523e-1, 4.86167580699188986523e-1 }, 5.00000000000000000000e-1 },
+        { 1.39694371190539982856e-2, { 1.32393684094153116783e-1, 1.32393684094153116783e-1, 7.35212631811693766433e-1 }, 5.00000000000000000000e-1 },
+        { 7.45097094825795440533e-3, { 2.13964098609897627439e-1, 3.93017950695051186281e-1, 3.93017950695051186281e-1 }, 6.77968613431237907457e-2 },
+        { 3.73280841470077567256e-3, { 1.55834156952748952596e-1, 1.55834156952748952596e-1, 6.88331686094502094807e-1 }, 7.11425464528650642253e-3 },
+        { 4.13848669500864329070e-3, { 5.33560613545457852774e-2, 5.33560613545457852774e-2, 8.93287877290908429445e-1 }, 9.32270424368201708952e-2 },
+        { 5.41236959973220763756e-3, { 2.10903792495886450560e-2, 1.88311550813040393690e-1, 7.90598069937370961254e-1 }, 2.78073778573416718518e-1 },
+        { 4.18880136435870409558e-3, { 2.98124902658737411417e-2, 3.46043239435338823344e-1, 6.24144270298787435514e-1 }, 6.71352530458068889306e-2 },
+        { 1.35205013830715916492e-2, { 1.27772739787990863341e-1, 3.04765161442517719063e-1, 5.67462098769491417597e-1 }, 2.37863247903496263753e-1 },
+      };
+
+      // prism, order 10, 94 points
+      const SymmetricPrismQuadratureOrbit prismOrbits10[] = {
+        { 1.62880014729731918650e-2, { 3.33333333333333333333e-1, 3.33333333333333333333e-1, 3.33333333333333333333e-1 }, 5.00000000000000000000e-1 },
+        { 6.42166814939520345821e-3, { 1.04942994778049774583e-2, 4.94752850261097511271e-1, 4.94752850261097511271e-1 }, 5.00000000000000000000e-1 },
+        { 9.87660837287390717084e-3, { 2.11935553640225613779e-1, 3.94032223179887193111e-1, 3.94032223179887193111e-1 }, 1.66319233012321461415e-1 },
+        { 5.57295521586111018105e-3, { 1.26940989825333569251e-1, 1.26940989825333569251e-1, 7.46118020349332861499e-1 }, 3.85077749345731924720e-1 },
+        { 4.83718477715663361326e-3, { 5.14827377776191450797e-2, 4.74258631111190427460e-1, 4.74258631111190427460e-1 }, 4.80505731880805048736e-2 },
+        { 2.29011775469917578184e-3, { 3.30839801032015418315e-2, 3.30839801032015418315e-2, 9.33832039793596916337e-1 }, 2.89610258053944507770e-1 },
+        { 1.05219520435233826546e-3, { 3.12240626785786401493e-2, 3.12240626785786401493e-2, 9.37551874642842719701e-1 }, 8.05001155799189771712e-2 },
+        { 6.36939527140272718923e-3, { 2.20747538838716001954e-1, 2.20747538838716001954e-1, 5.58504922322567996092e-1 }, 3.03275966167003169040e-2 },
+        { 6.06465195372129080562e-3, { 1.09704954928428300014e-1, 1.09704954928428300014e-1, 7.80590090143143399972e-1 }, 1.10994975165102498643e-1 },
+        { 7.02208499799022211933e-3, { 3.92580380538167990795e-2, 2.97300658081533362361e-1, 6.63441303864649838560e-1 }, 1.95792770813441212648e-1 },
+        { 1.04219969077077476409e-2, { 1.32819143737127659638e-1, 3.12954392466722511466e-1, 5.54226463796149828896e-1 }, 3.58457180646506644981e-1 },
+        { 8.72971867296526200169e-4, { 5.63783480523276076280e-3, 1.81890324399347318166e-1, 8.12471840795419921071e-1 }, 8.79520988505578237648e-3 },
+        { 2.35530812520867901597e-3, { 1.31886948273366097267e-2, 1.56523282150291522700e-1, 8.30288023022371867573e-1 }, 4.13466931794404316763e-1 },
+      };
+
+      const SymmetricPrismQuadratureTable prismTables[] = {
+        { 1, 1, 1, prismOrbits1, false }, // p = 0
+        { 1, 1, 1, prismOrbits1, false }, // p = 1
+        { 2, 5, 2, prismOrbits2, false }, // p = 2
+        { 3, 6, 1, prismOrbits3, true }, // p = 3
+        { 4, 11, 3, prismOrbits4, false }, // p = 4
+        { 5, 16, 4, prismOrbits5, false }, // p = 5
+        { 6, 28, 6, prismOrbits6, false }, // p = 6
+        { 7, 38, 6, prismOrbits7, false }, // p = 7
+        { 8, 50, 9, prismOrbits8, false }, // p = 8
+        { 9, 66, 10, prismOrbits9, false }, // p = 9
+        { 10, 94, 13, prismOrbits10, false }, // p = 10
+      };
+
+    } // anonymous namespace
+
+    const SymmetricPrismQuadratureTable *symmetricPrismQuadratureTable ( int p )
+    {
+      if( p < 0 )
+        p = 0;
+      if( p <= 10 )
+        return &prismTables[ p ];
+      return nullptr;
+    }
+
+  } // namespace Impl
+
+} // namespace Dune
@@ -0,0 +1,137 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_QUADRATURERULES_SYMMETRICPRISMQUADRATURE_HH
+#define DUNE_GEOMETRY_QUADRATURERULES_SYMMETRICPRISMQUADRATURE_HH
+
+#include <algorithm>
+#include <array>
+
+namespace Dune {
+
+  namespace Impl {
+
+    /** \brief orbit of a fully symmetric quadrature rule on the prism
+     *
+     *  The orbit consists of the points with all distinct permutations of the
+     *  barycentric coordinates \c lambda on the triangle and the heights
+     *  \c z and 1-z (with \c z <= 1/2), all points carrying the same
+     *  \c weight.
+     */
+    struct SymmetricPrismQuadratureOrbit
+    {
+      double weight;
+      double lambda[3];
+      double z;
+    };
+
+    /** \brief table of a fully symmetric quadrature rule on the prism
+     *
+     *  If \c chiral is set, each orbit consists of the even permutations of
+     *  the barycentric coordinates at height \c z and the odd permutations
+     *  at height 1-z only.
+     */
+    struct SymmetricPrismQuadratureTable
+    {
+      int order;
+      int size;
+      int numOrbits;
+      const SymmetricPrismQuadratureOrbit *orbits;
+      bool chiral;
+    };
+
+    /** \brief obtain the symmetric prism rule of lowest order >= p
+     *
+     *  Returns \c nullptr if p exceeds the highest available order.
+     */
+    const SymmetricPrismQuadratureTable *symmetricPrismQuadratureTable ( int p );
+
+  } // namespace Impl
+
+  /************************************************
+   * Fully symmetric quadrature rules for prisms
+   *************************************************/
+
+  /** \brief Fully symmetric quadrature rules for prisms
+      \ingroup Quadrature
+   */
+  template<typename ct, int dim>
+  class SymmetricPrismQuadratureRule;
+
+  /** \brief Fully symmetric quadrature rules for prisms
+      \ingroup Quadrature
+
+      These rules are invariant under all symmetries of the prism, have
+      positive weights only, and all points lie in the interior of the
+      prism.  The rule of order 3 is the exception: it needs 6 instead of 8
+      points by being invariant under the rotations of the triangle and the
+      reflections of the triangle combined with the reflection z -> 1-z
+      only.  They are not tensor products of a triangle and a line rule and
+      need considerably fewer points than those, e.g., 94 instead of 150
+      points for order 10.  They are selected by QuadratureType::Symmetric.
+   */
+  template<typename ct>
+  class SymmetricPrismQuadratureRule<ct,3> : public QuadratureRule<ct,3>
+  {
+  public:
+    /** \brief The space dimension */
+    enum { d = 3 };
+
+    /** \brief The highest quadrature order available */
+    enum { highest_order = 10 };
+
+  private:
+    friend class QuadratureRuleFactory<ct,d>;
+    SymmetricPrismQuadratureRule (int p) : QuadratureRule<ct,3>(GeometryType(GeometryType::prism, d))
+    {
+      const Impl::SymmetricPrismQuadratureTable *table = Impl::symmetricPrismQuadratureTable(p);
+      if (!table)
+        DUNE_THROW(QuadratureOrderOutOfRange,
+                   "QuadratureRule for order " << p << " and GeometryType "
+                                               << this->type() << " not available");
+      this->delivered_order = table->order;
+
+      this->reserve(table->size);
+      for (int o=0; o<table->numOrbits; ++o)
+      {
+        const Impl::SymmetricPrismQuadratureOrbit &orbit = table->orbits[o];
+
+        if (table->chiral)
+        {
+          const double *lambda = orbit.lambda;
+          for (int k=0; k<3; ++k)
+          {
+            FieldVector<ct,3> local;
+            local[0] = lambda[(k+1)%3];
+            local[1] = lambda[(k+2)%3];
+            local[2] = orbit.z;
+            this->push_back(QuadraturePoint<ct,d>(local, orbit.weight));
+            local[0] = lambda[(k+2)%3];
+            local[1] = lambda[(k+1)%3];
+            local[2] = ct(1) - ct(orbit.z);
+            this->push_back(QuadraturePoint<ct,d>(local, orbit.weight));
+          }
+          continue;
+        }
+
+        std::array<double,3> lambda = {{ orbit.lambda[0], orbit.lambda[1], orbit.lambda[2] }};
+        std::sort(lambda.begin(), lambda.end());
+        do {
+          FieldVector<ct,3> local;
+          local[0] = lambda[1];
+          local[1] = lambda[2];
+          local[2] = orbit.z;
+          this->push_back(QuadraturePoint<ct,d>(local, orbit.weight));
+          if (orbit.z < 0.5)
+          {
+            local[2] = ct(1) - ct(orbit.z);
+            this->push_back(QuadraturePoint<ct,d>(local, orbit.weight));
+          }
+        } while (std::next_permutation(lambda.begin(), lambda.end()));
+      }
+      assert(this->size() == std::size_t(table->size));
+    }
+  };
+
+} // end namespace Dune
+
+#endif // DUNE_GEOMETRY_QUADRATURERULES_SYMMETRICPRISMQUADRATURE_HH
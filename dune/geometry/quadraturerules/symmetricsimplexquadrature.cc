@@ -0,0 +1,387 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#include "config.h"
+#include "../quadraturerules.hh"
+
+// Fully symmetric quadrature rules for triangles and tetrahedra
+//
+// Each rule is given by the orbits of its points: an orbit consists of all
+// distinct permutations of the given barycentric coordinates, each point
+// carrying the given weight (the weights sum up to the volume of the
+// reference simplex).  The rules were obtained by solving the moment
+// equations with respect to an orthonormal polynomial basis, starting from
+// random initial guesses for a prescribed orbit structure, and only rules
+// with positive weights and interior points were kept.  The point counts
+// match or come close to the ones reported by F.D. Witherden, P.E. Vincent,
+// On the identification of symmetric quadrature rules for finite element
+// methods, Comput. Math. Appl. 69 (2015).
+//
+// Each rule was then refined by Newton's method on the monomial moment
+// equations in 60-digit arithmetic until the residual dropped below 1e-60.
+// The values below are the refined ones correctly rounded to double and
+// printed with the shortest decimal representation that reads back to the
+// same double, so they carry no digits beyond double precision.
+
+namespace Dune {
+
+  namespace Impl {
+
+    namespace {
+
+      // triangle, order 1, 1 point
+      const SymmetricQuadratureOrbit triangleOrbits1[] = {
+        { 0.5, { 0.3333333333333333, 0.3333333333333333, 0.3333333333333333 } },
+      };
+
+      // triangle, order 2, 3 points
+      const SymmetricQuadratureOrbit triangleOrbits2[] = {
+        { 0.16666666666666666, { 0.16666666666666666, 0.16666666666666666, 0.6666666666666666 } },
+      };
+
+      // triangle, order 4, 6 points
+      const SymmetricQuadratureOrbit triangleOrbits4[] = {
+        { 0.054975871827660935, { 0.09157621350977074, 0.09157621350977074, 0.8168475729804585 } },
+        { 0.11169079483900574, { 0.4459484909159649, 0.4459484909159649, 0.10810301816807023 } },
+      };
+
+      // triangle, order 5, 7 points
+      const SymmetricQuadratureOrbit triangleOrbits5[] = {
+        { 0.1125, { 0.3333333333333333, 0.3333333333333333, 0.3333333333333333 } },
+        { 0.0661970763942531, { 0.4701420641051151, 0.4701420641051151, 0.05971587178976982 } },
+        { 0.06296959027241357, { 0.10128650732345634, 0.10128650732345634, 0.7974269853530873 } },
+      };
+
+      // triangle, order 6, 12 points
+      const SymmetricQuadratureOrbit triangleOrbits6[] = {
+        { 0.02542245318510341, { 0.06308901449150223, 0.06308901449150223, 0.8738219710169955 } },
+        { 0.058393137863189684, { 0.24928674517091043, 0.24928674517091043, 0.5014265096581791 } },
+        { 0.041425537809186785, { 0.3103524510337844, 0.053145049844816945, 0.6365024991213987 } },
+      };
+
+      // triangle, order 7, 15 points
+      const SymmetricQuadratureOrbit triangleOrbits7[] = {
+        { 0.026538900895116208, { 0.06493051315916486, 0.06493051315916486, 0.8701389736816703 } },
+        { 0.03463734103970845, { 0.043863471792372474, 0.642577343822696, 0.3135591843849315 } },
+        { 0.035426541846066785, { 0.517039939069323, 0.28457558424917034, 0.19838447668150672 } },
+      };
+
+      // triangle, order 8, 16 points
+      const SymmetricQuadratureOrbit triangleOrbits8[] = {
+        { 0.07215780383889359, { 0.3333333333333333, 0.3333333333333333, 0.3333333333333333 } },
+        { 0.04754581713364231, { 0.4592925882927232, 0.4592925882927232, 0.0814148234145537 } },
+        { 0.05160868526735912, { 0.1705693077517602, 0.1705693077517602, 0.6588613844964796 } },
+        { 0.01622924881159904, { 0.05054722831703098, 0.05054722831703098, 0.8989055433659381 } },
+        { 0.013615157087217496, { 0.7284923929554042, 0.2631128296346381, 0.008394777409957605 } },
+      };
+
+      // triangle, order 9, 19 points
+      const SymmetricQuadratureOrbit triangleOrbits9[] = {
+        { 0.04856789814139942, { 0.3333333333333333, 0.3333333333333333, 0.3333333333333333 } },
+        { 0.039823869463605124, { 0.18820353561903272, 0.18820353561903272, 0.6235929287619345 } },
+        { 0.015667350113569536, { 0.4896825191987376, 0.4896825191987376, 0.020634961602524746 } },
+        { 0.03891377050238714, { 0.43708959149293664, 0.43708959149293664, 0.12582081701412673 } },
+        { 0.012788837829349016, { 0.04472951339445271, 0.04472951339445271, 0.9105409732110946 } },
+        { 0.021641769688644688, { 0.741198598784498, 0.036838412054736286, 0.2219629891607657 } },
+      };
+
+      // triangle, order 10, 25 points
+      const SymmetricQuadratureOrbit triangleOrbits10[] = {
+        { 0.03994725237061986, { 0.3333333333333333, 0.3333333333333333, 0.3333333333333333 } },
+        { 0.03556190111618867, { 0.42508621060209056, 0.42508621060209056, 0.14982757879581884 } },
+        { 0.004111909345232098, { 0.023308867510000192, 0.023308867510000192, 0.9533822649799997 } },
+        { 0.018679928117152637, { 0.6113138261813976, 0.3587401418644315, 0.029946031954170886 } },
+        { 0.02271529614808501, { 0.6283074002134925, 0.223766973576973, 0.14792562620953445 } },
+        { 0.015443328442281995, { 0.14329537042686716, 0.035632559587503485, 0.8210720699856294 } },
+      };
+
+      // triangle, order 11, 28 points
+      const SymmetricQuadratureOrbit triangleOrbits11[] = {
+        { 0.042630695296297025, { 0.3333333333333333, 0.3333333333333333, 0.3333333333333333 } },
+        { 0.035085625178550274, { 0.21080346041497497, 0.21080346041497497, 0.5783930791700501 } },
+        { 0.033422721601781384, { 0.43832254337948284, 0.43832254337948284, 0.12335491324103433 } },
+        { 0.01939519885942656, { 0.10419186712220099, 0.10419186712220099, 0.791616265755598 } },
+        { 0.005360062491660628, { 0.02887942137677721, 0.02887942137677721, 0.9422411572464455 } },
+        { 0.008056096194567052, { 0.4961915128867643, 0.4961915128867643, 0.0076169742264714764 } },
+        { 0.005441237736407414, { 0.15082330564704954, 0.840678483262529, 0.008498211090421376 } },
+        { 0.020127127551216803, { 0.2922337553833924, 0.6615254654116863, 0.046240779204921256 } },
+      };
+
+      // triangle, order 12, 33 points
+      const SymmetricQuadratureOrbit triangleOrbits12[] = {
+        { 0.03127060659795138, { 0.2714625070149261, 0.2714625070149261, 0.45707498597014784 } },
+        { 0.02495916746403047, { 0.4401116486585931, 0.4401116486585931, 0.11977670268281378 } },
+        { 0.014243026034438772, { 0.1092578276593543, 0.1092578276593543, 0.7814843446812915 } },
+        { 0.0039658212549868194, { 0.024646363436335594, 0.024646363436335594, 0.9507072731273288 } },
+        { 0.012133419040726016, { 0.4882037509455415, 0.4882037509455415, 0.023592498108916896 } },
+        { 0.01089179251930378, { 0.02303415635526714, 0.6853101639063919, 0.29165567973834094 } },
+        { 0.021613681829707104, { 0.628249751683556, 0.11629601967792659, 0.25545422863851736 } },
+        { 0.007541838788255719, { 0.85133779251024, 0.12727971723358936, 0.02138249025617059 } },
+      };
+
+      // triangle, order 13, 37 points
+      const SymmetricQuadratureOrbit triangleOrbits13[] = {
+        { 0.026207004775524716, { 0.3333333333333333, 0.3333333333333333, 0.3333333333333333 } },
+        { 0.005633875997159071, { 0.49506371739043287, 0.49506371739043287, 0.009872565219134299 } },
+        { 0.003989513879682993, { 0.02481658821257948, 0.02481658821257948, 0.950366823574841 } },
+        { 0.023643042287736206, { 0.22947653125317338, 0.22947653125317338, 0.5410469374936533 } },
+        { 0.015748522410662925, { 0.46868372741299735, 0.46868372741299735, 0.06263254517400528 } },
+        { 0.015576503471376879, { 0.11437447874892102, 0.11437447874892102, 0.7712510425021579 } },
+        { 0.02351763593740449, { 0.4144535541229538, 0.4144535541229538, 0.1710928917540924 } },
+        { 0.018432361861999747, { 0.26868255872278296, 0.09501374983665413, 0.636303691440563 } },
+        { 0.0077570836405345105, { 0.12638329293957556, 0.8513992809462372, 0.022217426114187224 } },
+        { 0.008721506709533677, { 0.6900964913495101, 0.018152418264840525, 0.29175109038564934 } },
+      };
+
+      // triangle, order 14, 42 points
+      const SymmetricQuadratureOrbit triangleOrbits14[] = {
+        { 0.016394176772062674, { 0.41764471934045394, 0.41764471934045394, 0.16471056131909215 } },
+        { 0.010941790684714445, { 0.4889639103621786, 0.4889639103621786, 0.02207217927564272 } },
+        { 0.021081294368496508, { 0.17720553241254344, 0.17720553241254344, 0.6455889351749131 } },
+        { 0.007216849834888334, { 0.0617998830908726, 0.0617998830908726, 0.8764002338182548 } },
+        { 0.002461701801200041, { 0.019390961248701048, 0.019390961248701048, 0.9612180775025979 } },
+        { 0.025887052253645793, { 0.27347752830883865, 0.27347752830883865, 0.4530449433823227 } },
+        { 0.012332876606281837, { 0.17226668782135557, 0.7706085547749965, 0.05712475740364794 } },
+        { 0.00721815405676692, { 0.01464695005565441, 0.6869801678080878, 0.29837288213625773 } },
+        { 0.019285755393530342, { 0.336861459796345, 0.5702222908466832, 0.09291624935697182 } },
+        { 0.002505114419250336, { 0.001268330932872025, 0.11897449769695685, 0.8797571713701712 } },
+      };
+
+      // triangle, order 15, 49 points
+      const SymmetricQuadratureOrbit triangleOrbits15[] = {
+        { 0.02477738074303558, { 0.3333333333333333, 0.3333333333333333, 0.3333333333333333 } },
+        { 0.009243394302330774, { 0.07903101365554163, 0.07903101365554163, 0.8419379726889167 } },
+        { 0.0022485768962175402, { 0.018789501810770076, 0.018789501810770076, 0.9624209963784598 } },
+        { 0.006705258190006415, { 0.4925016882324967, 0.4925016882324967, 0.01499662353500659 } },
+        { 0.01901138172693058, { 0.4088631690774411, 0.4088631690774411, 0.18227366184511787 } },
+        { 0.015087322572773133, { 0.20250549804829998, 0.09876591135571211, 0.6987285905959879 } },
+        { 0.0032209366452594663, { 0.8951462452879488, 0.09229015842426617, 0.012563596287784997 } },
+        { 0.01460544538747189, { 0.1941262036877463, 0.26709528567005225, 0.5387785106422014 } },
+        { 0.00618080860857782, { 0.7834502256732081, 0.02159462843398026, 0.19495514589281163 } },
+        { 0.00587473732425697, { 0.015082654870922784, 0.32515745241110783, 0.6597598927179694 } },
+        { 0.015630213780078804, { 0.3688394837485754, 0.5534967491871164, 0.07766376706430816 } },
+      };
+
+      // triangle, order 16, 55 points
+      const SymmetricQuadratureOrbit triangleOrbits16[] = {
+        { 0.022668082505910087, { 0.3333333333333333, 0.3333333333333333, 0.3333333333333333 } },
+        { 0.008404306071481859, { 0.0854025394079332, 0.0854025394079332, 0.8291949211841336 } },
+        { 0.012997715227338367, { 0.45669426695387466, 0.45669426695387466, 0.08661146609225072 } },
+        { 0.0010850949634049747, { 0.012425572001444092, 0.012425572001444092, 0.9751488559971118 } },
+        { 0.007225277337542364, { 0.4917483834189159, 0.4917483834189159, 0.01650323316216812 } },
+        { 0.020054466616677716, { 0.19177327270918176, 0.48506759880447436, 0.32315912848634387 } },
+        { 0.005835586168623432, { 0.014160772533794792, 0.6612991922259872, 0.324540035240218 } },
+        { 0.009129118555048445, { 0.1903779316017863, 0.7383433055660659, 0.07127876283214786 } },
+        { 0.004741131439680423, { 0.8073889159808434, 0.014539694958941855, 0.17807138906021477 } },
+        { 0.009729984160041701, { 0.20622099278664205, 0.640363470419211, 0.15341553679414688 } },
+        { 0.003556861404094715, { 0.07127004615948627, 0.016623223223705793, 0.9121067306168079 } },
+        { 0.011651974438298103, { 0.6019550183082784, 0.07429547899133068, 0.32374950270039093 } },
+      };
+
+      // triangle, order 17, 60 points
+      const SymmetricQuadratureOrbit triangleOrbits17[] = {
+        { 0.011604751852788817, { 0.46547829013751074, 0.46547829013751074, 0.06904341972497852 } },
+        { 0.0016123504958315883, { 0.01575203052674741, 0.01575203052674741, 0.9684959389465052 } },
+        { 0.01150862788204065, { 0.1557754114388988, 0.1557754114388988, 0.6884491771222024 } },
+        { 0.005564607807498523, { 0.49334173048712204, 0.49334173048712204, 0.013316539025755891 } },
+        { 0.01625575118938235, { 0.4178785953256231, 0.4178785953256231, 0.16424280934875377 } },
+        { 0.01835391892274793, { 0.28664906339088864, 0.28664906339088864, 0.4267018732182228 } },
+        { 0.003233898376584428, { 0.014312879374372443, 0.08068478097917814, 0.9050023396464494 } },
+        { 0.003673821650433868, { 0.08306964905605355, 0.8491076417832137, 0.06782270916073271 } },
+        { 0.014722914558051088, { 0.27671624167335657, 0.1620315381043892, 0.5612522202222543 } },
+        { 0.004104601644821997, { 0.19052921389430058, 0.7970084838880126, 0.012462302217686797 } },
+        { 0.005307903547073386, { 0.6535756361114562, 0.013496404156673166, 0.33292795973187067 } },
+        { 0.010917929843475688, { 0.3165173396312978, 0.06918690165719085, 0.6142957587115113 } },
+        { 0.00892225963774795, { 0.18312394619398628, 0.06530991151241322, 0.7515661422936005 } },
+      };
+
+      // triangle, order 18, 67 points
+      const SymmetricQuadratureOrbit triangleOrbits18[] = {
+        { 0.018177867650713334, { 0.3333333333333333, 0.3333333333333333, 0.3333333333333333 } },
+        { 0.016652235016695067, { 0.39995562806757623, 0.39995562806757623, 0.20008874386484754 } },
+        { 0.0035646630098594852, { 0.038830256088685594, 0.038830256088685594, 0.9223394878226288 } },
+        { 0.01823754470447182, { 0.24226470251427196, 0.24226470251427196, 0.5154705949714561 } },
+        { 0.008279579976001624, { 0.0919477421216432, 0.0919477421216432, 0.8161045157567136 } },
+        { 0.0060233238169998555, { 0.48758030157486953, 0.48758030157486953, 0.024839396850260875 } },
+        { 0.009474585753389433, { 0.46180950640644924, 0.46180950640644924, 0.07638098718710154 } },
+        { 0.0006114740634805449, { 0.000548360042042319, 0.027090910995162015, 0.9723607289627957 } },
+        { 0.006879808117471103, { 0.183822707925464, 0.04580491585986078, 0.7703723762146752 } },
+        { 0.011890955450076415, { 0.20634925743383795, 0.12269675737192755, 0.6709539851942345 } },
+        { 0.002505330437289861, { 0.005298335186609765, 0.23577218495819174, 0.7589294798551985 } },
+        { 0.01274108765591222, { 0.12058769516392465, 0.5459187753861946, 0.33349352944988075 } },
+        { 0.0022652672511285325, { 0.0038976110334733825, 0.6004189546342569, 0.3956834343322697 } },
+        { 0.008873744551010202, { 0.31975162452537736, 0.6399880920047146, 0.040260283469908065 } },
+        { 0.003420055059803591, { 0.8783421894675217, 0.013462016741444989, 0.10819579379103329 } },
+      };
+
+      // triangle, order 19, 73 points
+      const SymmetricQuadratureOrbit triangleOrbits19[] = {
+        { 0.016389270764151698, { 0.3333333333333333, 0.3333333333333333, 0.3333333333333333 } },
+        { 0.005193815140192187, { 0.48930597161138933, 0.48930597161138933, 0.021388056777221384 } },
+        { 0.015197552407836396, { 0.2556934862410723, 0.2556934862410723, 0.4886130275178554 } },
+        { 0.01508724993746865, { 0.40130209333567357, 0.40130209333567357, 0.1973958133286528 } },
+        { 0.0010350371993915045, { 0.01259361912549841, 0.01259361912549841, 0.9748127617490032 } },
+        { 0.004050365578658763, { 0.05576742795768795, 0.05576742795768795, 0.8884651440846241 } },
+        { 0.00806008904654626, { 0.10989250665735825, 0.10989250665735825, 0.7802149866852836 } },
+        { 0.01206681662982024, { 0.17723978972827797, 0.17723978972827797, 0.645520420543444 } },
+        { 0.011192888966154581, { 0.45437259092750704, 0.45437259092750704, 0.09125481814498596 } },
+        { 0.0011624975383857745, { 0.8401113106958893, 0.15768295070324603, 0.0022057386008646333 } },
+        { 0.009129447638104096, { 0.7012896851592862, 0.07529209130277514, 0.22341822353793864 } },
+        { 0.012768115846201585, { 0.13475852635214153, 0.5573539760299171, 0.30788749761794143 } },
+        { 0.005166931994052451, { 0.14299356522745008, 0.033946126221140877, 0.8230603085514091 } },
+        { 0.0019119732037876378, { 0.9244124306806933, 0.06532112213804527, 0.010266447181261438 } },
+        { 0.00807157024034307, { 0.35772826851469, 0.5949618578594532, 0.04730987362585677 } },
+        { 0.0019958313227814726, { 0.003805268768663229, 0.39713721487357606, 0.5990575163577607 } },
+        { 0.004453512969284339, { 0.2647787158981709, 0.014390463887017778, 0.7208308202148113 } },
+      };
+
+      // triangle, order 20, 81 points
+      const SymmetricQuadratureOrbit triangleOrbits20[] = {
+        { 0.006002222479505564, { 0.45603763652099305, 0.45603763652099305, 0.08792472695801393 } },
+        { 0.0009450235020153004, { 0.03607824221323349, 0.03607824221323349, 0.9278435155735331 } },
+        { 0.004509226781120108, { 0.4938429001563867, 0.4938429001563867, 0.012314199687226607 } },
+        { 0.01220136341638809, { 0.25120559900746303, 0.25120559900746303, 0.49758880198507394 } },
+        { 9.92113622217508e-05, { 2.9880587495631457e-11, 2.9880587495631457e-11, 0.9999999999402388 } },
+        { 0.009360559817856265, { 0.19512986867274487, 0.19512986867274487, 0.6097402626545102 } },
+        { 0.004826553378715697, { 0.06498816709711211, 0.06498816709711211, 0.8700236658057758 } },
+        { 0.014918116131878644, { 0.3735650108868082, 0.3735650108868082, 0.2528699782263836 } },
+        { 0.008457967819235893, { 0.13198888620719584, 0.13198888620719584, 0.7360222275856083 } },
+        { 0.006386866741029827, { 0.7889583234026789, 0.05517043852214969, 0.15587123807517145 } },
+        { 0.0027845145800417825, { 0.012481180213539769, 0.8812301133055248, 0.10628870648093537 } },
+        { 0.0011467309503525648, { 0.956007911296087, 0.008300342126279222, 0.035691746577633826 } },
+        { 0.0031466626042182173, { 0.35142248317478203, 0.008319675948799283, 0.6402578408764187 } },
+        { 0.008120061072598323, { 0.5596679347774289, 0.053112750912791225, 0.38721931430977985 } },
+        { 0.002661038223647296, { 0.7805972177125636, 0.008317549385357078, 0.21108523290207934 } },
+        { 0.0054466590374826675, { 0.6941766601558512, 0.03929365703745345, 0.2665296828066953 } },
+        { 0.010146965810051095, { 0.10541218375992671, 0.6405658855604609, 0.2540219306796124 } },
+        { 0.012833711969442907, { 0.14960400454757292, 0.3511220035638374, 0.49927399188858973 } },
+      };
+
+      const SymmetricQuadratureTable triangleTables[] = {
+        { 1, 1, 1, triangleOrbits1 }, // p = 0
+        { 1, 1, 1, triangleOrbits1 }, // p = 1
+        { 2, 3, 1, triangleOrbits2 }, // p = 2
+        { 4, 6, 2, triangleOrbits4 }, // p = 3
+        { 4, 6, 2, triangleOrbits4 }, // p = 4
+        { 5, 7, 3, triangleOrbits5 }, // p = 5
+        { 6, 12, 3, triangleOrbits6 }, // p = 6
+        { 7, 15, 3, triangleOrbits7 }, // p = 7
+        { 8, 16, 5, triangleOrbits8 }, // p = 8
+        { 9, 19, 6, triangleOrbits9 }, // p = 9
+        { 10, 25, 6, triangleOrbits10 }, // p = 10
+        { 11, 28, 8, triangleOrbits11 }, // p = 11
+        { 12, 33, 8, triangleOrbits12 }, // p = 12
+        { 13, 37, 10, triangleOrbits13 }, // p = 13
+        { 14, 42, 10, triangleOrbits14 }, // p = 14
+        { 15, 49, 11, triangleOrbits15 }, // p = 15
+        { 16, 55, 12, triangleOrbits16 }, // p = 16
+        { 17, 60, 13, triangleOrbits17 }, // p = 17
+        { 18, 67, 15, triangleOrbits18 }, // p = 18
+        { 19, 73, 17, triangleOrbits19 }, // p = 19
+        { 20, 81, 18, triangleOrbits20 }, // p = 20
+      };
+
+      // tetrahedron, order 1, 1 point
+      const SymmetricQuadratureOrbit tetrahedronOrbits1[] = {
+        { 0.16666666666666666, { 0.25, 0.25, 0.25, 0.25 } },
+      };
+
+      // tetrahedron, order 2, 4 points
+      const SymmetricQuadratureOrbit tetrahedronOrbits2[] = {
+        { 0.041666666666666664, { 0.1381966011250105, 0.1381966011250105, 0.1381966011250105, 0.5854101966249684 } },
+      };
+
+      // tetrahedron, order 3, 8 points
+      const SymmetricQuadratureOrbit tetrahedronOrbits3[] = {
+        { 0.019434633454366593, { 0.32958521879405295, 0.32958521879405295, 0.32958521879405295, 0.011244343617841207 } },
+        { 0.02223203321230007, { 0.11624531150367312, 0.11624531150367312, 0.11624531150367312, 0.6512640654889806 } },
+      };
+
+      // tetrahedron, order 5, 14 points
+      const SymmetricQuadratureOrbit tetrahedronOrbits5[] = {
+        { 0.018781320953002643, { 0.3108859192633006, 0.3108859192633006, 0.3108859192633006, 0.06734224221009817 } },
+        { 0.012248840519393659, { 0.09273525031089122, 0.09273525031089122, 0.09273525031089122, 0.7217942490673264 } },
+        { 0.007091003462846911, { 0.45449629587435036, 0.45449629587435036, 0.04550370412564965, 0.04550370412564965 } },
+      };
+
+      // tetrahedron, order 6, 24 points
+      const SymmetricQuadratureOrbit tetrahedronOrbits6[] = {
+        { 0.009226196923942455, { 0.3223378901422755, 0.3223378901422755, 0.3223378901422755, 0.03298632957317347 } },
+        { 0.001679535175886774, { 0.04067395853461135, 0.04067395853461135, 0.04067395853461135, 0.877978124396166 } },
+        { 0.006653791709694582, { 0.21460287125915203, 0.21460287125915203, 0.21460287125915203, 0.3561913862225439 } },
+        { 0.008035714285714285, { 0.06366100187501753, 0.06366100187501753, 0.2696723314583158, 0.6030056647916492 } },
+      };
+
+      // tetrahedron, order 7, 38 points
+      const SymmetricQuadratureOrbit tetrahedronOrbits7[] = {
+        { 0.005384226029449989, { 0.21594721230004243, 0.21594721230004243, 0.21594721230004243, 0.3521583630998727 } },
+        { 0.0071166268274506905, { 0.3173741918167573, 0.3173741918167573, 0.3173741918167573, 0.04787742454972817 } },
+        { 0.005511366300452736, { 0.4485690552289252, 0.4485690552289252, 0.051430944771074766, 0.051430944771074766 } },
+        { 0.0057436963479061, { 0.18297474249435575, 0.18297474249435575, 0.04425859241706511, 0.5897919225942234 } },
+        { 0.001222558438456194, { 0.01904360188087026, 0.01904360188087026, 0.8167940621957933, 0.14511873404246617 } },
+      };
+
+      // tetrahedron, order 8, 48 points
+      const SymmetricQuadratureOrbit tetrahedronOrbits8[] = {
+        { 0.009425763587585824, { 0.18926038890520105, 0.18926038890520105, 0.18926038890520105, 0.4322188332843968 } },
+        { 0.00577494622244218, { 0.31982339131354126, 0.31982339131354126, 0.31982339131354126, 0.04052982605937628 } },
+        { 0.0016257821752900215, { 0.04602199931902868, 0.04602199931902868, 0.04602199931902868, 0.8619340020429139 } },
+        { 0.0009190995281189731, { 0.014824780973448042, 0.014824780973448042, 0.7015458837435751, 0.2688045543095289 } },
+        { 0.0038276515189817513, { 0.1647960482657166, 0.1647960482657166, 0.6380614179875762, 0.03234648548099057 } },
+        { 0.0035333071800154893, { 0.4284124139585166, 0.4284124139585166, 0.036984038377228086, 0.10619113370573871 } },
+      };
+
+      // tetrahedron, order 9, 61 points
+      const SymmetricQuadratureOrbit tetrahedronOrbits9[] = {
+        { 0.00962559072083695, { 0.25, 0.25, 0.25, 0.25 } },
+        { 0.0007301048044956217, { 0.03493849593785961, 0.03493849593785961, 0.03493849593785961, 0.8951845121864211 } },
+        { 0.006545935996543905, { 0.3143260710371168, 0.3143260710371168, 0.3143260710371168, 0.05702178688864967 } },
+        { 0.007398627573767039, { 0.15325282393868966, 0.15325282393868966, 0.15325282393868966, 0.540241528183931 } },
+        { 0.0006890457594628921, { 0.010071139653703568, 0.010071139653703568, 0.48992886034629646, 0.48992886034629646 } },
+        { 0.00517778481201204, { 0.08942763188845217, 0.08942763188845217, 0.41057236811154785, 0.41057236811154785 } },
+        { 0.0020763048556453768, { 0.04039206406941669, 0.04039206406941669, 0.7362696115998444, 0.18294626026132219 } },
+        { 0.0015927400312503893, { 0.14243401922542023, 0.010709681785211497, 0.5623506671502926, 0.2845056318390757 } },
+      };
+
+      // tetrahedron, order 10, 81 points
+      const SymmetricQuadratureOrbit tetrahedronOrbits10[] = {
+        { 0.007613707878608324, { 0.25, 0.25, 0.25, 0.25 } },
+        { 0.004236188108937709, { 0.3132733275335806, 0.3132733275335806, 0.3132733275335806, 0.060180017399258136 } },
+        { 8.443329316311004e-05, { 0.009445726892886655, 0.009445726892886655, 0.009445726892886655, 0.97166281932134 } },
+        { 0.0010275823550651188, { 0.030004559424582616, 0.030004559424582616, 0.12709148320983468, 0.8128993979410001 } },
+        { 0.0008914127127534614, { 0.09278319163500705, 0.09278319163500705, 0.16546596237118796, 0.648967654358798 } },
+        { 0.001985991392394828, { 0.41025151212931193, 0.41025151212931193, 0.01548800704055185, 0.1640089687008243 } },
+        { 0.0020622128060712804, { 0.1757951191979069, 0.1757951191979069, 0.6276123249565548, 0.020797436647631385 } },
+        { 0.004139142613455023, { 0.12434418686072797, 0.12434418686072797, 0.46918588332024125, 0.2821257429583028 } },
+        { 0.0017078642185648773, { 0.032827402839280595, 0.032827402839280595, 0.33913400080447137, 0.5952111935169675 } },
+      };
+
+      const SymmetricQuadratureTable tetrahedronTables[] = {
+        { 1, 1, 1, tetrahedronOrbits1 }, // p = 0
+        { 1, 1, 1, tetrahedronOrbits1 }, // p = 1
+        { 2, 4, 1, tetrahedronOrbits2 }, // p = 2
+        { 3, 8, 2, tetrahedronOrbits3 }, // p = 3
+        { 5, 14, 3, tetrahedronOrbits5 }, // p = 4
+        { 5, 14, 3, tetrahedronOrbits5 }, // p = 5
+        { 6, 24, 4, tetrahedronOrbits6 }, // p = 6
+        { 7, 38, 5, tetrahedronOrbits7 }, // p = 7
+        { 8, 48, 6, tetrahedronOrbits8 }, // p = 8
+        { 9, 61, 8, tetrahedronOrbits9 }, // p = 9
+        { 10, 81, 9, tetrahedronOrbits10 }, // p = 10
+      };
+
+    } // anonymous namespace
+
+    const SymmetricQuadratureTable *symmetricSimplexQuadratureTable ( int dim, int p )
+    {
+      if( p < 0 )
+        p = 0;
+      if( (dim == 2) && (p <= 20) )
+        return &triangleTables[ p ];
+      if( (dim == 3) && (p <= 10) )
+        return &tetrahedronTables[ p ];
+      return nullptr;
+    }
+
+  } // namespace Impl
+
+} // namespace Dune
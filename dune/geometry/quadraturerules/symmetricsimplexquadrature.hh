@@ -0,0 +1,156 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_QUADRATURERULES_SYMMETRICSIMPLEXQUADRATURE_HH
+#define DUNE_GEOMETRY_QUADRATURERULES_SYMMETRICSIMPLEXQUADRATURE_HH
+
+#include <algorithm>
+#include <array>
+
+namespace Dune {
+
+  namespace Impl {
+
+    /** \brief orbit of a fully symmetric quadrature rule on a simplex
+     *
+     *  The orbit consists of all distinct permutations of the barycentric
+     *  coordinates \c lambda (only the first dim+1 entries are used), all
+     *  points carrying the same \c weight.  The values are correctly rounded
+     *  to double, so rules for number types more precise than double are only
+     *  accurate to double precision.
+     */
+    struct SymmetricQuadratureOrbit
+    {
+      double weight;
+      double lambda[4];
+    };
+
+    /** \brief table of a fully symmetric quadrature rule on a simplex */
+    struct SymmetricQuadratureTable
+    {
+      int order;
+      int size;
+      int numOrbits;
+      const SymmetricQuadratureOrbit *orbits;
+    };
+
+    /** \brief obtain the symmetric rule of lowest order >= p on the simplex of
+     *         dimension dim (2 or 3)
+     *
+     *  Returns \c nullptr if p exceeds the highest available order.
+     */
+    const SymmetricQuadratureTable *symmetricSimplexQuadratureTable ( int dim, int p );
+
+  } // namespace Impl
+
+  /************************************************
+   * Fully symmetric quadrature rules for simplices
+   *************************************************/
+
+  /** \brief Fully symmetric quadrature rules for simplices
+      \ingroup Quadrature
+
+      These rules are invariant under all affine maps of the simplex onto
+      itself, have positive weights only, and all points lie in the interior
+      of the simplex.  For high orders, they need considerably fewer points
+      than the conical product rules, e.g., 81 instead of 121 points for
+      order 20 on the triangle.
+
+      The rules were computed by solving the moment equations for an
+      orthonormal basis for fixed orbit structures (cf. F.D. Witherden,
+      P.E. Vincent, On the identification of symmetric quadrature rules for
+      finite element methods, Comput. Math. Appl. 69 (2015)).  They are
+      tabulated in double precision and exact up to the rounding of the
+      tabulated values.  They are selected by QuadratureType::Symmetric;
+      higher orders fall back to the conical product rules.
+   */
+  template<typename ct, int dim>
+  class SymmetricSimplexQuadratureRule;
+
+  /** \brief Fully symmetric quadrature rules for triangles
+      \ingroup Quadrature
+   */
+  template<typename ct>
+  class SymmetricSimplexQuadratureRule<ct,2> : public QuadratureRule<ct,2>
+  {
+  public:
+    /** \brief The highest quadrature order available */
+    enum { highest_order = 20 };
+  private:
+    friend class QuadratureRuleFactory<ct,2>;
+    SymmetricSimplexQuadratureRule (int p);
+  };
+
+  /** \brief Fully symmetric quadrature rules for tetrahedra
+      \ingroup Quadrature
+
+      The rules end at order 10, where the rules with positive weights and
+      interior points of Witherden and Vincent end for tetrahedra.  Higher
+      orders would require a new search for orbit structures and are not
+      tabulated.
+   */
+  template<typename ct>
+  class SymmetricSimplexQuadratureRule<ct,3> : public QuadratureRule<ct,3>
+  {
+  public:
+    /** \brief The highest quadrature order available */
+    enum { highest_order = 10 };
+  private:
+    friend class QuadratureRuleFactory<ct,3>;
+    SymmetricSimplexQuadratureRule (int p);
+  };
+
+  namespace Impl {
+
+    //! append the points of all orbits of a symmetric simplex rule
+    template<typename ct, int dim>
+    void fillSymmetricSimplexQuadratureRule (const SymmetricQuadratureTable &table, QuadratureRule<ct,dim> &rule)
+    {
+      rule.reserve(table.size);
+      for (int o=0; o<table.numOrbits; ++o)
+      {
+        const SymmetricQuadratureOrbit &orbit = table.orbits[o];
+
+        // next_permutation enumerates every distinct permutation exactly once
+        std::array<double,dim+1> lambda;
+        std::copy(orbit.lambda, orbit.lambda+dim+1, lambda.begin());
+        std::sort(lambda.begin(), lambda.end());
+        do {
+          // the cartesian coordinates are the barycentric coordinates of the corners 1, ..., dim
+          FieldVector<ct,dim> local;
+          for (int i=0; i<dim; ++i)
+            local[i] = lambda[i+1];
+          rule.push_back(QuadraturePoint<ct,dim>(local, orbit.weight));
+        } while (std::next_permutation(lambda.begin(), lambda.end()));
+      }
+      assert(rule.size() == std::size_t(table.size));
+    }
+
+  } // namespace Impl
+
+  template<typename ct>
+  SymmetricSimplexQuadratureRule<ct,2>::SymmetricSimplexQuadratureRule(int p) : QuadratureRule<ct,2>(GeometryType(GeometryType::simplex, 2))
+  {
+    const Impl::SymmetricQuadratureTable *table = Impl::symmetricSimplexQuadratureTable(2, p);
+    if (!table)
+      DUNE_THROW(QuadratureOrderOutOfRange,
+                 "QuadratureRule for order " << p << " and GeometryType "
+                                             << this->type() << " not available");
+    this->delivered_order = table->order;
+    Impl::fillSymmetricSimplexQuadratureRule(*table, *this);
+  }
+
+  template<typename ct>
+  SymmetricSimplexQuadratureRule<ct,3>::SymmetricSimplexQuadratureRule(int p) : QuadratureRule<ct,3>(GeometryType(GeometryType::simplex, 3))
+  {
+    const Impl::SymmetricQuadratureTable *table = Impl::symmetricSimplexQuadratureTable(3, p);
+    if (!table)
+      DUNE_THROW(QuadratureOrderOutOfRange,
+                 "QuadratureRule for order " << p << " and GeometryType "
+                                             << this->type() << " not available");
+    this->delivered_order = table->order;
+    Impl::fillSymmetricSimplexQuadratureRule(*table, *this);
+  }
+
+} // end namespace Dune
+
+#endif // DUNE_GEOMETRY_QUADRATURERULES_SYMMETRICSIMPLEXQUADRATURE_HH
@@ -4,6 +4,7 @@
 #define DUNE_GEOMETRY_QUADRATURERULES_TENSORPRODUCTQUADRATURE_HH
 
 #include <algorithm>
+#include <array>
 #include <bitset>
 
 #include <dune/geometry/type.hh>
@@ -75,6 +76,32 @@ namespace Dune
           this->push_back( QPoint(point, baseWeight * onedQuad[oqi].weight()) );
         }
       }
+
+      // keep the tensor structure, if the base rule has one
+      std::array< const QuadratureRule<ctype,1> *, dim > factors;
+      if( tensorFactors( baseQuad, factors ) )
+      {
+        factors[ dim-1 ] = &onedQuad;
+        this->setTensorFactors( factors );
+      }
+    }
+
+    //! a one-dimensional base rule is its own tensor factor
+    static bool tensorFactors ( const QuadratureRule<ctype,1> &baseQuad, std::array< const QuadratureRule<ctype,1> *, dim > &factors )
+    {
+      factors[ 0 ] = &baseQuad;
+      return true;
+    }
+
+    //! obtain the tensor factors of a base rule (returns false, if it has none)
+    template< int baseDim >
+    static bool tensorFactors ( const QuadratureRule<ctype,baseDim> &baseQuad, std::array< const QuadratureRule<ctype,1> *, dim > &factors )
+    {
+      if( !baseQuad.isTensorProduct() )
+        return false;
+      for( int k = 0; k < baseDim; ++k )
+        factors[ k ] = &baseQuad.tensorFactor( k );
+      return true;
     }
 
     /** \brief Creates quadrature rule by conical multiplication of an arbitrary rule with a rule for a one-dimensional domain
@@ -4,6 +4,7 @@
 #define DUNE_GEOMETRY_REFERENCEELEMENTS_HH
 
 #include <cassert>
+#include <cstddef>
 
 #include <algorithm>
 #include <limits>
@@ -41,7 +42,31 @@ namespace Dune
   {
 
     /** \brief Compute the number of subentities of a given codimension */
-    unsigned int size ( unsigned int topologyId, int dim, int codim );
+    inline constexpr unsigned int size ( unsigned int topologyId, int dim, int codim )
+    {
+      assert( (dim >= 0) && (topologyId < numTopologies( dim )) );
+      assert( (0 <= codim) && (codim <= dim) );
+
+      if( codim > 0 )
+      {
+        const unsigned int baseId = baseTopologyId( topologyId, dim );
+        const unsigned int m = size( baseId, dim-1, codim-1 );
+
+        if( isPrism( topologyId, dim ) )
+        {
+          const unsigned int n = (codim < dim ? size( baseId, dim-1, codim ) : 0);
+          return n + 2*m;
+        }
+        else
+        {
+          assert( isPyramid( topologyId, dim ) );
+          const unsigned int n = (codim < dim ? size( baseId, dim-1, codim ) : 1);
+          return m+n;
+        }
+      }
+      else
+        return 1;
+    }
 
 
 
@@ -52,16 +77,162 @@ namespace Dune
      * \param codim Codimension of the subentity that we are interested in
      * \param i Number of the subentity that we are interested in
      */
-    unsigned int subTopologyId ( unsigned int topologyId, int dim, int codim, unsigned int i );
+    inline constexpr unsigned int subTopologyId ( unsigned int topologyId, int dim, int codim, unsigned int i )
+    {
+      assert( i < size( topologyId, dim, codim ) );
+      const int mydim = dim - codim;
+
+      if( codim > 0 )
+      {
+        const unsigned int baseId = baseTopologyId( topologyId, dim );
+        const unsigned int m = size( baseId, dim-1, codim-1 );
+
+        if( isPrism( topologyId, dim ) )
+        {
+          const unsigned int n = (codim < dim ? size( baseId, dim-1, codim ) : 0);
+          if( i < n )
+            return subTopologyId( baseId, dim-1, codim, i ) | ((unsigned int)prismConstruction << (mydim - 1));
+          else
+            return subTopologyId( baseId, dim-1, codim-1, (i < n+m ? i-n : i-(n+m)) );
+        }
+        else
+        {
+          assert( isPyramid( topologyId, dim ) );
+          if( i < m )
+            return subTopologyId( baseId, dim-1, codim-1, i );
+          else if( codim < dim )
+            return subTopologyId( baseId, dim-1, codim, i-m ) | ((unsigned int)pyramidConstruction << (mydim - 1));
+          else
+            return 0u;
+        }
+      }
+      else
+        return topologyId;
+    }
 
 
 
     // subTopologyNumbering
     // --------------------
 
-    void subTopologyNumbering ( unsigned int topologyId, int dim, int codim, unsigned int i, int subcodim,
-                                unsigned int *beginOut, unsigned int *endOut );
+    inline constexpr void subTopologyNumbering ( unsigned int topologyId, int dim, int codim, unsigned int i, int subcodim,
+                                          unsigned int *beginOut, unsigned int *endOut )
+    {
+      assert( (codim >= 0) && (subcodim >= 0) && (codim + subcodim <= dim) );
+      assert( i < size( topologyId, dim, codim ) );
+      assert( (endOut - beginOut) == size( subTopologyId( topologyId, dim, codim, i ), dim-codim, subcodim ) );
+
+      if( codim == 0 )
+      {
+        for( unsigned int j = 0; (beginOut + j) != endOut; ++j )
+          *(beginOut + j) = j;
+      }
+      else if( subcodim == 0 )
+      {
+        assert( endOut == beginOut + 1 );
+        *beginOut = i;
+      }
+      else
+      {
+        const unsigned int baseId = baseTopologyId( topologyId, dim );
+
+        const unsigned int m = size( baseId, dim-1, codim-1 );
+
+        const unsigned int mb = size( baseId, dim-1, codim+subcodim-1 );
+        const unsigned int nb = (codim + subcodim < dim ? size( baseId, dim-1, codim+subcodim ) : 0);
+
+        if( isPrism( topologyId, dim ) )
+        {
+          const unsigned int n = size( baseId, dim-1, codim );
+          if( i < n )
+          {
+            const unsigned int subId = subTopologyId( baseId, dim-1, codim, i );
+
+            unsigned int *beginBase = beginOut;
+            if( codim + subcodim < dim )
+            {
+              beginBase = beginOut + size( subId, dim-codim-1, subcodim );
+              subTopologyNumbering( baseId, dim-1, codim, i, subcodim, beginOut, beginBase );
+            }
+
+            const unsigned int ms = size( subId, dim-codim-1, subcodim-1 );
+            subTopologyNumbering( baseId, dim-1, codim, i, subcodim-1, beginBase, beginBase+ms );
+            for( unsigned int j = 0; j < ms; ++j )
+            {
+              *(beginBase+j) += nb;
+              *(beginBase+j+ms) = *(beginBase+j) + mb;
+            }
+          }
+          else
+          {
+            const unsigned int s = (i < n+m ? 0 : 1);
+            subTopologyNumbering( baseId, dim-1, codim-1, i-(n+s*m), subcodim, beginOut, endOut );
+            for( unsigned int *it = beginOut; it != endOut; ++it )
+              *it += nb + s*mb;
+          }
+        }
+        else
+        {
+          assert( isPyramid( topologyId, dim ) );
+
+          if( i < m )
+            subTopologyNumbering( baseId, dim-1, codim-1, i, subcodim, beginOut, endOut );
+          else
+          {
+            const unsigned int subId = subTopologyId( baseId, dim-1, codim, i-m );
+            const unsigned int ms = size( subId, dim-codim-1, subcodim-1 );
+
+            subTopologyNumbering( baseId, dim-1, codim, i-m, subcodim-1, beginOut, beginOut+ms );
+            if( codim+subcodim < dim )
+            {
+              subTopologyNumbering( baseId, dim-1, codim, i-m, subcodim, beginOut+ms, endOut );
+              for( unsigned int *it = beginOut + ms; it != endOut; ++it )
+                *it += mb;
+            }
+            else
+              *(beginOut + ms) = mb;
+          }
+        }
+      }
+    }
+
+
+
+
+    // numSubEntities
+    // --------------
 
+    /** \brief Compute the number of subentities of all codimensions */
+    inline constexpr unsigned int numSubEntities ( unsigned int topologyId, int dim )
+    {
+      unsigned int n = 0;
+      for( int codim = 0; codim <= dim; ++codim )
+        n += size( topologyId, dim, codim );
+      return n;
+    }
+
+
+
+    // numSubEntityNumbers
+    // -------------------
+
+    /** \brief Compute the total length of the subentity numberings of all
+     *         subentities
+     */
+    inline constexpr unsigned int numSubEntityNumbers ( unsigned int topologyId, int dim )
+    {
+      unsigned int n = 0;
+      for( int codim = 0; codim <= dim; ++codim )
+      {
+        for( unsigned int i = 0; i < size( topologyId, dim, codim ); ++i )
+        {
+          const unsigned int subId = subTopologyId( topologyId, dim, codim, i );
+          for( int subcodim = 0; subcodim <= dim-codim; ++subcodim )
+            n += size( subId, dim-codim, subcodim );
+        }
+      }
+      return n;
+    }
 
 
 
@@ -87,6 +258,18 @@ namespace Dune
         return true;
     }
 
+    /** \brief tolerance for deciding whether a local coordinate lies inside
+     *         the reference element
+     *
+     *  Shared by ReferenceElement::checkInside and the inside flags of the
+     *  batched inverse mappings of AffineGeometry and MultiLinearGeometry.
+     */
+    template< class ct >
+    inline ct insideTolerance ()
+    {
+      return ct( 64 ) * std::numeric_limits< ct >::epsilon();
+    }
+
 
 
     // referenceCorners
@@ -130,7 +313,18 @@ namespace Dune
     // referenceVolume
     // ---------------
 
-    unsigned long referenceVolumeInverse ( unsigned int topologyId, int dim );
+    inline constexpr unsigned long referenceVolumeInverse ( unsigned int topologyId, int dim )
+    {
+      assert( (dim >= 0) && (topologyId < numTopologies( dim )) );
+
+      if( dim > 0 )
+      {
+        unsigned long baseValue = referenceVolumeInverse( baseTopologyId( topologyId, dim ), dim-1 );
+        return (isPrism( topologyId, dim ) ? baseValue : baseValue * (unsigned long)dim);
+      }
+      else
+        return 1;
+    }
 
     template< class ct >
     inline ct referenceVolume ( unsigned int topologyId, int dim )
@@ -382,7 +576,7 @@ namespace Dune
     int size ( int c ) const
     {
       assert( (c >= 0) && (c <= dim) );
-      return info_[ c ].size();
+      return infoOffset_[ c+1 ] - infoOffset_[ c ];
     }
 
     /** \brief number of subentities of codimension cc of subentity (i,c)
@@ -399,7 +593,9 @@ namespace Dune
     int size ( int i, int c, int cc ) const
     {
       assert( (i >= 0) && (i < size( c )) );
-      return info_[ c ][ i ].size( cc );
+      assert( (cc >= c) && (cc <= dim) );
+      const unsigned int *offset = offsets( i, c );
+      return (offset[ cc+1 ] - offset[ cc ]);
     }
 
     /** \brief obtain number of ii-th subentity with codim cc of (i,c)
@@ -417,8 +613,8 @@ namespace Dune
      */
     int subEntity ( int i, int c, int ii, int cc ) const
     {
-      assert( (i >= 0) && (i < size( c )) );
-      return info_[ c ][ i ].number( ii, cc );
+      assert( (ii >= 0) && (ii < size( i, c, cc )) );
+      return numbering_[ numbering_[ (infoOffset_[ c ] + i)*(dim+2) + cc ] + ii ];
     }
 
     /** \brief obtain the type of subentity (i,c)
@@ -432,7 +628,7 @@ namespace Dune
     const GeometryType &type ( int i, int c ) const
     {
       assert( (i >= 0) && (i < size( c )) );
-      return info_[ c ][ i ].type();
+      return info( i, c ).type();
     }
 
     /** \brief obtain the type of this reference element */
@@ -462,8 +658,7 @@ namespace Dune
      */
     bool checkInside ( const FieldVector< ctype, dim > &local ) const
     {
-      const ctype tolerance = ctype( 64 ) * std::numeric_limits< ctype >::epsilon();
-      return Impl::template checkInside< ctype, dim >( type().id(), dim, local, tolerance );
+      return Impl::template checkInside< ctype, dim >( type().id(), dim, local, Impl::template insideTolerance< ctype >() );
     }
 
     /** \brief obtain the embedding of subentity (i,codim) into the reference
@@ -503,18 +698,46 @@ namespace Dune
     }
 
   private:
-    void initialize ( unsigned int topologyId )
+    const SubEntityInfo &info ( int i, int c ) const { return info_[ infoOffset_[ c ] + i ]; }
+
+    //! positions of the subentity numbers of (i,c) in numbering_ (indexed by cc, dim+2 entries)
+    const unsigned int *offsets ( int i, int c ) const { return numbering_ + (infoOffset_[ c ] + i)*(dim+2); }
+
+    //! size of the storage for the subentity numbers and their offsets
+    static unsigned int numberingSize ( unsigned int topologyId )
+    {
+      return Impl::numSubEntities( topologyId, dim )*(dim+2) + Impl::numSubEntityNumbers( topologyId, dim );
+    }
+
+    /** \brief set up the reference element
+     *
+     *  \param[in]  topologyId  id of the topology
+     *  \param[in]  info        storage for Impl::numSubEntities( topologyId, dim )
+     *                          subentity infos
+     *  \param[in]  numbering   storage for numberingSize( topologyId ) entries,
+     *                          the offsets of all subentities followed by
+     *                          their subentity numbers
+     *
+     *  \note The storage is owned by the ReferenceElementContainer.
+     */
+    void initialize ( unsigned int topologyId, SubEntityInfo *info, unsigned int *numbering )
     {
       assert( topologyId < Impl::numTopologies( dim ) );
 
       // set up subentities
+      unsigned int n = 0;
+      unsigned int position = Impl::numSubEntities( topologyId, dim )*(dim+2);
       for( int codim = 0; codim <= dim; ++codim )
       {
+        infoOffset_[ codim ] = n;
         const unsigned int size = Impl::size( topologyId, dim, codim );
-        info_[ codim ].resize( size );
-        for( unsigned int i = 0; i < size; ++i )
-          info_[ codim ][ i ].initialize( topologyId, codim, i );
+        for( unsigned int i = 0; i < size; ++i, ++n )
+          position = info[ n ].initialize( topologyId, codim, i, numbering + n*(dim+2), numbering, position );
       }
+      infoOffset_[ dim+1 ] = n;
+      assert( position == numberingSize( topologyId ) );
+      info_ = info;
+      numbering_ = numbering;
 
       // compute corners
       const unsigned int numVertices = size( dim );
@@ -565,83 +788,61 @@ namespace Dune
     /** \brief Stores all subentities of all codimensions */
     GeometryTable geometries_;
 
-    std::vector< SubEntityInfo > info_[ dim+1 ];
+    /** \brief subentity infos of all codimensions (ordered by codimension) */
+    const SubEntityInfo *info_;
+    unsigned int infoOffset_[ dim+2 ];
+
+    /** \brief offsets and subentity numbers of all subentities
+     *
+     *  Entry (infoOffset_[ c ] + i)*(dim+2) + cc is the position of the
+     *  first subentity number of codimension cc of (i,c), so subEntity()
+     *  reads an offset and a number from this block only.
+     */
+    const unsigned int *numbering_;
   };
 
-  /** \brief topological information about the subentities of a reference element */
+  /** \brief topological information about the subentities of a reference element
+   *
+   *  The offsets and numbers of the subentities are stored in an arena
+   *  shared by all reference elements of the same dimension (see
+   *  ReferenceElementContainer).
+   */
   template< class ctype, int dim >
   struct ReferenceElement< ctype, dim >::SubEntityInfo
   {
-    SubEntityInfo ()
-      : numbering_( nullptr )
-    {
-      std::fill( offset_.begin(), offset_.end(), 0 );
-    }
-
-    SubEntityInfo ( const SubEntityInfo &other )
-      : offset_( other.offset_ ),
-        type_( other.type_ )
-    {
-      numbering_ = allocate();
-      std::copy( other.numbering_, other.numbering_ + capacity(), numbering_ );
-    }
-
-    ~SubEntityInfo () { deallocate( numbering_ ); }
-
-    const SubEntityInfo &operator= ( const SubEntityInfo &other )
-    {
-      type_ = other.type_;
-      offset_ = other.offset_;
-
-      deallocate( numbering_ );
-      numbering_ = allocate();
-      std::copy( other.numbering_, other.numbering_ + capacity(), numbering_ );
-
-      return *this;
-    }
-
-    int size ( int cc ) const
-    {
-      assert( (cc >= codim()) && (cc <= dim) );
-      return (offset_[ cc+1 ] - offset_[ cc ]);
-    }
-
-    int number ( int ii, int cc ) const
-    {
-      assert( (ii >= 0) && (ii < size( cc )) );
-      return numbering_[ offset_[ cc ] + ii ];
-    }
-
     const GeometryType &type () const { return type_; }
 
-    void initialize ( unsigned int topologyId, int codim, unsigned int i )
+    /** \brief set up the subentity info
+     *
+     *  \param[in]  topologyId  id of the reference element's topology
+     *  \param[in]  codim       codimension of the subentity
+     *  \param[in]  i           index of the subentity
+     *  \param[in]  offset      storage receiving the dim+2 offsets of the subentity numbers
+     *  \param[in]  numbering   storage receiving the subentity numbers
+     *  \param[in]  position    first free entry of the numbering storage
+     *
+     *  \returns first free entry of the numbering storage after this subentity
+     */
+    unsigned int initialize ( unsigned int topologyId, int codim, unsigned int i,
+                              unsigned int *offset, unsigned int *numbering, unsigned int position )
     {
       const unsigned int subId = Impl::subTopologyId( topologyId, dim, codim, i );
       type_ = GeometryType( subId, dim-codim );
 
       // compute offsets
       for( int cc = 0; cc <= codim; ++cc )
-        offset_[ cc ] = 0;
+        offset[ cc ] = position;
       for( int cc = codim; cc <= dim; ++cc )
-        offset_[ cc+1 ] = offset_[ cc ] + Impl::size( subId, dim-codim, cc-codim );
+        offset[ cc+1 ] = offset[ cc ] + Impl::size( subId, dim-codim, cc-codim );
 
       // compute subnumbering
-      deallocate( numbering_ );
-      numbering_ = allocate();
       for( int cc = codim; cc <= dim; ++cc )
-        Impl::subTopologyNumbering( topologyId, dim, codim, i, cc-codim, numbering_+offset_[ cc ], numbering_+offset_[ cc+1 ] );
-    }
+        Impl::subTopologyNumbering( topologyId, dim, codim, i, cc-codim, numbering+offset[ cc ], numbering+offset[ cc+1 ] );
 
-  protected:
-    int codim () const { return dim - type().dim(); }
-
-    unsigned int *allocate () { return (capacity() != 0 ? new unsigned int[ capacity() ] : nullptr); }
-    void deallocate ( unsigned int *ptr ) { delete[] ptr; }
-    unsigned int capacity () const { return offset_[ dim+1 ]; }
+      return offset[ dim+1 ];
+    }
 
   private:
-    unsigned int *numbering_;
-    std::array< unsigned int, dim+2 > offset_;
     GeometryType type_;
   };
 
@@ -696,8 +897,25 @@ namespace Dune
 
     ReferenceElementContainer ()
     {
+      // the topological information of all reference elements is stored in
+      // one contiguous block
+      std::size_t numEntities = 0, numNumbers = 0;
       for( unsigned int topologyId = 0; topologyId < numTopologies; ++topologyId )
-        values_[ topologyId ].initialize( topologyId );
+      {
+        numEntities += Impl::numSubEntities( topologyId, dim );
+        numNumbers += value_type::numberingSize( topologyId );
+      }
+      info_.resize( numEntities );
+      numbering_.resize( numNumbers );
+
+      SubEntityInfo *info = info_.data();
+      unsigned int *numbering = numbering_.data();
+      for( unsigned int topologyId = 0; topologyId < numTopologies; ++topologyId )
+      {
+        values_[ topologyId ].initialize( topologyId, info, numbering );
+        info += Impl::numSubEntities( topologyId, dim );
+        numbering += value_type::numberingSize( topologyId );
+      }
     }
 
     const value_type &operator() ( const GeometryType &type ) const
@@ -730,6 +948,10 @@ namespace Dune
     const_iterator end () const { return values_ + numTopologies; }
 
   private:
+    typedef typename value_type::SubEntityInfo SubEntityInfo;
+
+    std::vector< SubEntityInfo > info_;
+    std::vector< unsigned int > numbering_;
     value_type values_[ numTopologies ];
   };
 
@@ -77,17 +77,69 @@
  *
  *   typedef ImplementationDefined IndexVector; // These are FieldVectors
  *   typedef ImplementationDefined CoordVector;
+ *   typedef RefinementIntervals<dimension> Intervals;
  *
+ *   // each of the following also takes Intervals instead of a level
  *   static int nVertices(int level);
  *   static VertexIterator vBegin(int level);
  *   static VertexIterator vEnd(int level);
+ *   static IteratorRange<VertexIterator> vRange(int level, int first, int last);
  *
  *   static int nElements(int level);
  *   static ElementIterator eBegin(int level);
  *   static ElementIterator eEnd(int level);
+ *   static IteratorRange<ElementIterator> eRange(int level, int first, int last);
+ *
+ *   static int nCorners();
+ *   static void exportLevel(int level, CoordType *coords, int *connectivity,
+ *                           CoordType *corners = nullptr);
+ *   static std::shared_ptr<const RefinementTable<dimension, CoordType> > table(int level);
  * }
  * \endcode
  *
+ * exportLevel() writes the vertex coordinates, the vertex indices of the
+ * elements and (optionally) the corner coordinates of the elements of a
+ * level to flat arrays in one go.  table() returns the same arrays,
+ * computed once per process and level and shared by all callers.  This
+ * is the fastest way to obtain the same refinement repeatedly, e.g., for
+ * subsampled output.  The tables of intervals other than those of a level
+ * are computed anew by each call of table().
+ *
+ * vRange() and eRange() return the entities with the indices first, ...,
+ * last-1.  They allow splitting a level into chunks that are processed by
+ * different threads:
+ *
+ * \code
+ * // in thread t of nThreads
+ * int n = MyRefinement::nElements(level);
+ * auto range = MyRefinement::eRange(level, n*t/nThreads, n*(t+1)/nThreads);
+ * for(auto it = range.begin(); it != range.end(); ++it)
+ *   ...
+ * \endcode
+ *
+ * Except for the pyramid refinement, the iterators are random access
+ * iterators, so the ranges are found without walking over the preceding
+ * entities.  The pyramid refinement has forward iterators only, and
+ * obtaining a range costs a walk from the beginning.
+ *
+ * Refinement level l divides each direction into 2^l intervals of equal
+ * length.  Passing RefinementIntervals instead of a level chooses the
+ * number of intervals per direction (anisotropic refinement) and grades
+ * the intervals of a direction geometrically towards one of its faces:
+ *
+ * \code
+ * // 2 x 3 x 8 subcubes, shrinking towards the face z = 1
+ * MyRefinement::Intervals intervals(std::array<int, 3>{{2, 3, 8}});
+ * intervals.grade(2, 0.8);
+ * for(auto it = MyRefinement::eBegin(intervals); it != MyRefinement::eEnd(intervals); ++it)
+ *   ...
+ * \endcode
+ *
+ * Hypercubes (also when coerced to simplices) support any intervals.
+ * Prisms need the same number of intervals of equal length in the
+ * directions 0 and 1, simplices and pyramids in all directions.  Other
+ * intervals raise a NotImplemented exception.
+ *
  * The Iterators can do all the usual things that Iterators can do,
  * except dereferencing.  In addition, to do something useful, they
  * support some additional methods:
@@ -183,7 +235,11 @@
  *   "base.cc".  Your file will be included by others, so don't forget
  *   to protect against double inclusion.
  * - implement a class (or template class) RefinementImp conforming
- *   exactly to the user interface above.
+ *   exactly to the user interface above, where nVertices(), vBegin(),
+ *   vEnd(), nElements(), eBegin() and eEnd() take RefinementIntervals
+ *   only (StaticRefinement adds the versions taking a level and the
+ *   remaining methods).  Throw NotImplemented for intervals you do not
+ *   support.
  * - put it (and it's helper stuff as appropriate) into it's own
  *   namespace Dune::RefinementImp::SquaringTheCircle.
  * - define the mapping of topologyId, CoordType and coerceToId to your
@@ -10,6 +10,20 @@
  *        \ref Refinement implementation.
  */
 
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/iteratorrange.hh>
+#include <dune/common/visibility.hh>
+
 #include <dune/geometry/type.hh>
 
 namespace Dune
@@ -81,6 +95,184 @@ namespace Dune
 #endif // !DOXYGEN
   } // namespace RefinementImp
 
+  // ///////////////
+  //
+  //  Refinement Intervals
+  //
+
+  /*!
+   * \brief The intervals of a refinement in each coordinate direction
+   *
+   * \tparam dimension The dimension of the refinement
+   *
+   * Refinement level l corresponds to 2^l intervals of equal length in each
+   * direction.  Beyond that, the number of intervals may differ between the
+   * directions (anisotropic refinement), and the intervals of a direction
+   * may be graded geometrically: with ratio q, each interval is q times as
+   * long as the previous one, so q < 1 refines towards the face
+   * \f$x_d=1\f$ and q > 1 refines towards the face \f$x_d=0\f$.
+   *
+   * Which intervals are supported depends on the \ref Refinement
+   * implementation:
+   * - hypercubes (also when coerced to simplices) support any intervals,
+   * - prisms support any intervals, provided the directions 0 and 1 (the
+   *   triangle) have the same number of intervals of equal length,
+   * - simplices and pyramids support the same number of intervals of equal
+   *   length in each direction only (in dimension 1, the intervals may be
+   *   graded).
+   *
+   * The other intervals raise a NotImplemented exception.
+   */
+  template<int dimension>
+  class RefinementIntervals
+  {
+  public:
+    //! the same number of intervals of equal length in each direction
+    explicit RefinementIntervals(int intervals)
+    {
+      intervals_.fill(intervals);
+      ratios_.fill(1.0);
+      if(intervals < 1)
+        DUNE_THROW(RangeError, "A refinement needs at least one interval per direction.");
+    }
+
+    //! the given number of intervals of equal length in each direction
+    explicit RefinementIntervals(const std::array<int, dimension> &intervals)
+      : intervals_(intervals)
+    {
+      ratios_.fill(1.0);
+      for(int d = 0; d < dimension; ++d)
+        if(intervals_[d] < 1)
+          DUNE_THROW(RangeError, "A refinement needs at least one interval per direction.");
+    }
+
+    //! the intervals of refinement level \a level
+    static RefinementIntervals level(int level)
+    {
+      assert(level >= 0);
+      return RefinementIntervals(1 << level);
+    }
+
+    //! grade the intervals of a direction geometrically by the given ratio
+    RefinementIntervals &grade(int direction, double ratio)
+    {
+      assert(0 <= direction && direction < dimension);
+      if(!(ratio > 0))
+        DUNE_THROW(RangeError, "The ratio of graded intervals has to be positive.");
+      ratios_[direction] = ratio;
+      return *this;
+    }
+
+    //! Get the number of intervals in a direction
+    int intervals(int direction) const { return intervals_[direction]; }
+    //! Get the ratio of consecutive intervals in a direction
+    double ratio(int direction) const { return ratios_[direction]; }
+
+    //! whether the intervals of a direction are of equal length
+    bool isUniform(int direction) const { return ratios_[direction] == 1.0; }
+
+    //! whether each direction has the same number of intervals of equal length
+    bool isUniform() const
+    {
+      for(int d = 0; d < dimension; ++d)
+        if(intervals_[d] != intervals_[0] || !isUniform(d))
+          return false;
+      return true;
+    }
+
+    /*!
+     * \brief Get the position of boundary i of the intervals of a direction
+     *
+     * The boundaries are numbered from 0 (at 0) to intervals(direction)
+     * (at 1).
+     */
+    double boundary(int direction, int i) const
+    {
+      const int n = intervals_[direction];
+      const double q = ratios_[direction];
+      if(i <= 0)
+        return 0.0;
+      if(i >= n)
+        return 1.0;
+      if(q == 1.0)
+        return double(i) / n;
+      return (std::pow(q, i) - 1.0) / (std::pow(q, n) - 1.0);
+    }
+
+    bool operator==(const RefinementIntervals &other) const
+    {
+      return intervals_ == other.intervals_ && ratios_ == other.ratios_;
+    }
+
+    bool operator!=(const RefinementIntervals &other) const
+    {
+      return !(*this == other);
+    }
+
+  private:
+    std::array<int, dimension> intervals_;
+    std::array<double, dimension> ratios_;
+  };
+
+  // ///////////////
+  //
+  //  Refinement Table
+  //
+
+  /*!
+   * \brief The subvertices and subelements of a refinement level stored
+   *        in flat arrays
+   *
+   * \tparam dimension The dimension of the refinement
+   * \tparam CoordType The C++ type of the coordinates
+   *
+   * The layout of the arrays is the one of StaticRefinement::exportLevel().
+   * Tables are obtained from StaticRefinement::table() or
+   * VirtualRefinement::table(), which hand out shared pointers to const
+   * tables, so a table never changes after it has been filled.
+   */
+  template<int dimension, class CoordType>
+  class RefinementTable
+  {
+  public:
+    //! Create a table for the given number of vertices and elements
+    RefinementTable(int nVertices, int nElements, int nCorners)
+      : nVertices_(nVertices), nElements_(nElements), nCorners_(nCorners),
+        coords_(std::size_t(nVertices) * dimension),
+        connectivity_(std::size_t(nElements) * nCorners),
+        corners_(std::size_t(nElements) * nCorners * dimension)
+    {}
+
+    //! Get the number of vertices
+    int nVertices() const { return nVertices_; }
+    //! Get the number of elements
+    int nElements() const { return nElements_; }
+    //! Get the number of vertices of each element
+    int nCorners() const { return nCorners_; }
+
+    //! Get the coordinates of the vertices
+    const CoordType *coords() const { return coords_.data(); }
+    //! Get the vertex indices of the elements
+    const int *connectivity() const { return connectivity_.data(); }
+    //! Get the corners of the element geometries
+    const CoordType *corners() const { return corners_.data(); }
+
+    //! Get the coordinates of the vertices (for filling the table)
+    CoordType *coords() { return coords_.data(); }
+    //! Get the vertex indices of the elements (for filling the table)
+    int *connectivity() { return connectivity_.data(); }
+    //! Get the corners of the element geometries (for filling the table)
+    CoordType *corners() { return corners_.data(); }
+
+  private:
+    int nVertices_;
+    int nElements_;
+    int nCorners_;
+    std::vector<CoordType> coords_;
+    std::vector<int> connectivity_;
+    std::vector<CoordType> corners_;
+  };
+
   // ///////////////
   //
   //  Static Refinement
@@ -139,18 +331,18 @@ namespace Dune
     typedef IndexVector;
 
     //! Get the number of Vertices
-    static int nVertices(int level);
+    static int nVertices(const Intervals &intervals);
     //! Get a VertexIterator
-    static VertexIterator vBegin(int level);
+    static VertexIterator vBegin(const Intervals &intervals);
     //! Get a VertexIterator
-    static VertexIterator vEnd(int level);
+    static VertexIterator vEnd(const Intervals &intervals);
 
     //! Get the number of Elements
-    static int nElements(int level);
+    static int nElements(const Intervals &intervals);
     //! Get an ElementIterator
-    static ElementIterator eBegin(int level);
+    static ElementIterator eBegin(const Intervals &intervals);
     //! Get an ElementIterator
-    static ElementIterator eEnd(int level);
+    static ElementIterator eEnd(const Intervals &intervals);
 #endif //DOXYGEN
     typedef typename RefinementImp::Traits< topologyId, CoordType, coerceToId, dimension_>::Imp RefinementImp;
 
@@ -163,8 +355,280 @@ namespace Dune
 
     using typename RefinementImp::ElementIterator;
     using typename RefinementImp::IndexVector;
+
+    //! The intervals of a refinement, see RefinementIntervals
+    typedef RefinementIntervals<dimension_> Intervals;
+
+    using RefinementImp::nVertices;
+    using RefinementImp::vBegin;
+    using RefinementImp::vEnd;
+    using RefinementImp::nElements;
+    using RefinementImp::eBegin;
+    using RefinementImp::eEnd;
+
+    //! Get the number of Vertices of a refinement level
+    static int nVertices(int level)
+    {
+      return RefinementImp::nVertices(Intervals::level(level));
+    }
+    //! Get a VertexIterator of a refinement level
+    static VertexIterator vBegin(int level)
+    {
+      return RefinementImp::vBegin(Intervals::level(level));
+    }
+    //! Get a VertexIterator of a refinement level
+    static VertexIterator vEnd(int level)
+    {
+      return RefinementImp::vEnd(Intervals::level(level));
+    }
+
+    //! Get the number of Elements of a refinement level
+    static int nElements(int level)
+    {
+      return RefinementImp::nElements(Intervals::level(level));
+    }
+    //! Get an ElementIterator of a refinement level
+    static ElementIterator eBegin(int level)
+    {
+      return RefinementImp::eBegin(Intervals::level(level));
+    }
+    //! Get an ElementIterator of a refinement level
+    static ElementIterator eEnd(int level)
+    {
+      return RefinementImp::eEnd(Intervals::level(level));
+    }
+
+    /*!
+     * \brief Get the subvertices with indices first, ..., last-1
+     *
+     * The ranges of disjoint index intervals may be processed concurrently,
+     * e.g., by splitting [0, nVertices(intervals)) into one interval per
+     * thread.  Except for the pyramid refinement, the iterators are random
+     * access and the range is obtained without walking over the preceding
+     * entities; the pyramid refinement advances from vBegin().
+     */
+    static IteratorRange<VertexIterator> vRange(const Intervals &intervals, int first, int last)
+    {
+      assert(0 <= first && first <= last && last <= int(RefinementImp::nVertices(intervals)));
+      const VertexIterator begin = std::next(RefinementImp::vBegin(intervals), first);
+      return IteratorRange<VertexIterator>(begin, std::next(begin, last - first));
+    }
+
+    //! Get the subvertices of a refinement level with indices first, ..., last-1
+    static IteratorRange<VertexIterator> vRange(int level, int first, int last)
+    {
+      return vRange(Intervals::level(level), first, last);
+    }
+
+    /*!
+     * \brief Get the subelements with indices first, ..., last-1
+     *
+     * See vRange().
+     */
+    static IteratorRange<ElementIterator> eRange(const Intervals &intervals, int first, int last)
+    {
+      assert(0 <= first && first <= last && last <= int(RefinementImp::nElements(intervals)));
+      const ElementIterator begin = std::next(RefinementImp::eBegin(intervals), first);
+      return IteratorRange<ElementIterator>(begin, std::next(begin, last - first));
+    }
+
+    //! Get the subelements of a refinement level with indices first, ..., last-1
+    static IteratorRange<ElementIterator> eRange(int level, int first, int last)
+    {
+      return eRange(Intervals::level(level), first, last);
+    }
+
+    //! Get the number of vertices of each subelement
+    static int nCorners()
+    {
+      return IndexVector::dimension;
+    }
+
+    /*!
+     * \brief Write the subvertices and subelements of a level to flat
+     *        arrays
+     *
+     * The vertices and elements are traversed once.  Through
+     * VirtualRefinement, this is much cheaper than a loop over the
+     * iterators.  Pass a \c nullptr to skip an array.
+     *
+     * \param intervals    The intervals of the refinement
+     * \param coords       Receives the coordinates of the subvertices,
+     *                     coordinate j of vertex i is stored at
+     *                     i*dimension+j (nVertices(intervals)*dimension
+     *                     entries)
+     * \param connectivity Receives the vertex indices of the subelements,
+     *                     corner k of element e is stored at e*nCorners()+k
+     *                     (nElements(intervals)*nCorners() entries)
+     * \param corners      Receives the corners of the subelement geometries,
+     *                     coordinate j of corner k of element e is stored at
+     *                     (e*nCorners()+k)*dimension+j
+     *                     (nElements(intervals)*nCorners()*dimension entries)
+     *
+     * \note The corners are numbered as in the reference element of the
+     *       subelement geometry, which need not be the order of the vertex
+     *       indices.
+     */
+    static void exportLevel(const Intervals &intervals, CoordType *coords, int *connectivity,
+                            CoordType *corners = nullptr);
+
+    //! Write the subvertices and subelements of a refinement level to flat arrays
+    static void exportLevel(int level, CoordType *coords, int *connectivity,
+                            CoordType *corners = nullptr)
+    {
+      exportLevel(Intervals::level(level), coords, connectivity, corners);
+    }
+
+    //! The type of the tables returned by table()
+    typedef RefinementTable<dimension_, CoordType> Table;
+
+    //! number of refinement levels whose tables are looked up without locking
+    static const int numFastLevels = 16;
+
+    /*!
+     * \brief Get the table of a refinement level
+     *
+     * The table is filled by exportLevel() on first request and kept for
+     * the lifetime of the process, so that all later requests (from any
+     * thread) share it.  Use this instead of exportLevel() if the same
+     * level is needed repeatedly, e.g., once per element for subsampled
+     * output.
+     *
+     * Once the table of a level below numFastLevels has been filled, it is
+     * obtained without locking.  Concurrent first requests of the same level
+     * wait for a single export, requests of other levels are not blocked.
+     */
+    static std::shared_ptr<const Table> table(int level);
+
+    /*!
+     * \brief Get the table of the given intervals
+     *
+     * If the intervals are those of a refinement level, the shared table of
+     * that level is returned.  Tables of other intervals, e.g., anisotropic
+     * or graded ones, are not kept: each call exports them into a new
+     * table, so the caller should hold on to the result if it is needed
+     * repeatedly.
+     */
+    static std::shared_ptr<const Table> table(const Intervals &intervals);
+
+  private:
+    static std::shared_ptr<const Table> createTable(const Intervals &intervals)
+    {
+      std::shared_ptr<Table> table
+        = std::make_shared<Table>(nVertices(intervals), nElements(intervals), nCorners());
+      exportLevel(intervals, table->coords(), table->connectivity(), table->corners());
+      return table;
+    }
+
+    struct FastLevel
+    {
+      std::once_flag flag;
+      std::shared_ptr<const Table> table;
+    };
+
+    struct TableStorage
+    {
+      std::array<FastLevel, numFastLevels> fastLevels;
+      std::mutex mutex;
+      std::map<int, std::shared_ptr<const Table> > tables;
+    };
+
+    DUNE_EXPORT static TableStorage &tableStorage()
+    {
+      static TableStorage storage;
+      return storage;
+    }
   };
 
+  template<unsigned topologyId, class CoordType,
+      unsigned coerceToId, int dimension_>
+  void StaticRefinement<topologyId, CoordType, coerceToId, dimension_>::
+  exportLevel(const Intervals &intervals, CoordType *coords, int *connectivity, CoordType *corners)
+  {
+    if(coords)
+    {
+      const VertexIterator vEnd = RefinementImp::vEnd(intervals);
+      for(VertexIterator it = RefinementImp::vBegin(intervals); it != vEnd; ++it)
+      {
+        const CoordVector x = it.coords();
+        for(int j = 0; j < dimension; ++j)
+          coords[std::size_t(it.index()) * dimension + j] = x[j];
+      }
+    }
+
+    if(connectivity || corners)
+    {
+      const ElementIterator eEnd = RefinementImp::eEnd(intervals);
+      for(ElementIterator it = RefinementImp::eBegin(intervals); it != eEnd; ++it)
+      {
+        const std::size_t offset = std::size_t(it.index()) * IndexVector::dimension;
+        if(connectivity)
+        {
+          const IndexVector indices = it.vertexIndices();
+          for(int k = 0; k < IndexVector::dimension; ++k)
+            connectivity[offset + k] = indices[k];
+        }
+        if(corners)
+        {
+          const auto geometry = it.geometry();
+          for(int k = 0; k < IndexVector::dimension; ++k)
+          {
+            const CoordVector x = geometry.corner(k);
+            for(int j = 0; j < dimension; ++j)
+              corners[(offset + k) * dimension + j] = x[j];
+          }
+        }
+      }
+    }
+  }
+
+  template<unsigned topologyId, class CoordType,
+      unsigned coerceToId, int dimension_>
+  std::shared_ptr<const typename StaticRefinement<topologyId, CoordType, coerceToId, dimension_>::Table>
+  StaticRefinement<topologyId, CoordType, coerceToId, dimension_>::
+  table(int level)
+  {
+    assert(level >= 0);
+    TableStorage &storage = tableStorage();
+    if(level < numFastLevels)
+    {
+      FastLevel &fastLevel = storage.fastLevels[level];
+      std::call_once(fastLevel.flag, [&fastLevel, level] {
+          fastLevel.table = createTable(Intervals::level(level));
+        });
+      return fastLevel.table;
+    }
+
+    // export the (huge) higher levels without holding the lock; if two
+    // threads race, the table stored first is kept
+    {
+      std::lock_guard<std::mutex> guard(storage.mutex);
+      const auto it = storage.tables.find(level);
+      if(it != storage.tables.end())
+        return it->second;
+    }
+    std::shared_ptr<const Table> table = createTable(Intervals::level(level));
+    std::lock_guard<std::mutex> guard(storage.mutex);
+    return storage.tables.emplace(level, std::move(table)).first->second;
+  }
+
+  template<unsigned topologyId, class CoordType,
+      unsigned coerceToId, int dimension_>
+  std::shared_ptr<const typename StaticRefinement<topologyId, CoordType, coerceToId, dimension_>::Table>
+  StaticRefinement<topologyId, CoordType, coerceToId, dimension_>::
+  table(const Intervals &intervals)
+  {
+    const int n = intervals.intervals(0);
+    if(intervals.isUniform() && (n & (n-1)) == 0)
+    {
+      int level = 0;
+      while((1 << level) < n)
+        ++level;
+      return table(level);
+    }
+    return createTable(intervals);
+  }
+
   /*! \} */
 
 } // namespace Dune
@@ -41,7 +41,6 @@
 
 #include <dune/common/fvector.hh>
 #include <dune/common/iteratorfacades.hh>
-#include <dune/common/power.hh>
 
 #include <dune/geometry/referenceelements.hh>
 #include <dune/geometry/axisalignedcubegeometry.hh>
@@ -67,7 +66,9 @@ namespace Dune
        * \param CoordType  Coordinate type of the refined hypercube
        *
        *  The interface is the same as for \ref Dune::StaticRefinement (apart
-       * from the template parameters).
+       * from the template parameters).  Any RefinementIntervals are
+       * supported: the number of intervals may differ between the
+       * directions, and each direction may be graded.
        */
       template<int dimension_, class CoordType>
       class RefinementImp
@@ -83,14 +84,15 @@ namespace Dune
         typedef FieldVector<CoordType, dimension> CoordVector;
         typedef typename Codim<0>::SubEntityIterator ElementIterator;
         typedef FieldVector<int, (1<<dimension)> IndexVector;
+        typedef RefinementIntervals<dimension> Intervals;
 
-        static unsigned nVertices(unsigned level);
-        static VertexIterator vBegin(unsigned level);
-        static VertexIterator vEnd(unsigned level);
+        static int nVertices(const Intervals &intervals);
+        static VertexIterator vBegin(const Intervals &intervals);
+        static VertexIterator vEnd(const Intervals &intervals);
 
-        static unsigned nElements(unsigned level);
-        static ElementIterator eBegin(unsigned level);
-        static ElementIterator eEnd(unsigned level);
+        static int nElements(const Intervals &intervals);
+        static ElementIterator eBegin(const Intervals &intervals);
+        static ElementIterator eEnd(const Intervals &intervals);
       };
 
       template<int dimension, class CoordType>
@@ -102,55 +104,61 @@ namespace Dune
       };
 
       template<int dimension, class CoordType>
-      unsigned
+      int
       RefinementImp<dimension, CoordType>::
-      nVertices(unsigned level)
+      nVertices(const Intervals &intervals)
       {
-        // return (2^level + 1)^dim
-        return Power<dimension>::eval((1u<<level)+1u);
+        // return (n_0 + 1) * ... * (n_{dim-1} + 1)
+        int n = 1;
+        for(int d = 0; d < dimension; ++d)
+          n *= intervals.intervals(d) + 1;
+        return n;
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::VertexIterator
       RefinementImp<dimension, CoordType>::
-      vBegin(unsigned level)
+      vBegin(const Intervals &intervals)
       {
-        return VertexIterator(0,level);
+        return VertexIterator(0,intervals);
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::VertexIterator
       RefinementImp<dimension, CoordType>::
-      vEnd(unsigned level)
+      vEnd(const Intervals &intervals)
       {
-        return VertexIterator(nVertices(level),level);
+        return VertexIterator(nVertices(intervals),intervals);
       }
 
       template<int dimension, class CoordType>
-      unsigned
+      int
       RefinementImp<dimension, CoordType>::
-      nElements(unsigned level)
+      nElements(const Intervals &intervals)
       {
         static_assert(dimension >= 0,
                       "Negative dimension given, what the heck is that supposed to mean?");
-        // return (2^level)^dim
-        return 1u<<(level*unsigned(dimension));
+        // return n_0 * ... * n_{dim-1}
+        int n = 1;
+        for(int d = 0; d < dimension; ++d)
+          n *= intervals.intervals(d);
+        return n;
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::ElementIterator
       RefinementImp<dimension, CoordType>::
-      eBegin(unsigned level)
+      eBegin(const Intervals &intervals)
       {
-        return ElementIterator(0,level);
+        return ElementIterator(0,intervals);
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::ElementIterator
       RefinementImp<dimension, CoordType>::
-      eEnd(unsigned level)
+      eEnd(const Intervals &intervals)
       {
-        return ElementIterator(nElements(level),level);
+        return ElementIterator(nElements(intervals),intervals);
       }
 
       //
@@ -204,7 +212,7 @@ namespace Dune
         CoordVector c;
         for (int d = 0; d < dimension; d++)
         {
-          c[d] = v[d]*1.0 / (1 << asCommon()._level);
+          c[d] = asCommon()._intervals.boundary(d, v[d]);
         }
         return c;
       }
@@ -266,7 +274,8 @@ namespace Dune
         CoordVector c;
         for (int d=0; d<dimension; d++)
         {
-          c[d] = (v[d]*1.0 + 0.5) / (1<<asCommon()._level);
+          c[d] = 0.5 * (asCommon()._intervals.boundary(d, v[d])
+                        + asCommon()._intervals.boundary(d, v[d] + 1));
         }
         return c;
       }
@@ -275,7 +284,7 @@ namespace Dune
       template<int dimension, class CoordType>
       template<int codimension>
       class RefinementImp<dimension, CoordType>::Codim<codimension>::SubEntityIterator
-        : public ForwardIteratorFacade<typename RefinementImp<dimension,
+        : public RandomAccessIteratorFacade<typename RefinementImp<dimension,
                   CoordType>::template Codim<codimension>::SubEntityIterator, int>,
           public RefinementSubEntityIteratorSpecial<dimension, CoordType, codimension>
       {
@@ -283,28 +292,31 @@ namespace Dune
         typedef RefinementImp<dimension, CoordType> Refinement;
         typedef typename Refinement::template Codim<codimension>::SubEntityIterator This;
 
-        SubEntityIterator(unsigned int index, unsigned int level);
+        SubEntityIterator(unsigned int index, const typename Refinement::Intervals &intervals);
 
         bool equals(const This &other) const;
         void increment();
+        void decrement();
+        void advance(int n);
+        int distanceTo(const This &other) const;
 
         int index() const;
         Geometry geometry () const;
       private:
         friend class RefinementSubEntityIteratorSpecial<dimension, CoordType, codimension>;
         unsigned int _index;
-        unsigned int _level;
+        typename Refinement::Intervals _intervals;
 
         std::array<unsigned int, dimension>
         cellCoord(unsigned int idx) const
         {
-          return idx2coord(idx, 1u<<_level);
+          return idx2coord(idx, 0u);
         }
 
         std::array<unsigned int, dimension>
         vertexCoord(unsigned int idx) const
         {
-          return idx2coord(idx, (1u<<_level)+1u);
+          return idx2coord(idx, 1u);
         }
 
         std::array<unsigned int, dimension>
@@ -319,12 +331,14 @@ namespace Dune
           return vertexCoord(_index);
         }
 
+        // the width in direction d is the number of intervals plus extra
         std::array<unsigned int, dimension>
-        idx2coord(unsigned int idx, unsigned int w) const
+        idx2coord(unsigned int idx, unsigned int extra) const
         {
           std::array<unsigned int, dimension> c;
           for (unsigned int d = 0; d < dimension; d++)
           {
+            const unsigned int w = _intervals.intervals(d) + extra;
             c[d] = idx%w;
             idx = idx/w;
           }
@@ -332,12 +346,12 @@ namespace Dune
         }
 
         unsigned int
-        coord2idx(std::array<unsigned int, dimension> c, unsigned int w) const
+        coord2idx(std::array<unsigned int, dimension> c, unsigned int extra) const
         {
           unsigned int i = 0;
           for (unsigned int d = dimension; d > 0; d--)
           {
-            i *= w;
+            i *= _intervals.intervals(d-1) + extra;
             i += c[d-1];
           }
           return i;
@@ -346,7 +360,7 @@ namespace Dune
         unsigned int
         vertexIdx(std::array<unsigned int, dimension> c) const
         {
-          return coord2idx(c, (1u<<_level)+1u);
+          return coord2idx(c, 1u);
         }
       };
 
@@ -354,8 +368,8 @@ namespace Dune
       template<int dimension, class CoordType>
       template<int codimension>
       RefinementImp<dimension, CoordType>::Codim<codimension>::SubEntityIterator::
-      SubEntityIterator(unsigned int index, unsigned int level)
-        : _index(index), _level(level)
+      SubEntityIterator(unsigned int index, const typename Refinement::Intervals &intervals)
+        : _index(index), _intervals(intervals)
       {}
 
       template<int dimension, class CoordType>
@@ -364,7 +378,7 @@ namespace Dune
       RefinementImp<dimension, CoordType>::Codim<codimension>::SubEntityIterator::
       equals(const This &other) const
       {
-        return ((_index == other._index) && (_level == other._level));
+        return ((_index == other._index) && (_intervals == other._intervals));
       }
 
       template<int dimension, class CoordType>
@@ -376,6 +390,33 @@ namespace Dune
         ++_index;
       }
 
+      template<int dimension, class CoordType>
+      template<int codimension>
+      void
+      RefinementImp<dimension, CoordType>::Codim<codimension>::SubEntityIterator::
+      decrement()
+      {
+        --_index;
+      }
+
+      template<int dimension, class CoordType>
+      template<int codimension>
+      void
+      RefinementImp<dimension, CoordType>::Codim<codimension>::SubEntityIterator::
+      advance(int n)
+      {
+        _index += n;
+      }
+
+      template<int dimension, class CoordType>
+      template<int codimension>
+      int
+      RefinementImp<dimension, CoordType>::Codim<codimension>::SubEntityIterator::
+      distanceTo(const This &other) const
+      {
+        return int(other._index) - int(_index);
+      }
+
       template<int dimension, class CoordType>
       template<int codimension>
       int
@@ -390,22 +431,22 @@ namespace Dune
       typename RefinementImp<dimension, CoordType>::template Codim<codimension>::Geometry
       RefinementImp<dimension, CoordType>::Codim<codimension>::SubEntityIterator::geometry () const
       {
-        std::array<unsigned int,dimension> intCoords = idx2coord(_index,1u<<_level);
-
         Dune::FieldVector<CoordType,dimension> lower;
         Dune::FieldVector<CoordType,dimension> upper;
 
         assert(codimension == 0 or codimension == dimension);
 
         if (codimension == 0) {
+          std::array<unsigned int,dimension> intCoords = cellCoord();
           for (size_t j = 0; j < dimension; j++)
           {
-            lower[j] = double(intCoords[j])     / double(1u<<_level);
-            upper[j] = double(intCoords[j] + 1) / double(1u<<_level);
+            lower[j] = _intervals.boundary(j, intCoords[j]);
+            upper[j] = _intervals.boundary(j, intCoords[j] + 1);
           }
         } else {
+          std::array<unsigned int,dimension> intCoords = vertexCoord();
           for (size_t j = 0; j < dimension; j++)
-            lower[j] = upper[j] = double(intCoords[j]) / double(1u<<_level);
+            lower[j] = upper[j] = _intervals.boundary(j, intCoords[j]);
         }
 
         return typename RefinementImp<dimension,
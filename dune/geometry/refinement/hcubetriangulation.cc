@@ -16,18 +16,31 @@
  * \defgroup HCubeTriangulation Refinement implementation for triangulating hypercubes
  * \ingroup Refinement
  *
- * Most stuff here is explained in \ref SimplexRefinement.
+ * The hypercube is refined by the \ref HCubeRefinement, and each subcube is
+ * triangulated into its \f$n!\f$ Kuhn simplices (the simplices
+ * \f$0=x_0,\ldots,x_n\f$ with \f$x_{d+1}=x_d+e_{p_d}\f$ for a permutation
+ * \f$p\f$, see \ref SimplexRefinement).  Since the Kuhn triangulations of
+ * neighbouring subcubes match, the result is a conforming triangulation
+ * and the vertices are the vertices of the subcubes.  Consequently, any
+ * intervals supported by the \ref HCubeRefinement are supported here, too.
  *
- * We simply triangulate the hypercube into Kuhn simplices, and than
- * use the \ref SimplexRefinement to do the refinement.
- *
- * We explicitly use some of the utilities from the \ref SimplexRefinement.
+ * Element \f$c\cdot n!+k\f$ is the Kuhn simplex with permutation index k of
+ * subcube c.  Its corners are ordered such that it is positively oriented.
  */
 
+#include <array>
+#include <utility>
+#include <vector>
+
+#include <dune/common/fvector.hh>
+#include <dune/common/iteratorfacades.hh>
+
+#include <dune/geometry/multilineargeometry.hh>
 #include <dune/geometry/referenceelements.hh>
 #include <dune/geometry/type.hh>
 
 #include "base.cc"
+#include "hcube.cc"
 #include "simplex.cc"
 
 namespace Dune
@@ -49,7 +62,6 @@ namespace Dune
       //
 
       using Simplex::getPermutation;
-      using Simplex::referenceToKuhn;
 
       // ////////////////////////////////////
       //
@@ -74,19 +86,20 @@ namespace Dune
         typedef FieldVector<CoordType, dimension> CoordVector;
         typedef typename Codim<0>::SubEntityIterator ElementIterator;
         typedef FieldVector<int, dimension+1> IndexVector;
+        typedef RefinementIntervals<dimension> Intervals;
 
-        static int nVertices(int level);
-        static VertexIterator vBegin(int level);
-        static VertexIterator vEnd(int level);
+        static int nVertices(const Intervals &intervals);
+        static VertexIterator vBegin(const Intervals &intervals);
+        static VertexIterator vEnd(const Intervals &intervals);
 
-        static int nElements(int level);
-        static ElementIterator eBegin(int level);
-        static ElementIterator eEnd(int level);
+        static int nElements(const Intervals &intervals);
+        static ElementIterator eBegin(const Intervals &intervals);
+        static ElementIterator eEnd(const Intervals &intervals);
       private:
         friend class RefinementIteratorSpecial<dimension, CoordType, 0>;
         friend class RefinementIteratorSpecial<dimension, CoordType, dimension>;
 
-        typedef Simplex::RefinementImp<dimension, CoordType> BackendRefinement;
+        typedef HCube::RefinementImp<dimension, CoordType> BackendRefinement;
       };
 
       template<int dimension, class CoordType>
@@ -100,49 +113,49 @@ namespace Dune
       template<int dimension, class CoordType>
       int
       RefinementImp<dimension, CoordType>::
-      nVertices(int level)
+      nVertices(const Intervals &intervals)
       {
-        return BackendRefinement::nVertices(level) * Factorial<dimension>::factorial;
+        return BackendRefinement::nVertices(intervals);
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::VertexIterator
       RefinementImp<dimension, CoordType>::
-      vBegin(int level)
+      vBegin(const Intervals &intervals)
       {
-        return VertexIterator(level);
+        return VertexIterator(BackendRefinement::vBegin(intervals));
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::VertexIterator
       RefinementImp<dimension, CoordType>::
-      vEnd(int level)
+      vEnd(const Intervals &intervals)
       {
-        return VertexIterator(level, true);
+        return VertexIterator(BackendRefinement::vEnd(intervals));
       }
 
       template<int dimension, class CoordType>
       int
       RefinementImp<dimension, CoordType>::
-      nElements(int level)
+      nElements(const Intervals &intervals)
       {
-        return BackendRefinement::nElements(level) * Factorial<dimension>::factorial;
+        return BackendRefinement::nElements(intervals) * Factorial<dimension>::factorial;
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::ElementIterator
       RefinementImp<dimension, CoordType>::
-      eBegin(int level)
+      eBegin(const Intervals &intervals)
       {
-        return ElementIterator(level);
+        return ElementIterator(BackendRefinement::eBegin(intervals));
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::ElementIterator
       RefinementImp<dimension, CoordType>::
-      eEnd(int level)
+      eEnd(const Intervals &intervals)
       {
-        return ElementIterator(level, true);
+        return ElementIterator(BackendRefinement::eEnd(intervals));
       }
 
       // //////////////
@@ -158,10 +171,13 @@ namespace Dune
         typedef RefinementImp<dimension, CoordType> Refinement;
         typedef typename Refinement::CoordVector CoordVector;
         typedef typename Refinement::template Codim<dimension>::Geometry Geometry;
-
-        RefinementIteratorSpecial(int level, bool end = false);
+        typedef RefinementIteratorSpecial<dimension, CoordType, dimension> This;
 
         void increment();
+        void decrement();
+        void advance(int n);
+        int distanceTo(const This &other) const;
+        bool equals(const This &other) const;
 
         CoordVector coords() const;
 
@@ -171,25 +187,17 @@ namespace Dune
       protected:
         typedef typename Refinement::BackendRefinement BackendRefinement;
         typedef typename BackendRefinement::template Codim<dimension>::SubEntityIterator BackendIterator;
-        enum { nKuhnSimplices = Factorial<dimension>::factorial };
 
-        int level_;
+        explicit RefinementIteratorSpecial(const BackendIterator &backend_);
 
-        int kuhnIndex;
         BackendIterator backend;
-        const BackendIterator backendEnd;
       };
 
       template<int dimension, class CoordType>
       RefinementIteratorSpecial<dimension, CoordType, dimension>::
-      RefinementIteratorSpecial(int level, bool end)
-        : level_(level), kuhnIndex(0),
-          backend(BackendRefinement::vBegin(level_)),
-          backendEnd(BackendRefinement::vEnd(level_))
-      {
-        if (end)
-          kuhnIndex = nKuhnSimplices;
-      }
+      RefinementIteratorSpecial(const BackendIterator &backend_)
+        : backend(backend_)
+      {}
 
       template<int dimension, class CoordType>
       void
@@ -197,11 +205,38 @@ namespace Dune
       increment()
       {
         ++backend;
-        if (backend == backendEnd)
-        {
-          backend = BackendRefinement::vBegin(level_);
-          ++kuhnIndex;
-        }
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementIteratorSpecial<dimension, CoordType, dimension>::
+      decrement()
+      {
+        --backend;
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementIteratorSpecial<dimension, CoordType, dimension>::
+      advance(int n)
+      {
+        backend += n;
+      }
+
+      template<int dimension, class CoordType>
+      int
+      RefinementIteratorSpecial<dimension, CoordType, dimension>::
+      distanceTo(const This &other) const
+      {
+        return other.backend - backend;
+      }
+
+      template<int dimension, class CoordType>
+      bool
+      RefinementIteratorSpecial<dimension, CoordType, dimension>::
+      equals(const This &other) const
+      {
+        return backend == other.backend;
       }
 
       template<int dimension, class CoordType>
@@ -209,7 +244,7 @@ namespace Dune
       RefinementIteratorSpecial<dimension, CoordType, dimension>::
       coords() const
       {
-        return referenceToKuhn(backend.coords(), getPermutation<dimension>(kuhnIndex));
+        return backend.coords();
       }
 
       template<int dimension, class CoordType>
@@ -217,7 +252,7 @@ namespace Dune
       RefinementIteratorSpecial<dimension, CoordType, dimension>::geometry () const
       {
         std::vector<CoordVector> corners(1);
-        corners[0] = referenceToKuhn(backend.coords(), getPermutation<dimension>(kuhnIndex));
+        corners[0] = backend.coords();
         return Geometry(GeometryType(0), corners);
       }
 
@@ -226,7 +261,7 @@ namespace Dune
       RefinementIteratorSpecial<dimension, CoordType, dimension>::
       index() const
       {
-        return kuhnIndex*BackendRefinement::nVertices(level_) + backend.index();
+        return backend.index();
       }
 
       // elements
@@ -238,11 +273,13 @@ namespace Dune
         typedef typename Refinement::IndexVector IndexVector;
         typedef typename Refinement::CoordVector CoordVector;
         typedef typename Refinement::template Codim<0>::Geometry Geometry;
-
-        RefinementIteratorSpecial(int level_, bool end = false);
-        RefinementIteratorSpecial(const RefinementIteratorSpecial<dimension, CoordType, 0> &other);
+        typedef RefinementIteratorSpecial<dimension, CoordType, 0> This;
 
         void increment();
+        void decrement();
+        void advance(int n);
+        int distanceTo(const This &other) const;
+        bool equals(const This &other) const;
 
         IndexVector vertexIndices() const;
         int index() const;
@@ -251,36 +288,24 @@ namespace Dune
         Geometry geometry() const;
 
       private:
-        CoordVector global(const CoordVector &local) const;
+        //! the corners of the Kuhn simplex as corners of the subcube
+        std::array<int, dimension+1> cubeCorners() const;
 
       protected:
         typedef typename Refinement::BackendRefinement BackendRefinement;
         typedef typename BackendRefinement::template Codim<0>::SubEntityIterator BackendIterator;
         enum { nKuhnSimplices = Factorial<dimension>::factorial };
 
-        int level_;
+        explicit RefinementIteratorSpecial(const BackendIterator &backend_);
 
         int kuhnIndex;
         BackendIterator backend;
-        const BackendIterator backendEnd;
       };
 
       template<int dimension, class CoordType>
       RefinementIteratorSpecial<dimension, CoordType, 0>::
-      RefinementIteratorSpecial(int level, bool end)
-        : level_(level), kuhnIndex(0),
-          backend(BackendRefinement::eBegin(level_)),
-          backendEnd(BackendRefinement::eEnd(level_))
-      {
-        if (end)
-          kuhnIndex = nKuhnSimplices;
-      }
-      template<int dimension, class CoordType>
-      RefinementIteratorSpecial<dimension, CoordType, 0>::
-      RefinementIteratorSpecial(const RefinementIteratorSpecial<dimension, CoordType, 0> &other)
-        : level_(other.level_), kuhnIndex(other.kuhnIndex),
-          backend(other.backend),
-          backendEnd(other.backendEnd)
+      RefinementIteratorSpecial(const BackendIterator &backend_)
+        : kuhnIndex(0), backend(backend_)
       {}
 
       template<int dimension, class CoordType>
@@ -288,24 +313,82 @@ namespace Dune
       RefinementIteratorSpecial<dimension, CoordType, 0>::
       increment()
       {
-        ++backend;
-        if (backend == backendEnd)
+        ++kuhnIndex;
+        if (kuhnIndex == nKuhnSimplices)
         {
-          backend = BackendRefinement::eBegin(level_);
-          ++kuhnIndex;
+          kuhnIndex = 0;
+          ++backend;
         }
       }
 
+      template<int dimension, class CoordType>
+      void
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      decrement()
+      {
+        advance(-1);
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      advance(int n)
+      {
+        const int target = index() + n;
+        backend += target / nKuhnSimplices - backend.index();
+        kuhnIndex = target % nKuhnSimplices;
+      }
+
+      template<int dimension, class CoordType>
+      int
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      distanceTo(const This &other) const
+      {
+        return other.index() - index();
+      }
+
+      template<int dimension, class CoordType>
+      bool
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      equals(const This &other) const
+      {
+        return kuhnIndex == other.kuhnIndex && backend == other.backend;
+      }
+
+      template<int dimension, class CoordType>
+      std::array<int, dimension+1>
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      cubeCorners() const
+      {
+        // corner d+1 is corner d moved along the direction perm[d]
+        const FieldVector<int, dimension> perm = getPermutation<dimension>(kuhnIndex);
+        std::array<int, dimension+1> corners;
+        corners[0] = 0;
+        for(int d = 0; d < dimension; ++d)
+          corners[d+1] = corners[d] | (1 << perm[d]);
+
+        // the orientation is the sign of the permutation
+        int inversions = 0;
+        for(int i = 0; i < dimension; ++i)
+          for(int j = i+1; j < dimension; ++j)
+            inversions += (perm[i] > perm[j]);
+        if(inversions % 2 == 1)
+          std::swap(corners[dimension-1], corners[dimension]);
+        return corners;
+      }
+
       template<int dimension, class CoordType>
       typename RefinementIteratorSpecial<dimension, CoordType, 0>::IndexVector
       RefinementIteratorSpecial<dimension, CoordType, 0>::
       vertexIndices() const
       {
-        IndexVector indices = backend.vertexIndices();
-
-        int base = kuhnIndex * BackendRefinement::nVertices(level_);
-        indices += base;
+        // the HCube refinement numbers the vertices of a subcube in reverse
+        const typename BackendIterator::IndexVector cubeIndices = backend.vertexIndices();
+        const std::array<int, dimension+1> corners = cubeCorners();
 
+        IndexVector indices;
+        for(int i = 0; i <= dimension; ++i)
+          indices[i] = cubeIndices[(1 << dimension) - 1 - corners[i]];
         return indices;
       }
 
@@ -314,7 +397,7 @@ namespace Dune
       RefinementIteratorSpecial<dimension, CoordType, 0>::
       index() const
       {
-        return kuhnIndex*BackendRefinement::nElements(level_) + backend.index();
+        return backend.index()*nKuhnSimplices + kuhnIndex;
       }
 
       template<int dimension, class CoordType>
@@ -322,64 +405,50 @@ namespace Dune
       RefinementIteratorSpecial<dimension, CoordType, 0>::
       coords() const
       {
-        return global(backend.coords());
+        const typename BackendRefinement::template Codim<0>::Geometry bgeo = backend.geometry();
+        const std::array<int, dimension+1> cubeCorners = this->cubeCorners();
+        CoordVector center(0);
+        for(int i = 0; i <= dimension; ++i)
+          center += bgeo.corner(cubeCorners[i]);
+        center /= CoordType(dimension+1);
+        return center;
       }
 
       template<int dimension, class CoordType>
       typename RefinementIteratorSpecial<dimension, CoordType, 0>::Geometry
       RefinementIteratorSpecial<dimension, CoordType, 0>::geometry () const
       {
-        const typename BackendIterator::Geometry &bgeo =
-          backend.geometry();
+        const typename BackendRefinement::template Codim<0>::Geometry bgeo = backend.geometry();
+        const std::array<int, dimension+1> cubeCorners = this->cubeCorners();
         std::vector<CoordVector> corners(dimension+1);
         for(int i = 0; i <= dimension; ++i)
-          corners[i] = global(bgeo.corner(i));
+          corners[i] = bgeo.corner(cubeCorners[i]);
 
-        return Geometry(bgeo.type(), corners);
-      }
-
-      template<int dimension, class CoordType>
-      typename RefinementIteratorSpecial<dimension, CoordType, 0>::CoordVector
-      RefinementIteratorSpecial<dimension, CoordType, 0>::
-      global(const CoordVector &local) const
-      {
-        return referenceToKuhn(local, getPermutation<dimension>(kuhnIndex));
+        return Geometry(GeometryType(GeometryType::simplex, dimension), corners);
       }
 
       // common
       template<int dimension, class CoordType>
       template<int codimension>
       class RefinementImp<dimension, CoordType>::Codim<codimension>::SubEntityIterator
-        : public ForwardIteratorFacade<typename RefinementImp<dimension, CoordType>::template Codim<codimension>::SubEntityIterator, int>,
+        : public RandomAccessIteratorFacade<typename RefinementImp<dimension, CoordType>::template Codim<codimension>::SubEntityIterator, int>,
           public RefinementIteratorSpecial<dimension, CoordType, codimension>
       {
       public:
         typedef RefinementImp<dimension, CoordType> Refinement;
-        typedef SubEntityIterator This;
-
-        SubEntityIterator(int level, bool end = false);
+        typedef typename RefinementIteratorSpecial<dimension, CoordType, codimension>::BackendIterator BackendIterator;
 
-        bool equals(const This &other) const;
-      protected:
-        using RefinementIteratorSpecial<dimension, CoordType, codimension>::kuhnIndex;
-        using RefinementIteratorSpecial<dimension, CoordType, codimension>::backend;
+        explicit SubEntityIterator(const BackendIterator &backend);
       };
 
 #ifndef DOXYGEN
       template<int dimension, class CoordType>
       template<int codimension>
       RefinementImp<dimension, CoordType>::Codim<codimension>::SubEntityIterator::
-      SubEntityIterator(int level, bool end)
-        : RefinementIteratorSpecial<dimension, CoordType, codimension>(level, end)
+      SubEntityIterator(const BackendIterator &backend)
+        : RefinementIteratorSpecial<dimension, CoordType, codimension>(backend)
       {}
 
-      template<int dimension, class CoordType>
-      template<int codimension>
-      bool
-      RefinementImp<dimension, CoordType>::Codim<codimension>::SubEntityIterator::
-      equals(const This &other) const
-      { return kuhnIndex == other.kuhnIndex && backend == other.backend; }
-
 #endif // DOXYGEN
 
     } // namespace HCubeTriangulation
@@ -3,9 +3,17 @@
 #ifndef DUNE_GEOMETRY_REFINEMENT_PRISMTRIANGULATION_CC
 #define DUNE_GEOMETRY_REFINEMENT_PRISMTRIANGULATION_CC
 
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+#include <dune/common/exceptions.hh>
 #include <dune/common/fvector.hh>
+#include <dune/common/iteratorfacades.hh>
 #include <dune/common/typetraits.hh>
 
+#include <dune/geometry/multilineargeometry.hh>
 #include <dune/geometry/referenceelements.hh>
 #include <dune/geometry/type.hh>
 
@@ -29,7 +37,8 @@ namespace Dune
       //
 
       using Simplex::getPermutation;
-      using Simplex::referenceToKuhn;
+      using Simplex::kuhnToReference;
+      using Simplex::pointFromIndex;
 
       // ////////////////////////////////////
       //
@@ -39,26 +48,25 @@ namespace Dune
       // forward declaration of the iterator base
       template<int dimension, class CoordType, int codimension>
       class RefinementIteratorSpecial;
-      /*
-       * The permutations 0,2 and 3 of the Kuhn-decomposition of a cube into simplices form a prism.
-       * The resulting prism is not oriented the same as the reference prism and so the Kuhn-coordinates
-       * have to be transformed using the method below.
-       */
-      template<int dimension, class CoordType> FieldVector<CoordType, dimension>
-      transformCoordinate(FieldVector<CoordType, dimension> point)
-      {
-        FieldVector<CoordType, dimension> transform;
-        transform[0] = point[1];
-        transform[1] = 1 - point[0];
-        transform[2] = point[2];
-        return transform;
-      }
 
       /*!
        * \brief Implementation of the refinement of a prism into simplices.
        *
-       * Note that the virtual vertices of two intersecting simplices might have copies, i.e.
-       * by running over all vertices using the VertexIterator you might run over some twice.
+       * The triangle of the prism (directions 0 and 1) is refined by the
+       * \ref SimplexRefinement, the height (direction 2) is divided into
+       * layers.  Each of the resulting subprisms is split into three
+       * tetrahedra along the diagonals that connect the lower vertex index at
+       * the bottom with the higher vertex index at the top of each side face,
+       * so the triangulation is conforming.
+       *
+       * Vertex \f$k\cdot N_V+t\f$ is vertex t of the refined triangle in
+       * layer k, where \f$N_V\f$ is the number of vertices of the refined
+       * triangle.  Element \f$3(k\cdot N_E+s)+j\f$ is tetrahedron j of the
+       * subprism above triangle s in layer k.
+       *
+       * The triangle needs the same number of intervals of equal length in
+       * the directions 0 and 1, the height may have any number of (graded)
+       * intervals.
        */
       template<int dimension_, class CoordType>
       class RefinementImp
@@ -74,20 +82,24 @@ namespace Dune
         typedef FieldVector<CoordType, dimension> CoordVector;
         typedef typename Codim<0>::SubEntityIterator ElementIterator;
         typedef FieldVector<int, dimension+1> IndexVector;
+        typedef RefinementIntervals<dimension> Intervals;
 
-        static int nVertices(int level);
-        static VertexIterator vBegin(int level);
-        static VertexIterator vEnd(int level);
+        static int nVertices(const Intervals &intervals);
+        static VertexIterator vBegin(const Intervals &intervals);
+        static VertexIterator vEnd(const Intervals &intervals);
 
-        static int nElements(int level);
-        static ElementIterator eBegin(int level);
-        static ElementIterator eEnd(int level);
+        static int nElements(const Intervals &intervals);
+        static ElementIterator eBegin(const Intervals &intervals);
+        static ElementIterator eEnd(const Intervals &intervals);
 
       private:
         friend class RefinementIteratorSpecial<dimension, CoordType, 0>;
         friend class RefinementIteratorSpecial<dimension, CoordType, dimension>;
 
-        typedef Simplex::RefinementImp<dimension, CoordType> BackendRefinement;
+        typedef Simplex::RefinementImp<dimension-1, CoordType> BackendRefinement;
+
+        //! the intervals of the triangle, throws NotImplemented if unsupported
+        static typename BackendRefinement::Intervals triangleIntervals(const Intervals &intervals);
       };
 
       template<int dimension, class CoordType>
@@ -98,52 +110,66 @@ namespace Dune
         typedef Dune::MultiLinearGeometry<CoordType,dimension-codimension,dimension> Geometry;
       };
 
+      template<int dimension, class CoordType>
+      typename RefinementImp<dimension, CoordType>::BackendRefinement::Intervals
+      RefinementImp<dimension, CoordType>::
+      triangleIntervals(const Intervals &intervals)
+      {
+        if(intervals.intervals(0) != intervals.intervals(1)
+           || !intervals.isUniform(0) || !intervals.isUniform(1))
+          DUNE_THROW(NotImplemented, "Refinement of prisms needs the same number of "
+                     "intervals of equal length in the directions 0 and 1.");
+        return typename BackendRefinement::Intervals(intervals.intervals(0));
+      }
+
       template<int dimension, class CoordType>
       int
       RefinementImp<dimension, CoordType>::
-      nVertices(int level)
+      nVertices(const Intervals &intervals)
       {
-        return BackendRefinement::nVertices(level) * 3;
+        return BackendRefinement::nVertices(triangleIntervals(intervals))
+               * (intervals.intervals(dimension-1) + 1);
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::VertexIterator
       RefinementImp<dimension, CoordType>::
-      vBegin(int level)
+      vBegin(const Intervals &intervals)
       {
-        return VertexIterator(level);
+        return VertexIterator(intervals);
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::VertexIterator
       RefinementImp<dimension, CoordType>::
-      vEnd(int level)
+      vEnd(const Intervals &intervals)
       {
-        return VertexIterator(level, true);
+        return VertexIterator(intervals, true);
       }
 
       template<int dimension, class CoordType>
       int
       RefinementImp<dimension, CoordType>::
-      nElements(int level)
+      nElements(const Intervals &intervals)
       {
-        return BackendRefinement::nElements(level) * 3;
+        return BackendRefinement::nElements(triangleIntervals(intervals))
+               * intervals.intervals(dimension-1) * 3;
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::ElementIterator
       RefinementImp<dimension, CoordType>::
-      eBegin(int level)
+      eBegin(const Intervals &intervals)
       {
-        return ElementIterator(level);
+        return ElementIterator(intervals);
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::ElementIterator
       RefinementImp<dimension, CoordType>::
-      eEnd(int level)
+      eEnd(const Intervals &intervals)
       {
-        return ElementIterator(level, true);
+        return ElementIterator(intervals, true);
       }
 
       // //////////////
@@ -159,49 +185,88 @@ namespace Dune
         typedef RefinementImp<dimension, CoordType> Refinement;
         typedef typename Refinement::CoordVector CoordVector;
         typedef typename Refinement::template Codim<dimension>::Geometry Geometry;
+        typedef RefinementIteratorSpecial<dimension, CoordType, dimension> This;
 
-        RefinementIteratorSpecial(int level, bool end = false);
+        RefinementIteratorSpecial(const typename Refinement::Intervals &intervals, bool end = false);
 
         void increment();
+        void decrement();
+        void advance(int n);
+        int distanceTo(const This &other) const;
+        bool equals(const This &other) const;
 
         CoordVector coords() const;
-        Geometry geometry () const;
+
+        Geometry geometry() const;
 
         int index() const;
       protected:
         typedef typename Refinement::BackendRefinement BackendRefinement;
-        typedef typename BackendRefinement::template Codim<dimension>::SubEntityIterator BackendIterator;
-        enum { nKuhnSimplices = 3 };
+        typedef typename BackendRefinement::template Codim<dimension-1>::SubEntityIterator BackendIterator;
 
-        int level_;
+        typename Refinement::Intervals intervals_;
+        int nTriangleVertices_;
 
-        int kuhnIndex;
+        int layer;
         BackendIterator backend;
-        const BackendIterator backendEnd;
       };
 
       template<int dimension, class CoordType>
       RefinementIteratorSpecial<dimension, CoordType, dimension>::
-      RefinementIteratorSpecial(int level, bool end)
-        : level_(level), kuhnIndex(0),
-          backend(BackendRefinement::vBegin(level_)),
-          backendEnd(BackendRefinement::vEnd(level_))
-      {
-        if (end)
-          kuhnIndex = nKuhnSimplices;
-      }
+      RefinementIteratorSpecial(const typename Refinement::Intervals &intervals, bool end)
+        : intervals_(intervals),
+          nTriangleVertices_(BackendRefinement::nVertices(Refinement::triangleIntervals(intervals))),
+          layer(end ? intervals.intervals(dimension-1) + 1 : 0),
+          backend(BackendRefinement::vBegin(Refinement::triangleIntervals(intervals)))
+      {}
 
       template<int dimension, class CoordType>
       void
       RefinementIteratorSpecial<dimension, CoordType, dimension>::
       increment()
       {
-        ++backend;
-        if (backend == backendEnd)
+        if(backend.index() + 1 == nTriangleVertices_)
         {
-          backend = BackendRefinement::vBegin(level_);
-          ++kuhnIndex;
+          backend -= nTriangleVertices_ - 1;
+          ++layer;
         }
+        else
+          ++backend;
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementIteratorSpecial<dimension, CoordType, dimension>::
+      decrement()
+      {
+        advance(-1);
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementIteratorSpecial<dimension, CoordType, dimension>::
+      advance(int n)
+      {
+        const int target = index() + n;
+        layer = target / nTriangleVertices_;
+        backend += target % nTriangleVertices_ - backend.index();
+      }
+
+      template<int dimension, class CoordType>
+      int
+      RefinementIteratorSpecial<dimension, CoordType, dimension>::
+      distanceTo(const This &other) const
+      {
+        return other.index() - index();
+      }
+
+      template<int dimension, class CoordType>
+      bool
+      RefinementIteratorSpecial<dimension, CoordType, dimension>::
+      equals(const This &other) const
+      {
+        return layer == other.layer && backend.index() == other.backend.index()
+               && intervals_ == other.intervals_;
       }
 
       template<int dimension, class CoordType>
@@ -209,9 +274,12 @@ namespace Dune
       RefinementIteratorSpecial<dimension, CoordType, dimension>::
       coords() const
       {
-        // while the kuhnIndex runs from 0,1,2 the actual permutations we need are 0,2,3
-        return transformCoordinate(referenceToKuhn(backend.coords(),
-                                                   getPermutation<dimension>((kuhnIndex + 2) % 4)));
+        const FieldVector<CoordType, dimension-1> x = backend.coords();
+        CoordVector coords;
+        for(int i = 0; i < dimension-1; ++i)
+          coords[i] = x[i];
+        coords[dimension-1] = intervals_.boundary(dimension-1, layer);
+        return coords;
       }
 
       template<int dimension, class CoordType>
@@ -219,8 +287,7 @@ namespace Dune
       RefinementIteratorSpecial<dimension, CoordType, dimension>::geometry () const
       {
         std::vector<CoordVector> corners(1);
-        corners[0] = transformCoordinate(referenceToKuhn(backend.coords(),
-                                                         getPermutation<dimension>((kuhnIndex + 2) % 4)));
+        corners[0] = coords();
         return Geometry(GeometryType(0), corners);
       }
 
@@ -229,7 +296,7 @@ namespace Dune
       RefinementIteratorSpecial<dimension, CoordType, dimension>::
       index() const
       {
-        return kuhnIndex*BackendRefinement::nVertices(level_) + backend.index();
+        return layer*nTriangleVertices_ + backend.index();
       }
 
       // elements
@@ -241,41 +308,57 @@ namespace Dune
         typedef typename Refinement::IndexVector IndexVector;
         typedef typename Refinement::CoordVector CoordVector;
         typedef typename Refinement::template Codim<0>::Geometry Geometry;
+        typedef RefinementIteratorSpecial<dimension, CoordType, 0> This;
 
-        RefinementIteratorSpecial(int level, bool end = false);
+        RefinementIteratorSpecial(const typename Refinement::Intervals &intervals, bool end = false);
 
         void increment();
+        void decrement();
+        void advance(int n);
+        int distanceTo(const This &other) const;
+        bool equals(const This &other) const;
 
         IndexVector vertexIndices() const;
         int index() const;
         CoordVector coords() const;
 
-        Geometry geometry () const;
+        Geometry geometry() const;
 
       private:
-        CoordVector global(const CoordVector &local) const;
+        //! sort the vertices of the current triangle by index
+        void sortTriangle();
+        //! the corners as (triangle vertex, layer) pairs
+        std::array<std::pair<int, int>, dimension+1> corners() const;
+        CoordVector corner(const std::pair<int, int> &vertex) const;
 
       protected:
         typedef typename Refinement::BackendRefinement BackendRefinement;
         typedef typename BackendRefinement::template Codim<0>::SubEntityIterator BackendIterator;
-        enum { nKuhnSimplices = 3};
+        enum { nSubprismSimplices = 3 };
 
-        int level_;
+        typename Refinement::Intervals intervals_;
+        int nTriangleVertices_;
+        int nTriangleElements_;
 
-        int kuhnIndex;
+        int layer;
+        int simplexIndex;
         BackendIterator backend;
-        const BackendIterator backendEnd;
+        // the vertices of the triangle of backend sorted by index and
+        // whether they are in counterclockwise order
+        std::array<int, 3> triangle_;
+        bool counterclockwise_;
       };
 
       template<int dimension, class CoordType>
       RefinementIteratorSpecial<dimension, CoordType, 0>::
-      RefinementIteratorSpecial(int level, bool end)
-        : level_(level), kuhnIndex(0),
-          backend(BackendRefinement::eBegin(level_)),
-          backendEnd(BackendRefinement::eEnd(level_))
+      RefinementIteratorSpecial(const typename Refinement::Intervals &intervals, bool end)
+        : intervals_(intervals),
+          nTriangleVertices_(BackendRefinement::nVertices(Refinement::triangleIntervals(intervals))),
+          nTriangleElements_(BackendRefinement::nElements(Refinement::triangleIntervals(intervals))),
+          layer(end ? intervals.intervals(dimension-1) : 0), simplexIndex(0),
+          backend(BackendRefinement::eBegin(Refinement::triangleIntervals(intervals)))
       {
-        if (end)
-          kuhnIndex = nKuhnSimplices;
+        sortTriangle();
       }
 
       template<int dimension, class CoordType>
@@ -283,101 +366,189 @@ namespace Dune
       RefinementIteratorSpecial<dimension, CoordType, 0>::
       increment()
       {
-        ++backend;
-        if (backend == backendEnd)
+        ++simplexIndex;
+        if(simplexIndex < nSubprismSimplices)
+          return;
+        simplexIndex = 0;
+        if(backend.index() + 1 == nTriangleElements_)
         {
-          backend = BackendRefinement::eBegin(level_);
-          ++kuhnIndex;
+          backend -= nTriangleElements_ - 1;
+          ++layer;
         }
+        else
+          ++backend;
+        sortTriangle();
       }
 
       template<int dimension, class CoordType>
-      typename RefinementIteratorSpecial<dimension, CoordType, 0>::IndexVector
+      void
       RefinementIteratorSpecial<dimension, CoordType, 0>::
-      vertexIndices() const
+      decrement()
       {
-        IndexVector indices = backend.vertexIndices();
-
-        int base = kuhnIndex * BackendRefinement::nVertices(level_);
-        indices += base;
+        advance(-1);
+      }
 
-        return indices;
+      template<int dimension, class CoordType>
+      void
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      advance(int n)
+      {
+        const int target = index() + n;
+        const int subprism = target / nSubprismSimplices;
+        simplexIndex = target % nSubprismSimplices;
+        layer = subprism / nTriangleElements_;
+        backend += subprism % nTriangleElements_ - backend.index();
+        sortTriangle();
       }
 
       template<int dimension, class CoordType>
       int
       RefinementIteratorSpecial<dimension, CoordType, 0>::
-      index() const
+      distanceTo(const This &other) const
+      {
+        return other.index() - index();
+      }
+
+      template<int dimension, class CoordType>
+      bool
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      equals(const This &other) const
+      {
+        return index() == other.index() && intervals_ == other.intervals_;
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      sortTriangle()
+      {
+        // The Simplex refinement numbers the vertices of each triangle
+        // counterclockwise.  Sorting them by index determines the diagonals
+        // of the side faces.
+        const typename BackendIterator::IndexVector triangle = backend.vertexIndices();
+        std::array<int, 3> &p = triangle_;
+        p = {{ triangle[0], triangle[1], triangle[2] }};
+        counterclockwise_ = true;
+        for(int i = 0; i < 2; ++i)
+          for(int j = 0; j < 2-i; ++j)
+            if(p[j] > p[j+1])
+            {
+              std::swap(p[j], p[j+1]);
+              counterclockwise_ = !counterclockwise_;
+            }
+      }
+
+      template<int dimension, class CoordType>
+      std::array<std::pair<int, int>, dimension+1>
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      corners() const
       {
-        return kuhnIndex*BackendRefinement::nElements(level_) + backend.index();
+        const std::array<int, 3> &p = triangle_;
+
+        // tetrahedron j has the first 3-j corners at the bottom and the
+        // others at the top of the subprism
+        std::array<std::pair<int, int>, dimension+1> corners;
+        for(int c = 0; c <= dimension; ++c)
+          corners[c] = (c < 3 - simplexIndex ? std::make_pair(p[c], layer)
+                                             : std::make_pair(p[c-1], layer+1));
+
+        // the tetrahedra 0 and 2 have the orientation of the bottom
+        // triangle, tetrahedron 1 has the opposite one
+        if(counterclockwise_ == (simplexIndex == 1))
+          std::swap(corners[dimension-1], corners[dimension]);
+        return corners;
       }
 
       template<int dimension, class CoordType>
       typename RefinementIteratorSpecial<dimension, CoordType, 0>::CoordVector
       RefinementIteratorSpecial<dimension, CoordType, 0>::
-      coords() const
+      corner(const std::pair<int, int> &vertex) const
       {
-        return global(backend.coords());
+        // the vertex of the triangle as in the vertex iterator of the Simplex
+        // refinement, but without constructing and advancing an iterator
+        const int size = intervals_.intervals(0);
+        const FieldVector<int, dimension-1> x
+          = kuhnToReference(pointFromIndex<dimension-1>(vertex.first, size), getPermutation<dimension-1>(0));
+        CoordVector coords;
+        for(int i = 0; i < dimension-1; ++i)
+          coords[i] = CoordType(x[i]) / size;
+        coords[dimension-1] = intervals_.boundary(dimension-1, vertex.second);
+        return coords;
       }
 
       template<int dimension, class CoordType>
-      typename RefinementIteratorSpecial<dimension, CoordType, 0>::Geometry
-      RefinementIteratorSpecial<dimension, CoordType, 0>::geometry () const
+      typename RefinementIteratorSpecial<dimension, CoordType, 0>::IndexVector
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      vertexIndices() const
       {
-        const typename BackendIterator::Geometry &bgeo =
-          backend.geometry();
-        std::vector<CoordVector> corners(dimension+1);
-        for(int i = 0; i <= dimension; ++i)
-          corners[i] = global(bgeo.corner(i));
+        const std::array<std::pair<int, int>, dimension+1> corners = this->corners();
+        IndexVector indices;
+        for(int c = 0; c <= dimension; ++c)
+          indices[c] = corners[c].second*nTriangleVertices_ + corners[c].first;
+        return indices;
+      }
 
-        return Geometry(bgeo.type(), corners);
+      template<int dimension, class CoordType>
+      int
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      index() const
+      {
+        return (layer*nTriangleElements_ + backend.index())*nSubprismSimplices + simplexIndex;
       }
 
       template<int dimension, class CoordType>
       typename RefinementIteratorSpecial<dimension, CoordType, 0>::CoordVector
       RefinementIteratorSpecial<dimension, CoordType, 0>::
-      global(const CoordVector &local) const
+      coords() const
+      {
+        // the tetrahedron contains each vertex of the triangle once and
+        // additionally the vertex 2-j (sorted by index) on the other layer,
+        // so a single vertex has to be looked up
+        CoordVector center = corner(std::make_pair(triangle_[2-simplexIndex], layer));
+        const FieldVector<CoordType, dimension-1> x = backend.coords();
+        for(int i = 0; i < dimension-1; ++i)
+          center[i] += 3*x[i];
+        center[dimension-1] = (3-simplexIndex)*intervals_.boundary(dimension-1, layer)
+                              + (1+simplexIndex)*intervals_.boundary(dimension-1, layer+1);
+        center /= CoordType(dimension+1);
+        return center;
+      }
+
+      template<int dimension, class CoordType>
+      typename RefinementIteratorSpecial<dimension, CoordType, 0>::Geometry
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      geometry() const
       {
-        // while the kuhnIndex runs from 0,1,2 the actual permutations we need are 0,2,3
-        return transformCoordinate(referenceToKuhn(local, getPermutation<dimension>((kuhnIndex+2)%4)));
+        const std::array<std::pair<int, int>, dimension+1> corners = this->corners();
+        std::vector<CoordVector> coords(dimension+1);
+        for(int c = 0; c <= dimension; ++c)
+          coords[c] = corner(corners[c]);
+        return Geometry(GeometryType(GeometryType::simplex, dimension), coords);
       }
 
       // common
       template<int dimension, class CoordType>
       template<int codimension>
       class RefinementImp<dimension, CoordType>::Codim<codimension>::SubEntityIterator
-        : public ForwardIteratorFacade<typename RefinementImp<dimension, CoordType>::template Codim<codimension>::SubEntityIterator, int>,
+        : public RandomAccessIteratorFacade<typename RefinementImp<dimension, CoordType>::template Codim<codimension>::SubEntityIterator, int>,
           public RefinementIteratorSpecial<dimension, CoordType, codimension>
       {
       public:
         typedef RefinementImp<dimension, CoordType> Refinement;
-        typedef SubEntityIterator This;
 
-        SubEntityIterator(int level, bool end = false);
-
-        bool equals(const This &other) const;
-      protected:
-        using RefinementIteratorSpecial<dimension, CoordType, codimension>::kuhnIndex;
-        using RefinementIteratorSpecial<dimension, CoordType, codimension>::backend;
+        SubEntityIterator(const typename Refinement::Intervals &intervals, bool end = false);
       };
 
 #ifndef DOXYGEN
+
       template<int dimension, class CoordType>
       template<int codimension>
       RefinementImp<dimension, CoordType>::Codim<codimension>::SubEntityIterator::
-      SubEntityIterator(int level, bool end)
-        : RefinementIteratorSpecial<dimension, CoordType, codimension>(level, end)
+      SubEntityIterator(const typename Refinement::Intervals &intervals, bool end)
+        : RefinementIteratorSpecial<dimension, CoordType, codimension>(intervals, end)
       {}
 
-      template<int dimension, class CoordType>
-      template<int codimension>
-      bool
-      RefinementImp<dimension, CoordType>::Codim<codimension>::SubEntityIterator::
-      equals(const This &other) const
-      {
-        return ((kuhnIndex == other.kuhnIndex) && (backend == other.backend));
-      }
-#endif
+#endif // DOXYGEN
 
     } // namespace PrismTriangulation
   } // namespace RefinementImp
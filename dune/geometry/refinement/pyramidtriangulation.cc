@@ -60,6 +60,10 @@ namespace Dune
        *
        * Note that the virtual vertices of two intersecting simplices might have copies, i.e.
        * by running over all vertices using the VertexIterator you might run over some twice.
+       *
+       * The two Kuhn simplices are refined by the \ref SimplexRefinement, so only
+       * the same number of intervals of equal length in each direction is
+       * supported.
        */
       template<int dimension_, class CoordType>
       class RefinementImp
@@ -75,14 +79,15 @@ namespace Dune
         typedef FieldVector<CoordType, dimension> CoordVector;
         typedef typename Codim<0>::SubEntityIterator ElementIterator;
         typedef FieldVector<int, dimension+1> IndexVector;
+        typedef RefinementIntervals<dimension> Intervals;
 
-        static int nVertices(int level);
-        static VertexIterator vBegin(int level);
-        static VertexIterator vEnd(int level);
+        static int nVertices(const Intervals &intervals);
+        static VertexIterator vBegin(const Intervals &intervals);
+        static VertexIterator vEnd(const Intervals &intervals);
 
-        static int nElements(int level);
-        static ElementIterator eBegin(int level);
-        static ElementIterator eEnd(int level);
+        static int nElements(const Intervals &intervals);
+        static ElementIterator eBegin(const Intervals &intervals);
+        static ElementIterator eEnd(const Intervals &intervals);
 
       private:
         friend class RefinementIteratorSpecial<dimension, CoordType, 0>;
@@ -104,49 +109,49 @@ namespace Dune
       template<int dimension, class CoordType>
       int
       RefinementImp<dimension, CoordType>::
-      nVertices(int level)
+      nVertices(const Intervals &intervals)
       {
-        return BackendRefinement::nVertices(level) * nKuhnSimplices;
+        return BackendRefinement::nVertices(intervals) * nKuhnSimplices;
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::VertexIterator
       RefinementImp<dimension, CoordType>::
-      vBegin(int level)
+      vBegin(const Intervals &intervals)
       {
-        return VertexIterator(level);
+        return VertexIterator(intervals);
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::VertexIterator
       RefinementImp<dimension, CoordType>::
-      vEnd(int level)
+      vEnd(const Intervals &intervals)
       {
-        return VertexIterator(level, true);
+        return VertexIterator(intervals, true);
       }
 
       template<int dimension, class CoordType>
       int
       RefinementImp<dimension, CoordType>::
-      nElements(int level)
+      nElements(const Intervals &intervals)
       {
-        return BackendRefinement::nElements(level) * nKuhnSimplices;
+        return BackendRefinement::nElements(intervals) * nKuhnSimplices;
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::ElementIterator
       RefinementImp<dimension, CoordType>::
-      eBegin(int level)
+      eBegin(const Intervals &intervals)
       {
-        return ElementIterator(level);
+        return ElementIterator(intervals);
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::ElementIterator
       RefinementImp<dimension, CoordType>::
-      eEnd(int level)
+      eEnd(const Intervals &intervals)
       {
-        return ElementIterator(level, true);
+        return ElementIterator(intervals, true);
       }
 
       // //////////////
@@ -163,7 +168,7 @@ namespace Dune
         typedef typename Refinement::CoordVector CoordVector;
         typedef typename Refinement::template Codim<dimension>::Geometry Geometry;
 
-        RefinementIteratorSpecial(int level, bool end = false);
+        RefinementIteratorSpecial(const typename Refinement::Intervals &intervals, bool end = false);
 
         void increment();
 
@@ -177,7 +182,7 @@ namespace Dune
         typedef typename BackendRefinement::template Codim<dimension>::SubEntityIterator BackendIterator;
         enum { nKuhnSimplices = 2 };
 
-        int level_;
+        typename Refinement::Intervals intervals_;
 
         int kuhnIndex;
         BackendIterator backend;
@@ -186,10 +191,10 @@ namespace Dune
 
       template<int dimension, class CoordType>
       RefinementIteratorSpecial<dimension, CoordType, dimension>::
-      RefinementIteratorSpecial(int level, bool end)
-        : level_(level), kuhnIndex(0),
-          backend(BackendRefinement::vBegin(level_)),
-          backendEnd(BackendRefinement::vEnd(level_))
+      RefinementIteratorSpecial(const typename Refinement::Intervals &intervals, bool end)
+        : intervals_(intervals), kuhnIndex(0),
+          backend(BackendRefinement::vBegin(intervals_)),
+          backendEnd(BackendRefinement::vEnd(intervals_))
       {
         if (end)
           kuhnIndex = nKuhnSimplices;
@@ -203,7 +208,7 @@ namespace Dune
         ++backend;
         if(backend == backendEnd)
         {
-          backend = BackendRefinement::vBegin(level_);
+          backend = BackendRefinement::vBegin(intervals_);
           ++kuhnIndex;
         }
       }
@@ -222,7 +227,7 @@ namespace Dune
       RefinementIteratorSpecial<dimension, CoordType, dimension>::geometry () const
       {
         std::vector<CoordVector> corners(1);
-        corners[0] = referenceToKuhn(backend.coords(), getPermutation<dimension>(kuhnIndex));
+        corners[0] = coords();
         return Geometry(GeometryType(0), corners);
       }
 
@@ -231,7 +236,7 @@ namespace Dune
       RefinementIteratorSpecial<dimension, CoordType, dimension>::
       index() const
       {
-        return kuhnIndex*BackendRefinement::nVertices(level_) + backend.index();
+        return kuhnIndex*BackendRefinement::nVertices(intervals_) + backend.index();
       }
 
       // elements
@@ -244,7 +249,7 @@ namespace Dune
         typedef typename Refinement::CoordVector CoordVector;
         typedef typename Refinement::template Codim<0>::Geometry Geometry;
 
-        RefinementIteratorSpecial(int level, bool end = false);
+        RefinementIteratorSpecial(const typename Refinement::Intervals &intervals, bool end = false);
 
         void increment();
 
@@ -262,7 +267,7 @@ namespace Dune
         typedef typename BackendRefinement::template Codim<0>::SubEntityIterator BackendIterator;
         enum { nKuhnSimplices = 2};
 
-        int level_;
+        typename Refinement::Intervals intervals_;
 
         int kuhnIndex;
         BackendIterator backend;
@@ -271,10 +276,10 @@ namespace Dune
 
       template<int dimension, class CoordType>
       RefinementIteratorSpecial<dimension, CoordType, 0>::
-      RefinementIteratorSpecial(int level, bool end)
-        : level_(level), kuhnIndex(0),
-          backend(BackendRefinement::eBegin(level_)),
-          backendEnd(BackendRefinement::eEnd(level_))
+      RefinementIteratorSpecial(const typename Refinement::Intervals &intervals, bool end)
+        : intervals_(intervals), kuhnIndex(0),
+          backend(BackendRefinement::eBegin(intervals_)),
+          backendEnd(BackendRefinement::eEnd(intervals_))
       {
         if (end)
           kuhnIndex = nKuhnSimplices;
@@ -288,7 +293,7 @@ namespace Dune
         ++backend;
         if (backend == backendEnd)
         {
-          backend = BackendRefinement::eBegin(level_);
+          backend = BackendRefinement::eBegin(intervals_);
           ++kuhnIndex;
         }
       }
@@ -300,7 +305,7 @@ namespace Dune
       {
         IndexVector indices = backend.vertexIndices();
 
-        int base = kuhnIndex * BackendRefinement::nVertices(level_);
+        int base = kuhnIndex * BackendRefinement::nVertices(intervals_);
         indices += base;
 
         return indices;
@@ -311,7 +316,7 @@ namespace Dune
       RefinementIteratorSpecial<dimension, CoordType, 0>::
       index() const
       {
-        return kuhnIndex*BackendRefinement::nElements(level_) + backend.index();
+        return kuhnIndex*BackendRefinement::nElements(intervals_) + backend.index();
       }
 
       template<int dimension, class CoordType>
@@ -357,7 +362,7 @@ namespace Dune
         typedef RefinementImp<dimension, CoordType> Refinement;
         typedef SubEntityIterator This;
 
-        SubEntityIterator(int level, bool end = false);
+        SubEntityIterator(const typename Refinement::Intervals &intervals, bool end = false);
 
         bool equals(const This &other) const;
       protected:
@@ -369,8 +374,8 @@ namespace Dune
       template<int dimension, class CoordType>
       template<int codimension>
       RefinementImp<dimension, CoordType>::Codim<codimension>::SubEntityIterator::
-      SubEntityIterator(int level, bool end)
-        : RefinementIteratorSpecial<dimension, CoordType, codimension>(level, end)
+      SubEntityIterator(const typename Refinement::Intervals &intervals, bool end)
+        : RefinementIteratorSpecial<dimension, CoordType, codimension>(intervals, end)
       {}
 
       template<int dimension, class CoordType>
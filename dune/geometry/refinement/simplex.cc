@@ -247,8 +247,12 @@
  */
 
 #include <algorithm>
+#include <cmath>
 
+#include <dune/common/exceptions.hh>
 #include <dune/common/fvector.hh>
+#include <dune/common/iteratorfacades.hh>
+#include <dune/common/power.hh>
 
 #include <dune/geometry/multilineargeometry.hh>
 #include <dune/geometry/referenceelements.hh>
@@ -317,6 +321,53 @@ namespace Dune {
         return index;
       }
 
+      /*! @brief calculate the gridpoint with a given index within a
+                 Kuhn0 simplex
+
+         This is the inverse of pointIndex().  The last two coordinates
+         are computed directly, the others are found by a bisection, so
+         the runtime is of order O(dimension^2 log(maxCoord)).
+
+         @param index    Index of the gridpoint
+         @param maxCoord Upper bound of the first coordinate of the point
+       */
+      template<int dimension>
+      FieldVector<int, dimension> pointFromIndex(int index, int maxCoord)
+      {
+        FieldVector<int, dimension> point;
+        int hi = maxCoord;
+        for(int i = 0; i < dimension; ++i) {
+          // the last coordinate counts the remaining points directly
+          if(i == dimension-1) {
+            point[i] = index;
+            break;
+          }
+          // find the largest coordinate whose preceding points do not
+          // exceed index, for the second last coordinate these are the
+          // triangular numbers lo*(lo+1)/2
+          int lo = 0;
+          if(i == dimension-2) {
+            lo = std::min(int((std::sqrt(8.0*index + 1.0) - 1.0) / 2.0), hi);
+            while(lo > 0 && lo*(lo+1)/2 > index)
+              --lo;
+            while(lo < hi && (lo+1)*(lo+2)/2 <= index)
+              ++lo;
+          }
+          else
+            while(lo < hi) {
+              const int mid = lo + (hi - lo + 1) / 2;
+              if(binomial(dimension-i + mid-1, dimension-i) <= index)
+                lo = mid;
+              else
+                hi = mid - 1;
+            }
+          point[i] = lo;
+          index -= binomial(dimension-i + lo-1, dimension-i);
+          hi = lo;
+        }
+        return point;
+      }
+
       /*! @brief Calculate permutation from it's index
 
          Runtime is of order O(n).
@@ -341,6 +392,77 @@ namespace Dune {
         return perm;
       }
 
+      /*! @brief check whether a Kuhn simplex of width 1 lies within the
+                 Kuhn0 simplex
+
+         @param origin    First corner of the Kuhn simplex
+         @param kuhnIndex Index of the permutation of the Kuhn simplex
+
+         Runtime is of order O(dimension).
+       */
+      template<int dimension>
+      bool kuhnSimplexInside(FieldVector<int, dimension> origin, int kuhnIndex)
+      {
+        FieldVector<int, dimension> perm = getPermutation<dimension>(kuhnIndex);
+        for(int i = 0; i < dimension; ++i) {
+          // next corner
+          ++origin[perm[i]];
+          if(perm[i] > 0)
+            if(origin[perm[i]] > origin[perm[i]-1])
+              return false;
+        }
+        return true;
+      }
+
+      /*! @brief Number of Kuhn subsimplices (of width 1) of a Kuhn0 simplex
+                 whose origin has the given first coordinates
+
+         The subsimplices are ordered lexicographically by their origin.
+         Given the first k coordinates \f$o_0,\ldots,o_{k-1}\f$ of an
+         origin, the subsimplices with these first coordinates and
+         \f$o_k<b\f$ fill the product of the unit cube at
+         \f$(o_0,\ldots,o_{k-1})\f$ (cut by
+         \f$x_0\geq\ldots\geq x_{k-1}\f$) and a Kuhn0 simplex of width b
+         and dimension n-k.  Their number is
+
+         \f[\frac{n!}{(n-k)!\prod_j r_j!}b^{n-k},\f]
+
+         where the \f$r_j\f$ are the lengths of the runs of equal
+         coordinates among \f$o_0,\ldots,o_{k-1}\f$.  This class
+         tracks the coefficient while the coordinates are appended one by
+         one.
+       */
+      template<int dimension>
+      class KuhnSubsimplexCounter
+      {
+      public:
+        KuhnSubsimplexCounter() : k_(0), run_(0), last_(-1), coefficient_(1) {}
+
+        //! number of subsimplices with the current prefix and next coordinate less than b
+        int count(int b) const
+        {
+          int result = coefficient_;
+          for(int i = k_; i < dimension; ++i)
+            result *= b;
+          return result;
+        }
+
+        //! append the next coordinate of the origin
+        void append(int coord)
+        {
+          run_ = (coord == last_ ? run_ + 1 : 1);
+          last_ = coord;
+          coefficient_ = coefficient_ * (dimension - k_) / run_;
+          ++k_;
+        }
+
+      private:
+        int k_;
+        int run_;
+        int last_;
+        int coefficient_;
+      };
+
 #if 0
       Has to be checked
       // calculate the index of a permutation
@@ -430,14 +552,18 @@ namespace Dune {
         typedef FieldVector<CoordType, dimension> CoordVector;
         typedef typename Codim<0>::SubEntityIterator ElementIterator;
         typedef FieldVector<int, dimension+1> IndexVector;
+        typedef RefinementIntervals<dimension> Intervals;
+
+        static int nVertices(const Intervals &intervals);
+        static VertexIterator vBegin(const Intervals &intervals);
+        static VertexIterator vEnd(const Intervals &intervals);
 
-        static int nVertices(int level);
-        static VertexIterator vBegin(int level);
-        static VertexIterator vEnd(int level);
+        static int nElements(const Intervals &intervals);
+        static ElementIterator eBegin(const Intervals &intervals);
+        static ElementIterator eEnd(const Intervals &intervals);
 
-        static int nElements(int level);
-        static ElementIterator eBegin(int level);
-        static ElementIterator eEnd(int level);
+        //! throw NotImplemented unless the intervals are supported
+        static void checkIntervals(const Intervals &intervals);
       };
 
       template<int dimension, class CoordType>
@@ -452,49 +578,64 @@ namespace Dune {
       template<int dimension, class CoordType>
       int
       RefinementImp<dimension, CoordType>::
-      nVertices(int level)
+      nVertices(const Intervals &intervals)
       {
-        return binomial(dimension + (1 << level), dimension);
+        checkIntervals(intervals);
+        return binomial(dimension + intervals.intervals(0), dimension);
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::VertexIterator
       RefinementImp<dimension, CoordType>::
-      vBegin(int level)
+      vBegin(const Intervals &intervals)
       {
-        return VertexIterator(level);
+        return VertexIterator(intervals);
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::VertexIterator
       RefinementImp<dimension, CoordType>::
-      vEnd(int level)
+      vEnd(const Intervals &intervals)
       {
-        return VertexIterator(level, true);
+        return VertexIterator(intervals, true);
       }
 
       template<int dimension, class CoordType>
       int
       RefinementImp<dimension, CoordType>::
-      nElements(int level)
+      nElements(const Intervals &intervals)
       {
-        return 1 << (level * dimension);
+        checkIntervals(intervals);
+        return Power<dimension>::eval(intervals.intervals(0));
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::ElementIterator
       RefinementImp<dimension, CoordType>::
-      eBegin(int level)
+      eBegin(const Intervals &intervals)
       {
-        return ElementIterator(level);
+        return ElementIterator(intervals);
       }
 
       template<int dimension, class CoordType>
       typename RefinementImp<dimension, CoordType>::ElementIterator
       RefinementImp<dimension, CoordType>::
-      eEnd(int level)
+      eEnd(const Intervals &intervals)
       {
-        return ElementIterator(level, true);
+        return ElementIterator(intervals, true);
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementImp<dimension, CoordType>::
+      checkIntervals(const Intervals &intervals)
+      {
+        // a line may be graded, the Kuhn simplices of higher dimensions
+        // need the same uniform intervals in each direction
+        if(dimension > 1 && !intervals.isUniform())
+          DUNE_THROW(NotImplemented, "Refinement of simplices of dimension "
+                     << dimension << " supports the same number of intervals "
+                     "of equal length in each direction only.");
       }
 
       // //////////////
@@ -516,9 +657,12 @@ namespace Dune {
         typedef typename Refinement::template Codim<dimension>::Geometry Geometry;
         typedef RefinementIteratorSpecial<dimension, CoordType, dimension> This;
 
-        RefinementIteratorSpecial(int level, bool end = false);
+        RefinementIteratorSpecial(const typename Refinement::Intervals &intervals, bool end = false);
 
         void increment();
+        void decrement();
+        void advance(int n);
+        int distanceTo(const This &other) const;
         bool equals(const This &other) const;
 
         CoordVector coords() const;
@@ -528,15 +672,17 @@ namespace Dune {
       protected:
         typedef FieldVector<int, dimension> Vertex;
 
+        typename Refinement::Intervals intervals;
         int size;
         Vertex vertex;
       };
 
       template<int dimension, class CoordType>
       RefinementIteratorSpecial<dimension, CoordType, dimension>::
-      RefinementIteratorSpecial(int level, bool end)
-        : size(1<<level)
+      RefinementIteratorSpecial(const typename Refinement::Intervals &intervals_, bool end)
+        : intervals(intervals_), size(intervals_.intervals(0))
       {
+        Refinement::checkIntervals(intervals);
         vertex[0] = (end) ? size + 1 : 0;
         for(int i = 1; i < dimension; ++ i)
           vertex[i] = 0;
@@ -557,12 +703,38 @@ namespace Dune {
         }
       }
 
+      template<int dimension, class CoordType>
+      void
+      RefinementIteratorSpecial<dimension, CoordType, dimension>::
+      decrement()
+      {
+        advance(-1);
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementIteratorSpecial<dimension, CoordType, dimension>::
+      advance(int n)
+      {
+        // the end iterator has the index nVertices and the first
+        // coordinate size+1
+        vertex = pointFromIndex<dimension>(index() + n, size + 1);
+      }
+
+      template<int dimension, class CoordType>
+      int
+      RefinementIteratorSpecial<dimension, CoordType, dimension>::
+      distanceTo(const This &other) const
+      {
+        return other.index() - index();
+      }
+
       template<int dimension, class CoordType>
       bool
       RefinementIteratorSpecial<dimension, CoordType, dimension>::
       equals(const This &other) const
       {
-        return size == other.size && vertex == other.vertex;
+        return vertex == other.vertex && intervals == other.intervals;
       }
 
       template<int dimension, class CoordType>
@@ -575,6 +747,9 @@ namespace Dune {
         CoordVector coords;
         for(int i = 0; i < dimension; ++i)
           coords[i] = CoordType(ref[i]) / size;
+        // only a line may be graded
+        if(dimension == 1)
+          coords[0] = intervals.boundary(0, ref[0]);
         return coords;
       }
 
@@ -583,7 +758,7 @@ namespace Dune {
       RefinementIteratorSpecial<dimension, CoordType, dimension>::geometry () const
       {
         std::vector<CoordVector> corners(1);
-        corners[0] = (CoordVector)vertex;
+        corners[0] = coords();
         return Geometry(GeometryType(0), corners);
       }
 
@@ -607,9 +782,12 @@ namespace Dune {
         typedef typename Refinement::template Codim<0>::Geometry Geometry;
         typedef RefinementIteratorSpecial<dimension, CoordType, 0> This;
 
-        RefinementIteratorSpecial(int level, bool end = false);
+        RefinementIteratorSpecial(const typename Refinement::Intervals &intervals, bool end = false);
 
         void increment();
+        void decrement();
+        void advance(int n);
+        int distanceTo(const This &other) const;
         bool equals(const This &other) const;
 
         IndexVector vertexIndices() const;
@@ -620,11 +798,13 @@ namespace Dune {
 
       private:
         CoordVector global(const CoordVector &local) const;
+        void seek(int index);
 
       protected:
         typedef FieldVector<int, dimension> Vertex;
         enum { nKuhnSimplices = Factorial<dimension>::factorial };
 
+        typename Refinement::Intervals intervals;
         Vertex origin;
         int kuhnIndex;
         int size;
@@ -633,15 +813,17 @@ namespace Dune {
 
       template<int dimension, class CoordType>
       RefinementIteratorSpecial<dimension, CoordType, 0>::
-      RefinementIteratorSpecial(int level, bool end)
-        : kuhnIndex(0), size(1<<level), index_(0)
+      RefinementIteratorSpecial(const typename Refinement::Intervals &intervals_, bool end)
+        : intervals(intervals_), kuhnIndex(0), size(intervals_.intervals(0)), index_(0)
       {
         for(int i = 0; i < dimension; ++i)
           origin[i] = 0;
         if(end) {
-          index_ = Refinement::nElements(level);
+          index_ = Refinement::nElements(intervals);
           origin[0] = size;
         }
+        else
+          Refinement::checkIntervals(intervals);
       }
 
       template<int dimension, class CoordType>
@@ -668,29 +850,82 @@ namespace Dune {
           }
 
           // test whether the current simplex has any corner outside the kuhn0 simplex
-          FieldVector<int, dimension> perm = getPermutation<dimension>(kuhnIndex);
-          Vertex corner = origin;
-          bool outside = false;
-          for(int i = 0; i < dimension; ++i) {
-            // next corner
-            ++corner[perm[i]];
-            if(perm[i] > 0)
-              if(corner[perm[i]] > corner[perm[i]-1]) {
-                outside = true;
-                break;
-              }
-          }
-          if(!outside)
+          if(kuhnSimplexInside(origin, kuhnIndex))
             return;
         }
       }
 
+      template<int dimension, class CoordType>
+      void
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      decrement()
+      {
+        seek(index_ - 1);
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      advance(int n)
+      {
+        seek(index_ + n);
+      }
+
+      template<int dimension, class CoordType>
+      int
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      distanceTo(const This &other) const
+      {
+        return other.index_ - index_;
+      }
+
+      template<int dimension, class CoordType>
+      void
+      RefinementIteratorSpecial<dimension, CoordType, 0>::
+      seek(int index)
+      {
+        const int nElements = Power<dimension>::eval(size);
+        assert(0 <= index && index <= nElements);
+        index_ = index;
+        kuhnIndex = 0;
+        for(int i = 0; i < dimension; ++i)
+          origin[i] = 0;
+        if(index == nElements) {
+          // end iterator
+          origin[0] = size;
+          return;
+        }
+
+        // find the origin, coordinate by coordinate
+        KuhnSubsimplexCounter<dimension> counter;
+        int hi = size - 1;
+        for(int i = 0; i < dimension; ++i) {
+          int lo = 0;
+          while(lo < hi) {
+            const int mid = lo + (hi - lo + 1) / 2;
+            if(counter.count(mid) <= index)
+              lo = mid;
+            else
+              hi = mid - 1;
+          }
+          origin[i] = lo;
+          index -= counter.count(lo);
+          counter.append(lo);
+          hi = lo;
+        }
+
+        // the remaining index counts the Kuhn simplices at this origin
+        for(;; ++kuhnIndex)
+          if(kuhnSimplexInside(origin, kuhnIndex) && index-- == 0)
+            return;
+      }
+
       template<int dimension, class CoordType>
       bool
       RefinementIteratorSpecial<dimension, CoordType, 0>::
       equals(const This &other) const
       {
-        return size == other.size && index_ == other.index_;
+        return index_ == other.index_ && intervals == other.intervals;
       }
 
       template<int dimension, class CoordType>
@@ -751,6 +986,14 @@ namespace Dune {
       global(const CoordVector &local) const {
         CoordVector v =
           referenceToKuhn(local, getPermutation<dimension>(kuhnIndex));
+        // only a line may be graded, map linearly onto its interval
+        if(dimension == 1)
+        {
+          const CoordType lower = intervals.boundary(0, origin[0]);
+          const CoordType upper = intervals.boundary(0, origin[0] + 1);
+          v[0] = lower + v[0] * (upper - lower);
+          return v;
+        }
         v += origin;
         v /= (typename CoordVector::value_type)size;
         return kuhnToReference(v, getPermutation<dimension>(0));
@@ -761,13 +1004,13 @@ namespace Dune {
       template<int dimension, class CoordType>
       template<int codimension>
       class RefinementImp<dimension, CoordType>::Codim<codimension>::SubEntityIterator
-        : public ForwardIteratorFacade<typename RefinementImp<dimension, CoordType>::template Codim<codimension>::SubEntityIterator, int>,
+        : public RandomAccessIteratorFacade<typename RefinementImp<dimension, CoordType>::template Codim<codimension>::SubEntityIterator, int>,
           public RefinementIteratorSpecial<dimension, CoordType, codimension>
       {
       public:
         typedef RefinementImp<dimension, CoordType> Refinement;
 
-        SubEntityIterator(int level, bool end = false);
+        SubEntityIterator(const typename Refinement::Intervals &intervals, bool end = false);
       };
 
 #ifndef DOXYGEN
@@ -775,8 +1018,8 @@ namespace Dune {
       template<int dimension, class CoordType>
       template<int codimension>
       RefinementImp<dimension, CoordType>::Codim<codimension>::SubEntityIterator::
-      SubEntityIterator(int level, bool end)
-        : RefinementIteratorSpecial<dimension, CoordType, codimension>(level, end)
+      SubEntityIterator(const typename Refinement::Intervals &intervals, bool end)
+        : RefinementIteratorSpecial<dimension, CoordType, codimension>(intervals, end)
       {}
 
 #endif
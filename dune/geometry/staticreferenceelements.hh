@@ -0,0 +1,328 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_STATICREFERENCEELEMENTS_HH
+#define DUNE_GEOMETRY_STATICREFERENCEELEMENTS_HH
+
+/** \file
+ *  \brief reference elements whose tables are computed at compile time
+ */
+
+#include <cassert>
+
+#include <dune/common/fvector.hh>
+
+#include <dune/geometry/referenceelements.hh>
+#include <dune/geometry/type.hh>
+
+namespace Dune
+{
+
+  namespace Impl
+  {
+
+    // referenceCornerCoordinate
+    // -------------------------
+
+    /** \brief Compute the k-th coordinate of the i-th corner of a reference element */
+    inline constexpr int referenceCornerCoordinate ( unsigned int topologyId, int dim, unsigned int i, int k )
+    {
+      assert( i < size( topologyId, dim, dim ) );
+
+      if( k >= dim )
+        return 0;
+
+      const unsigned int baseId = baseTopologyId( topologyId, dim );
+      const unsigned int nBaseCorners = size( baseId, dim-1, dim-1 );
+      if( i < nBaseCorners )
+        return (k < dim-1 ? referenceCornerCoordinate( baseId, dim-1, i, k ) : 0);
+      else if( isPrism( topologyId, dim ) )
+        return (k < dim-1 ? referenceCornerCoordinate( baseId, dim-1, i-nBaseCorners, k ) : 1);
+      else
+        return (k < dim-1 ? 0 : 1);
+    }
+
+
+
+    // referenceOriginCoordinate
+    // -------------------------
+
+    /** \brief Compute the k-th coordinate of the origin of the i-th subentity
+     *         of a given codimension (cf. referenceOrigins)
+     */
+    inline constexpr int referenceOriginCoordinate ( unsigned int topologyId, int dim, int codim, unsigned int i, int k )
+    {
+      assert( i < size( topologyId, dim, codim ) );
+
+      if( (codim == 0) || (k >= dim) )
+        return 0;
+
+      const unsigned int baseId = baseTopologyId( topologyId, dim );
+      const unsigned int m = size( baseId, dim-1, codim-1 );
+      if( isPrism( topologyId, dim ) )
+      {
+        const unsigned int n = (codim < dim ? size( baseId, dim-1, codim ) : 0);
+        if( i < n )
+          return referenceOriginCoordinate( baseId, dim-1, codim, i, k );
+        else if( i < n+m )
+          return referenceOriginCoordinate( baseId, dim-1, codim-1, i-n, k );
+        else
+          return (k < dim-1 ? referenceOriginCoordinate( baseId, dim-1, codim-1, i-(n+m), k ) : 1);
+      }
+      else
+      {
+        if( i < m )
+          return referenceOriginCoordinate( baseId, dim-1, codim-1, i, k );
+        else if( codim == dim )
+          return (k < dim-1 ? 0 : 1);
+        else
+          return referenceOriginCoordinate( baseId, dim-1, codim, i-m, k );
+      }
+    }
+
+
+
+    // referenceIntegrationOuterNormalCoordinate
+    // -----------------------------------------
+
+    /** \brief Compute the k-th coordinate of the integration outer normal of a
+     *         face (cf. referenceIntegrationOuterNormals)
+     */
+    inline constexpr int referenceIntegrationOuterNormalCoordinate ( unsigned int topologyId, int dim, unsigned int face, int k )
+    {
+      assert( (dim > 0) && (face < size( topologyId, dim, 1 )) );
+
+      if( k >= dim )
+        return 0;
+
+      if( dim == 1 )
+        return 2*int( face )-1;
+
+      const unsigned int baseId = baseTopologyId( topologyId, dim );
+      if( isPrism( topologyId, dim ) )
+      {
+        const unsigned int numBaseFaces = size( baseId, dim-1, 1 );
+        if( face < numBaseFaces )
+          return (k < dim-1 ? referenceIntegrationOuterNormalCoordinate( baseId, dim-1, face, k ) : 0);
+        else
+          return (k < dim-1 ? 0 : 2*int( face - numBaseFaces )-1);
+      }
+      else
+      {
+        if( face == 0 )
+          return (k < dim-1 ? 0 : -1);
+        else if( k < dim-1 )
+          return referenceIntegrationOuterNormalCoordinate( baseId, dim-1, face-1, k );
+
+        // the lateral faces contain the origin of the corresponding base face
+        int value = 0;
+        for( int l = 0; l < dim-1; ++l )
+          value += referenceIntegrationOuterNormalCoordinate( baseId, dim-1, face-1, l )
+                   * referenceOriginCoordinate( baseId, dim-1, 1, face-1, l );
+        return value;
+      }
+    }
+
+
+
+    // ReferenceElementTable
+    // ---------------------
+
+    /** \brief tables of a reference element, filled in a constant expression */
+    template< class ctype, unsigned int topologyId, int dim >
+    struct ReferenceElementTable
+    {
+      static const unsigned int numEntities = numSubEntities( topologyId, dim );
+      static const unsigned int numNumbers = numSubEntityNumbers( topologyId, dim );
+
+      // avoid zero-sized arrays for points
+      static const int numFaces = (dim > 0 ? size( topologyId, dim, 1 ) : 1);
+      static const int numCoordinates = (dim > 0 ? dim : 1);
+
+      constexpr ReferenceElementTable ()
+        : offset(), subTopologyId(), numberingOffset(), numbering(), position(), integrationOuterNormal(),
+          volume( ctype( 1 ) / ctype( referenceVolumeInverse( topologyId, dim ) ) )
+      {
+        unsigned int e = 0, k = 0;
+        for( int codim = 0; codim <= dim; ++codim )
+        {
+          offset[ codim ] = e;
+          for( unsigned int i = 0; i < size( topologyId, dim, codim ); ++i, ++e )
+          {
+            subTopologyId[ e ] = Impl::subTopologyId( topologyId, dim, codim, i );
+            for( int subcodim = 0; subcodim <= dim+1; ++subcodim )
+            {
+              numberingOffset[ e ][ subcodim ] = k;
+              if( subcodim <= dim-codim )
+              {
+                const unsigned int n = size( subTopologyId[ e ], dim-codim, subcodim );
+                subTopologyNumbering( topologyId, dim, codim, i, subcodim, numbering+k, numbering+k+n );
+                k += n;
+              }
+            }
+
+            // barycenter of the corners (computed as in ReferenceElement)
+            const unsigned int begin = numberingOffset[ e ][ dim-codim ];
+            const unsigned int numCorners = numberingOffset[ e ][ dim-codim+1 ] - begin;
+            for( int l = 0; l < dim; ++l )
+            {
+              for( unsigned int j = 0; j < numCorners; ++j )
+                position[ e ][ l ] += ctype( referenceCornerCoordinate( topologyId, dim, numbering[ begin+j ], l ) );
+              position[ e ][ l ] *= ctype( 1 ) / ctype( numCorners );
+            }
+          }
+        }
+        offset[ dim+1 ] = e;
+
+        for( int face = 0; face < (dim > 0 ? numFaces : 0); ++face )
+        {
+          for( int l = 0; l < dim; ++l )
+            integrationOuterNormal[ face ][ l ] = ctype( referenceIntegrationOuterNormalCoordinate( topologyId, dim, face, l ) );
+        }
+      }
+
+      unsigned int offset[ dim+2 ];
+      unsigned int subTopologyId[ numEntities ];
+      unsigned int numberingOffset[ numEntities ][ dim+2 ];
+      unsigned int numbering[ numNumbers ];
+      ctype position[ numEntities ][ numCoordinates ];
+      ctype integrationOuterNormal[ numFaces ][ numCoordinates ];
+      ctype volume;
+    };
+
+  } // namespace Impl
+
+
+
+  // StaticReferenceElement
+  // ----------------------
+
+  /** \brief reference element of a topology known at compile time
+   *
+   *  This class provides the same topological and geometric information as
+   *  ReferenceElement, but all tables are computed in a constant expression
+   *  and stored as static data.  All methods are static; apart from those
+   *  returning FieldVectors, they are constexpr.  If the arguments are known
+   *  at compile time, the result is a constant, otherwise the call reduces
+   *  to a plain array access.  This allows the compiler to unroll loops over
+   *  subentities, e.g., the faces of an element.
+   *
+   *  The numbering and all values coincide with those of
+   *  <tt>ReferenceElements< ctype, dim >::general( type() )</tt>.
+   *
+   *  \tparam  ctype       coordinate type (must be a literal type)
+   *  \tparam  topologyId  id of the topology
+   *  \tparam  dim         dimension of the reference element
+   */
+  template< class ctype, unsigned int topologyId, int dim >
+  class StaticReferenceElement
+  {
+    typedef Impl::ReferenceElementTable< ctype, topologyId, dim > Table;
+
+    static_assert( (dim >= 0) && (topologyId < Impl::numTopologies( dim )), "Invalid topology id." );
+
+  public:
+    //! dimension of the reference element
+    static const int dimension = dim;
+
+    //! type of coordinates
+    typedef FieldVector< ctype, dim > Coordinate;
+
+    /** \brief number of subentities of codimension c */
+    static constexpr int size ( int c )
+    {
+      assert( (c >= 0) && (c <= dim) );
+      return table_.offset[ c+1 ] - table_.offset[ c ];
+    }
+
+    /** \brief number of subentities of codimension cc of subentity (i,c) */
+    static constexpr int size ( int i, int c, int cc )
+    {
+      assert( (i >= 0) && (i < size( c )) && (cc >= c) && (cc <= dim) );
+      const unsigned int e = table_.offset[ c ] + i;
+      return table_.numberingOffset[ e ][ cc-c+1 ] - table_.numberingOffset[ e ][ cc-c ];
+    }
+
+    /** \brief obtain number of ii-th subentity with codim cc of (i,c) */
+    static constexpr int subEntity ( int i, int c, int ii, int cc )
+    {
+      assert( (ii >= 0) && (ii < size( i, c, cc )) );
+      return table_.numbering[ table_.numberingOffset[ table_.offset[ c ] + i ][ cc-c ] + ii ];
+    }
+
+    /** \brief obtain the type of subentity (i,c) */
+    static constexpr GeometryType type ( int i, int c )
+    {
+      assert( (i >= 0) && (i < size( c )) );
+      return GeometryType( table_.subTopologyId[ table_.offset[ c ] + i ], dim-c );
+    }
+
+    /** \brief obtain the type of this reference element */
+    static constexpr GeometryType type () { return GeometryType( topologyId, dim ); }
+
+    /** \brief k-th coordinate of the barycenter of subentity (i,c) */
+    static constexpr ctype position ( int i, int c, int k )
+    {
+      assert( (i >= 0) && (i < size( c )) && (k >= 0) && (k < dim) );
+      return table_.position[ table_.offset[ c ] + i ][ k ];
+    }
+
+    /** \brief position of the barycenter of subentity (i,c) */
+    static Coordinate position ( int i, int c )
+    {
+      Coordinate x;
+      for( int k = 0; k < dim; ++k )
+        x[ k ] = position( i, c, k );
+      return x;
+    }
+
+    /** \brief obtain the volume of the reference element */
+    static constexpr ctype volume () { return table_.volume; }
+
+    /** \brief k-th coordinate of the integration outer normal of a face */
+    static constexpr ctype integrationOuterNormal ( int face, int k )
+    {
+      assert( (face >= 0) && (face < size( 1 )) && (k >= 0) && (k < dim) );
+      return table_.integrationOuterNormal[ face ][ k ];
+    }
+
+    /** \brief obtain the integration outer normal of a face
+     *
+     *  \note The integration outer normal is the outer normal scaled by the
+     *        volume of the face (cf. ReferenceElement::integrationOuterNormal).
+     */
+    static Coordinate integrationOuterNormal ( int face )
+    {
+      Coordinate n;
+      for( int k = 0; k < dim; ++k )
+        n[ k ] = integrationOuterNormal( face, k );
+      return n;
+    }
+
+  private:
+    static constexpr Table table_ = Table();
+  };
+
+  template< class ctype, unsigned int topologyId, int dim >
+  constexpr typename StaticReferenceElement< ctype, topologyId, dim >::Table StaticReferenceElement< ctype, topologyId, dim >::table_;
+
+
+
+  // StaticSimplexReferenceElement
+  // -----------------------------
+
+  //! static reference element of the simplex of dimension dim
+  template< class ctype, int dim >
+  using StaticSimplexReferenceElement = StaticReferenceElement< ctype, Impl::SimplexTopology< dim >::type::id, dim >;
+
+
+
+  // StaticCubeReferenceElement
+  // --------------------------
+
+  //! static reference element of the cube of dimension dim
+  template< class ctype, int dim >
+  using StaticCubeReferenceElement = StaticReferenceElement< ctype, Impl::CubeTopology< dim >::type::id, dim >;
+
+} // namespace Dune
+
+#endif // #ifndef DUNE_GEOMETRY_STATICREFERENCEELEMENTS_HH
@@ -2,9 +2,12 @@
 // vi: set et ts=4 sw=2 sts=2:
 #include <config.h>
 
+#include <memory>
 #include <vector>
 
 #include <dune/geometry/affinegeometry.hh>
+#include <dune/geometry/multilineargeometry.hh>
+#include <dune/geometry/quadraturerules.hh>
 #include <dune/geometry/referenceelements.hh>
 
 #include <dune/geometry/test/checkgeometry.hh>
@@ -32,6 +35,83 @@ map ( const Dune::FieldMatrix< ctype, mydim, mydim > &A,
 }
 
 
+template< class Geometry >
+static bool testBatchedLocal ( const Geometry &geometry )
+{
+  typedef typename Geometry::ctype ctype;
+  typedef typename Geometry::LocalCoordinate LocalCoordinate;
+  const int mydim = Geometry::mydimension;
+  const ctype epsilon = ctype( 1e5 )*std::numeric_limits< ctype >::epsilon();
+
+  bool pass = true;
+
+  // images of quadrature points and, if possible, of points outside the reference element
+  const Dune::QuadratureRule< ctype, mydim > &quadrature = Dune::QuadratureRules< ctype, mydim >::rule( geometry.type(), 3 );
+  std::vector< LocalCoordinate > points;
+  for( const auto &qp : quadrature )
+    points.push_back( qp.position() );
+  if( mydim > 0 )
+  {
+    points.push_back( LocalCoordinate( ctype( -0.5 ) ) );
+    points.push_back( LocalCoordinate( ctype( 1.5 ) ) );
+  }
+  std::vector< typename Geometry::GlobalCoordinate > globals;
+  for( const LocalCoordinate &x : points )
+    globals.push_back( geometry.global( x ) );
+
+  std::vector< LocalCoordinate > locals( points.size() );
+  std::unique_ptr< bool[] > inside( new bool[ points.size() ] );
+  geometry.local( globals, locals.data(), inside.get() );
+
+  for( std::size_t i = 0; i < points.size(); ++i )
+  {
+    if( (locals[ i ] - points[ i ]).two_norm() > epsilon )
+    {
+      std::cerr << "Error: batched local returned " << locals[ i ] << ", expected " << points[ i ] << "." << std::endl;
+      pass = false;
+    }
+    if( inside[ i ] != (i < quadrature.size()) )
+    {
+      std::cerr << "Error: batched local returned wrong inside flag for " << points[ i ] << "." << std::endl;
+      pass = false;
+    }
+  }
+
+  // points close to the boundary x_0 = 0 must be classified like MultiLinearGeometry does
+  if( mydim > 0 )
+  {
+    const auto &refElement = Dune::ReferenceElements< ctype, mydim >::general( geometry.type() );
+    std::vector< typename Geometry::GlobalCoordinate > corners;
+    for( int i = 0; i < refElement.size( mydim ); ++i )
+      corners.push_back( geometry.corner( i ) );
+    const Dune::MultiLinearGeometry< ctype, mydim, Geometry::coorddimension > mlGeometry( refElement, corners );
+
+    std::vector< typename Geometry::GlobalCoordinate > boundaryGlobals;
+    for( ctype offset : { ctype( -1e-3 ), ctype( -1000 )*std::numeric_limits< ctype >::epsilon(), ctype( 0 ), ctype( 1e-3 ) } )
+    {
+      LocalCoordinate x = refElement.position( 0, 0 );
+      x[ 0 ] = offset;
+      boundaryGlobals.push_back( geometry.global( x ) );
+    }
+    std::vector< LocalCoordinate > affineLocals( boundaryGlobals.size() ), mlLocals( boundaryGlobals.size() );
+    std::unique_ptr< bool[] > affineInside( new bool[ boundaryGlobals.size() ] );
+    std::unique_ptr< bool[] > mlInside( new bool[ boundaryGlobals.size() ] );
+    geometry.local( boundaryGlobals, affineLocals.data(), affineInside.get() );
+    mlGeometry.local( boundaryGlobals, mlLocals.data(), mlInside.get() );
+    for( std::size_t i = 0; i < boundaryGlobals.size(); ++i )
+    {
+      if( affineInside[ i ] != mlInside[ i ] )
+      {
+        std::cerr << "Error: batched local of AffineGeometry and MultiLinearGeometry disagree on "
+                  << affineLocals[ i ] << " being inside." << std::endl;
+        pass = false;
+      }
+    }
+  }
+  return pass;
+}
+
+
 template< class ctype, int mydim, int cdim >
 static bool testAffineGeometry ( const Dune::ReferenceElement< ctype, mydim > &refElement,
                                  const Dune::FieldMatrix< ctype, mydim, mydim > &A,
@@ -100,6 +180,7 @@ static bool testAffineGeometry ( const Dune::ReferenceElement< ctype, mydim > &r
   }
 
   pass &= checkGeometry( geometry );
+  pass &= testBatchedLocal( geometry );
 
   return pass;
 }
@@ -2,13 +2,23 @@
 // vi: set et ts=4 sw=2 sts=2:
 #include <config.h>
 
+#include <algorithm>
+#include <array>
+#include <cfenv>
+#include <cmath>
 #include <functional>
+#include <memory>
+#include <ostream>
 #include <vector>
 
 #include <dune/common/fvector.hh>
+#include <dune/common/simd.hh>
 
 #include <dune/geometry/multilineargeometry.hh>
+#include <dune/geometry/multilineargeometrystore.hh>
+#include <dune/geometry/quadraturerules.hh>
 #include <dune/geometry/referenceelements.hh>
+#include <dune/geometry/utility/executor.hh>
 
 #include <dune/geometry/test/checkgeometry.hh>
 
@@ -25,6 +35,86 @@ struct ReferenceWrapperGeometryTraits :
   };
 };
 
+// A minimal SIMD type as supported by dune/common/simd.hh: the operations
+// act on each lane, comparisons yield a SimdMask, and cond(), any_true() and
+// all_true() are found by argument-dependent lookup.
+template< int N >
+struct SimdMask
+{
+  SimdMask () = default;
+  SimdMask ( bool b ) { lanes.fill( b ); }
+
+  friend SimdMask operator! ( const SimdMask &a ) { SimdMask r; for( int l = 0; l < N; ++l ) r.lanes[ l ] = !a.lanes[ l ]; return r; }
+  friend SimdMask operator&& ( const SimdMask &a, const SimdMask &b ) { SimdMask r; for( int l = 0; l < N; ++l ) r.lanes[ l ] = a.lanes[ l ] && b.lanes[ l ]; return r; }
+  friend SimdMask operator|| ( const SimdMask &a, const SimdMask &b ) { SimdMask r; for( int l = 0; l < N; ++l ) r.lanes[ l ] = a.lanes[ l ] || b.lanes[ l ]; return r; }
+
+  friend bool any_true ( const SimdMask &a ) { return std::any_of( a.lanes.begin(), a.lanes.end(), [] ( bool b ) { return b; } ); }
+  friend bool all_true ( const SimdMask &a ) { return std::all_of( a.lanes.begin(), a.lanes.end(), [] ( bool b ) { return b; } ); }
+
+  std::array< bool, N > lanes;
+};
+
+template< class T, int N >
+struct SimdLanes
+{
+  typedef SimdMask< N > Mask;
+
+  SimdLanes () = default;
+  SimdLanes ( T t ) { lanes.fill( t ); }
+
+  T &operator[] ( int l ) { return lanes[ l ]; }
+  const T &operator[] ( int l ) const { return lanes[ l ]; }
+
+  template< class Op >
+  friend SimdLanes apply ( const SimdLanes &a, const SimdLanes &b, Op op ) { SimdLanes r; for( int l = 0; l < N; ++l ) r[ l ] = op( a[ l ], b[ l ] ); return r; }
+  template< class Op >
+  friend Mask compare ( const SimdLanes &a, const SimdLanes &b, Op op ) { Mask r; for( int l = 0; l < N; ++l ) r.lanes[ l ] = op( a[ l ], b[ l ] ); return r; }
+
+  friend SimdLanes operator+ ( const SimdLanes &a, const SimdLanes &b ) { return apply( a, b, std::plus< T >() ); }
+  friend SimdLanes operator- ( const SimdLanes &a, const SimdLanes &b ) { return apply( a, b, std::minus< T >() ); }
+  friend SimdLanes operator* ( const SimdLanes &a, const SimdLanes &b ) { return apply( a, b, std::multiplies< T >() ); }
+  friend SimdLanes operator/ ( const SimdLanes &a, const SimdLanes &b ) { return apply( a, b, std::divides< T >() ); }
+  friend SimdLanes operator- ( const SimdLanes &a ) { return SimdLanes( T( 0 ) ) - a; }
+
+  SimdLanes &operator+= ( const SimdLanes &b ) { return *this = *this + b; }
+  SimdLanes &operator-= ( const SimdLanes &b ) { return *this = *this - b; }
+  SimdLanes &operator*= ( const SimdLanes &b ) { return *this = *this * b; }
+  SimdLanes &operator/= ( const SimdLanes &b ) { return *this = *this / b; }
+
+  friend Mask operator< ( const SimdLanes &a, const SimdLanes &b ) { return compare( a, b, std::less< T >() ); }
+  friend Mask operator> ( const SimdLanes &a, const SimdLanes &b ) { return compare( a, b, std::greater< T >() ); }
+  friend Mask operator<= ( const SimdLanes &a, const SimdLanes &b ) { return compare( a, b, std::less_equal< T >() ); }
+  friend Mask operator>= ( const SimdLanes &a, const SimdLanes &b ) { return compare( a, b, std::greater_equal< T >() ); }
+  friend Mask operator== ( const SimdLanes &a, const SimdLanes &b ) { return compare( a, b, std::equal_to< T >() ); }
+  friend Mask operator!= ( const SimdLanes &a, const SimdLanes &b ) { return compare( a, b, std::not_equal_to< T >() ); }
+
+  friend SimdLanes cond ( const Mask &mask, const SimdLanes &a, const SimdLanes &b ) { SimdLanes r; for( int l = 0; l < N; ++l ) r[ l ] = (mask.lanes[ l ] ? a[ l ] : b[ l ]); return r; }
+  friend SimdLanes abs ( const SimdLanes &a ) { SimdLanes r; for( int l = 0; l < N; ++l ) r[ l ] = std::abs( a[ l ] ); return r; }
+  friend SimdLanes sqrt ( const SimdLanes &a ) { SimdLanes r; for( int l = 0; l < N; ++l ) r[ l ] = std::sqrt( a[ l ] ); return r; }
+
+  friend std::ostream &operator<< ( std::ostream &out, const SimdLanes &a )
+  {
+    out << "<";
+    for( int l = 0; l < N; ++l )
+      out << (l > 0 ? ", " : "") << a[ l ];
+    return out << ">";
+  }
+
+  std::array< T, N > lanes;
+};
+
+namespace Dune
+{
+
+  template< class T, int N >
+  struct SimdScalarTypeTraits< SimdLanes< T, N > >
+  {
+    typedef T type;
+  };
+
+} // namespace Dune
+
+
 template< class ctype, int mydim, int cdim >
 static Dune::FieldVector< ctype, cdim >
 map ( const Dune::FieldMatrix< ctype, mydim, mydim > &A,
@@ -47,6 +137,260 @@ map ( const Dune::FieldMatrix< ctype, mydim, mydim > &A,
 }
 
 
+template< class Geometry >
+static bool testBatchedEvaluation ( const Geometry &geometry )
+{
+  typedef typename Geometry::ctype ctype;
+  const int mydim = Geometry::mydimension;
+  const ctype epsilon = ctype( 1e5 )*std::numeric_limits< ctype >::epsilon();
+
+  bool pass = true;
+
+  const Dune::QuadratureRule< ctype, mydim > &quadrature = Dune::QuadratureRules< ctype, mydim >::rule( geometry.type(), 3 );
+  std::vector< typename Geometry::GlobalCoordinate > globals( quadrature.size() );
+  std::vector< typename Geometry::JacobianTransposed > jacobianTransposeds( quadrature.size() );
+  std::vector< typename Geometry::JacobianInverseTransposed > jacobianInverseTransposeds( quadrature.size() );
+  std::vector< ctype > integrationElements( quadrature.size() );
+  geometry.evaluate( quadrature, globals.data(), jacobianTransposeds.data(), jacobianInverseTransposeds.data(), integrationElements.data() );
+
+  std::vector< ctype > integrationElementsOnly( quadrature.size() );
+  geometry.evaluate( quadrature, nullptr, nullptr, nullptr, integrationElementsOnly.data() );
+
+  for( std::size_t i = 0; i < quadrature.size(); ++i )
+  {
+    // compare relative to the magnitude of the pointwise results
+    const typename Geometry::LocalCoordinate &x = quadrature[ i ].position();
+    const typename Geometry::GlobalCoordinate y = geometry.global( x );
+    ctype error = (globals[ i ] - y).two_norm() / std::max( ctype( 1 ), y.two_norm() );
+    const typename Geometry::JacobianTransposed jt = geometry.jacobianTransposed( x );
+    const typename Geometry::JacobianInverseTransposed jit = geometry.jacobianInverseTransposed( x );
+    for( int j = 0; j < mydim; ++j )
+      error += (jacobianTransposeds[ i ][ j ] - jt[ j ]).two_norm() / std::max( ctype( 1 ), jt[ j ].two_norm() );
+    for( int j = 0; j < Geometry::coorddimension; ++j )
+      error += (jacobianInverseTransposeds[ i ][ j ] - jit[ j ]).two_norm() / std::max( ctype( 1 ), jit[ j ].two_norm() );
+    const ctype integrationElement = geometry.integrationElement( x );
+    error += std::abs( integrationElements[ i ] - integrationElement ) / std::max( ctype( 1 ), integrationElement );
+    error += std::abs( integrationElementsOnly[ i ] - integrationElement ) / std::max( ctype( 1 ), integrationElement );
+    if( error > epsilon )
+    {
+      std::cerr << "Error: batched evaluation differs from pointwise evaluation in "
+                << x << " (error = " << error << ")." << std::endl;
+      pass = false;
+    }
+  }
+  return pass;
+}
+
+
+template< class Geometry >
+static bool testBatchedLocal ( const Geometry &geometry )
+{
+  typedef typename Geometry::ctype ctype;
+  typedef typename Geometry::LocalCoordinate LocalCoordinate;
+  const int mydim = Geometry::mydimension;
+
+  bool pass = true;
+
+  // images of quadrature points and, if possible, of points outside the reference element
+  const Dune::QuadratureRule< ctype, mydim > &quadrature = Dune::QuadratureRules< ctype, mydim >::rule( geometry.type(), 3 );
+  std::vector< LocalCoordinate > points;
+  for( const auto &qp : quadrature )
+    points.push_back( qp.position() );
+  if( mydim > 0 )
+  {
+    points.push_back( LocalCoordinate( ctype( -0.5 ) ) );
+    points.push_back( LocalCoordinate( ctype( 1.5 ) ) );
+  }
+  std::vector< typename Geometry::GlobalCoordinate > globals;
+  for( const LocalCoordinate &x : points )
+    globals.push_back( geometry.global( x ) );
+
+  std::vector< LocalCoordinate > locals( points.size() );
+  std::unique_ptr< bool[] > inside( new bool[ points.size() ] );
+  geometry.local( globals, locals.data(), inside.get() );
+
+  for( std::size_t i = 0; i < points.size(); ++i )
+  {
+    if( (locals[ i ] - points[ i ]).two_norm() > 1e-8 )
+    {
+      std::cerr << "Error: batched local returned " << locals[ i ] << ", expected " << points[ i ] << "." << std::endl;
+      pass = false;
+    }
+    if( inside[ i ] != (i < quadrature.size()) )
+    {
+      std::cerr << "Error: batched local returned wrong inside flag for " << points[ i ] << "." << std::endl;
+      pass = false;
+    }
+  }
+  return pass;
+}
+
+
+template< class ctype, int mydim, int cdim >
+static bool testGeometryStore ( const Dune::GeometryType &type )
+{
+  typedef Dune::MultiLinearGeometryStore< ctype, mydim, cdim > Store;
+  typedef Dune::MultiLinearGeometry< ctype, mydim, cdim > Geometry;
+  const ctype epsilon = ctype( 1e5 )*std::numeric_limits< ctype >::epsilon();
+  const std::size_t numElements = 5;
+
+  bool pass = true;
+
+  const Dune::ReferenceElement< ctype, mydim > &refElement = Dune::ReferenceElements< ctype, mydim >::general( type );
+  const int numCorners = refElement.size( mydim );
+
+  // fill the store with shifted and distorted copies of the reference element
+  Store store( type );
+  store.reserve( numElements );
+  std::vector< std::vector< Dune::FieldVector< ctype, cdim > > > corners( numElements );
+  for( std::size_t e = 0; e < numElements; ++e )
+  {
+    corners[ e ].resize( numCorners );
+    for( int i = 0; i < numCorners; ++i )
+      for( int k = 0; k < cdim; ++k )
+        corners[ e ][ i ][ k ] = (k < mydim ? refElement.position( i, mydim )[ k ] : ctype( 0 ))
+                                 + ctype( e ) + ctype( 0.1 )*std::sin( ctype( 5*e + 3*i + k ) );
+    if( store.push_back( corners[ e ] ) != e )
+    {
+      std::cerr << "Error: MultiLinearGeometryStore returned wrong index." << std::endl;
+      pass = false;
+    }
+  }
+
+  if( (store.size() != numElements) || (store.corners() != numCorners) || (store.type() != type) )
+  {
+    std::cerr << "Error: MultiLinearGeometryStore has wrong size." << std::endl;
+    return false;
+  }
+
+  const Dune::QuadratureRule< ctype, mydim > &quadrature = Dune::QuadratureRules< ctype, mydim >::rule( type, 2 );
+  const std::size_t first = 1, last = numElements-1;
+  std::vector< typename Store::GlobalCoordinate > globals( (last - first)*quadrature.size() );
+  std::vector< ctype > integrationElements( globals.size() );
+  store.evaluate( first, last, quadrature, globals.data(), nullptr, nullptr, integrationElements.data() );
+
+  // parallel kernels
+  const Dune::ThreadExecutor executor( 3 );
+  std::vector< ctype > volumes( numElements );
+  store.volumes( 0, numElements, volumes.data(), executor );
+  std::vector< typename Store::GlobalCoordinate > centers( numElements );
+  store.centers( 0, numElements, centers.data(), executor );
+  std::vector< typename Store::GlobalCoordinate > parallelGlobals( numElements*quadrature.size() );
+  store.evaluate( 0, numElements, quadrature, parallelGlobals.data(), nullptr, nullptr, nullptr, executor );
+  std::vector< typename Store::LocalCoordinate > locals( parallelGlobals.size() );
+  store.local( 0, numElements, parallelGlobals.data(), quadrature.size(), locals.data(), executor );
+
+  for( std::size_t e = 0; e < numElements; ++e )
+  {
+    const Geometry reference( type, corners[ e ] );
+    const typename Store::Geometry geometry = store.geometry( e );
+    pass &= checkGeometry( geometry );
+
+    if( (std::abs( volumes[ e ] - reference.volume() ) > epsilon) || ((centers[ e ] - reference.center()).two_norm() > epsilon) )
+    {
+      std::cerr << "Error: parallel volume or center differs from MultiLinearGeometry." << std::endl;
+      pass = false;
+    }
+
+    for( int i = 0; i < numCorners; ++i )
+    {
+      if( (store.corner( e, i ) - corners[ e ][ i ]).two_norm() > epsilon )
+      {
+        std::cerr << "Error: MultiLinearGeometryStore returned wrong corner." << std::endl;
+        pass = false;
+      }
+    }
+
+    for( std::size_t q = 0; q < quadrature.size(); ++q )
+    {
+      const Dune::FieldVector< ctype, mydim > &x = quadrature[ q ].position();
+      const typename Geometry::GlobalCoordinate y = reference.global( x );
+      ctype error = (geometry.global( x ) - y).two_norm();
+      error += (parallelGlobals[ e*quadrature.size() + q ] - y).two_norm() / std::max( ctype( 1 ), y.two_norm() );
+      error += (locals[ e*quadrature.size() + q ] - x).two_norm();
+      if( (e >= first) && (e < last) )
+      {
+        const std::size_t k = (e - first)*quadrature.size() + q;
+        error += (globals[ k ] - y).two_norm() / std::max( ctype( 1 ), y.two_norm() );
+        error += std::abs( integrationElements[ k ] - reference.integrationElement( x ) );
+      }
+      if( error > epsilon )
+      {
+        std::cerr << "Error: MultiLinearGeometryStore differs from MultiLinearGeometry in "
+                  << x << " (error = " << error << ")." << std::endl;
+        pass = false;
+      }
+    }
+  }
+
+  return pass;
+}
+
+template< class ctype >
+static bool testGeometryStore ()
+{
+  bool pass = true;
+
+  std::cout << "Checking MultiLinearGeometryStore" << std::endl;
+  pass &= testGeometryStore< ctype, 1, 2 >( Dune::GeometryType( Dune::Impl::CubeTopology< 1 >::type::id, 1 ) );
+  pass &= testGeometryStore< ctype, 2, 2 >( Dune::GeometryType( Dune::Impl::SimplexTopology< 2 >::type::id, 2 ) );
+  pass &= testGeometryStore< ctype, 2, 3 >( Dune::GeometryType( Dune::Impl::CubeTopology< 2 >::type::id, 2 ) );
+  pass &= testGeometryStore< ctype, 3, 3 >( Dune::GeometryType( Dune::Impl::PrismTopology< 3 >::type::id, 3 ) );
+  pass &= testGeometryStore< ctype, 3, 3 >( Dune::GeometryType( Dune::Impl::PyramidTopology< 3 >::type::id, 3 ) );
+  pass &= testGeometryStore< ctype, 3, 3 >( Dune::GeometryType( Dune::Impl::CubeTopology< 3 >::type::id, 3 ) );
+
+  return pass;
+}
+
+
+template< class Geometry >
+static bool testDegenerateLocal ( const Geometry &geometry )
+{
+  typedef typename Geometry::ctype ctype;
+  typedef typename Geometry::LocalCoordinate LocalCoordinate;
+  typedef typename Geometry::GlobalCoordinate GlobalCoordinate;
+  const int mydim = Geometry::mydimension;
+
+  bool pass = true;
+
+  // the center and a point off the degenerate image
+  std::vector< GlobalCoordinate > globals = { geometry.center(), geometry.center() };
+  globals[ 1 ][ Geometry::coorddimension-1 ] += ctype( 1 );
+
+  // all variants of local() return the center of the reference element
+  const LocalCoordinate &center = referenceElement( geometry ).position( 0, 0 );
+  for( const GlobalCoordinate &global : globals )
+  {
+    LocalCoordinate local( ctype( 7 ) );
+    if( geometry.local( global, local ) != Geometry::LocalStatus::singular )
+    {
+      std::cerr << "Error: local did not report a singular Jacobian for " << global << "." << std::endl;
+      pass = false;
+    }
+    if( (local != center) || (geometry.local( global ) != center) )
+    {
+      std::cerr << "Error: local did not return the center for " << global << "." << std::endl;
+      pass = false;
+    }
+  }
+
+  std::vector< LocalCoordinate > locals( globals.size(), LocalCoordinate( ctype( 7 ) ) );
+  std::unique_ptr< bool[] > inside( new bool[ globals.size() ] );
+  geometry.local( globals, locals.data(), inside.get() );
+  if( std::any_of( inside.get(), inside.get() + globals.size(), [] ( bool b ) { return b; } ) )
+  {
+    std::cerr << "Error: batched local reported a point inside a degenerate geometry (mydim = " << mydim << ")." << std::endl;
+    pass = false;
+  }
+  if( std::any_of( locals.begin(), locals.end(), [ &center ] ( const LocalCoordinate &x ) { return x != center; } ) )
+  {
+    std::cerr << "Error: batched local did not return the center for a degenerate geometry (mydim = " << mydim << ")." << std::endl;
+    pass = false;
+  }
+  return pass;
+}
+
+
 template< class ctype, int mydim, int cdim, class Traits >
 static bool testMultiLinearGeometry ( const Dune::ReferenceElement< ctype, mydim > &refElement,
                                       const Dune::FieldMatrix< ctype, mydim, mydim > &A,
@@ -160,6 +504,11 @@ static bool testMultiLinearGeometry ( const Dune::ReferenceElement< ctype, mydim
 
   pass &= checkGeometry( geometry );
 
+  pass &= testBatchedEvaluation( geometry );
+  pass &= testBatchedEvaluation( Dune::CachedMultiLinearGeometry< ctype, mydim, cdim, Traits >( refElement, corners ) );
+  pass &= testBatchedLocal( geometry );
+  pass &= testBatchedLocal( Dune::CachedMultiLinearGeometry< ctype, mydim, cdim, Traits >( refElement, corners ) );
+
   return pass;
 }
 
@@ -286,6 +635,216 @@ static bool testNonLinearGeometry(const Traits &traits)
     }
   }
 
+  /* Test local() with status */
+  {
+    typedef typename Geometry::LocalStatus LocalStatus;
+    typename Geometry::LocalParameters parameters;
+    Vector local;
+
+    const Vector global = {0.5, 0.5};
+    if (geometry.local(global, local) != LocalStatus::converged
+        || (geometry.global(local) - global).two_norm() > epsilon) {
+      std::cerr << "local with status failed for " << global << std::endl;
+      pass = false;
+    }
+
+    parameters.fixedJacobian = true;
+    parameters.maxIterations = 1000;
+    if (geometry.local(global, local, parameters) != LocalStatus::converged
+        || (geometry.global(local) - global).two_norm() > epsilon) {
+      std::cerr << "local with fixed Jacobian failed for " << global << std::endl;
+      pass = false;
+    }
+
+    parameters = typename Geometry::LocalParameters();
+    parameters.maxIterations = 1;
+    if (geometry.local(global, local, parameters) != LocalStatus::notConverged) {
+      std::cerr << "local did not report missing convergence" << std::endl;
+      pass = false;
+    }
+
+    parameters = typename Geometry::LocalParameters();
+    parameters.earlyOut = true;
+    if (geometry.local(Vector{-2, 0}, local, parameters) != LocalStatus::outside) {
+      std::cerr << "local did not report an outside point" << std::endl;
+      pass = false;
+    }
+    if (geometry.local(global, local, parameters) != LocalStatus::converged) {
+      std::cerr << "local reported an inside point as outside" << std::endl;
+      pass = false;
+    }
+
+    // degenerate affine geometry
+    Dune::GeometryType triangle;
+    triangle.makeTriangle();
+    const std::vector<Vector> degenerate = {{0,0}, {1,1}, {2,2}};
+    const Geometry singular(triangle, degenerate);
+    if (singular.local(global, local) != LocalStatus::singular) {
+      std::cerr << "local did not report a singular Jacobian" << std::endl;
+      pass = false;
+    }
+    const Dune::CachedMultiLinearGeometry<ctype,dim,dim,Traits> cachedSingular(triangle, degenerate);
+    if (cachedSingular.local(global, local) != LocalStatus::singular) {
+      std::cerr << "cached local did not report a singular Jacobian" << std::endl;
+      pass = false;
+    }
+  }
+
+  /* Test batched evaluation */
+  pass &= testBatchedEvaluation(geometry);
+  pass &= testBatchedEvaluation(Dune::CachedMultiLinearGeometry<ctype,dim,dim,Traits>(reference, corners));
+
+  /* Test batched local() */
+  pass &= testBatchedLocal(geometry);
+  pass &= testBatchedLocal(Dune::CachedMultiLinearGeometry<ctype,dim,dim,Traits>(reference, corners));
+
+  std::cout << (pass ? "passed" : "failed") << std::endl;
+  return pass;
+}
+
+template< class ctype, class Traits >
+static bool testDegenerateGeometry ( const Traits &traits )
+{
+  const int dim = 3;
+  typedef Dune::FieldVector< ctype, dim > Vector;
+  typedef Dune::MultiLinearGeometry< ctype, dim, dim, Traits > Geometry;
+  typedef Dune::CachedMultiLinearGeometry< ctype, dim, dim, Traits > CachedGeometry;
+
+  bool pass = true;
+  std::cout << "Checking degenerate geometries: ";
+
+  // the inverse mapping has to report the singular Jacobian instead of
+  // failing in the Cholesky factorization
+  const Dune::GeometryType simplex( Dune::Impl::SimplexTopology< dim >::type::id, dim );
+  const std::vector< Vector > flatSimplex = { {0,0,0}, {1,0,0}, {0,1,0}, {1,1,0} };
+  pass &= testDegenerateLocal( Geometry( simplex, flatSimplex ) );
+  pass &= testDegenerateLocal( CachedGeometry( simplex, flatSimplex ) );
+
+  // the last corner lies in the plane of the others up to rounding
+  const std::vector< Vector > planarSimplex = { {0,0,0}, {1,2,3}, {2,1,0}, {1.7,1.3,0.9} };
+  pass &= testDegenerateLocal( Geometry( simplex, planarSimplex ) );
+  pass &= testDegenerateLocal( CachedGeometry( simplex, planarSimplex ) );
+
+  // a flat, non-affine hexahedron
+  const Dune::GeometryType cube( Dune::Impl::CubeTopology< dim >::type::id, dim );
+  const std::vector< Vector > flatCube = { {0,0,0}, {1,0,0}, {0,1,0}, {2,2,0},
+                                           {0,0,0}, {1,0,0}, {0,1,0}, {2,2,0} };
+  pass &= testDegenerateLocal( Geometry( cube, flatCube ) );
+  pass &= testDegenerateLocal( CachedGeometry( cube, flatCube ) );
+
+  // a flat, affine hexahedron
+  const std::vector< Vector > flatParallelepiped = { {0,0,0}, {1,0,0}, {0,1,0}, {1,1,0},
+                                                     {1,1,0}, {2,1,0}, {1,2,0}, {2,2,0} };
+  pass &= testDegenerateLocal( Geometry( cube, flatParallelepiped ) );
+  pass &= testDegenerateLocal( CachedGeometry( cube, flatParallelepiped ) );
+
+  std::cout << (pass ? "passed" : "failed") << std::endl;
+  return pass;
+}
+
+// compare a geometry with SIMD coordinates lane by lane to scalar geometries
+template< int mydim, int cdim >
+static bool testSimdGeometry ( Dune::GeometryType gt )
+{
+  const int lanes = 2;
+  typedef SimdLanes< double, lanes > Simd;
+  typedef Dune::MultiLinearGeometry< double, mydim, cdim > ScalarGeometry;
+  typedef Dune::MultiLinearGeometry< Simd, mydim, cdim > SimdGeometry;
+  typedef Dune::FieldVector< double, mydim > LocalCoordinate;
+  typedef Dune::FieldVector< double, cdim > GlobalCoordinate;
+  const double epsilon = 1e-10;
+
+  bool pass = true;
+  std::cout << "Checking SIMD geometry (topologyId = " << gt.id() << ", mydim = " << mydim << ", cdim = " << cdim << "): ";
+
+  // lane 0 holds a scaled reference element, lane 1 a non-affine perturbation
+  const Dune::ReferenceElement< double, mydim > &refElement = Dune::ReferenceElements< double, mydim >::general( gt );
+  const int numCorners = refElement.size( mydim );
+  std::vector< std::vector< GlobalCoordinate > > corners( lanes, std::vector< GlobalCoordinate >( numCorners, GlobalCoordinate( 0 ) ) );
+  std::vector< Dune::FieldVector< Simd, cdim > > simdCorners( numCorners );
+  for( int c = 0; c < numCorners; ++c )
+  {
+    for( int i = 0; i < mydim; ++i )
+    {
+      corners[ 0 ][ c ][ i ] = 2.0 * refElement.position( c, mydim )[ i ];
+      corners[ 1 ][ c ][ i ] = refElement.position( c, mydim )[ i ];
+    }
+    corners[ 1 ][ c ][ c % cdim ] += 0.02 * (c + 1);
+    for( int i = 0; i < cdim; ++i )
+      for( int l = 0; l < lanes; ++l )
+        simdCorners[ c ][ i ][ l ] = corners[ l ][ c ][ i ];
+  }
+  std::vector< ScalarGeometry > geometries;
+  for( int l = 0; l < lanes; ++l )
+    geometries.emplace_back( gt, corners[ l ] );
+  const SimdGeometry simdGeometry( gt, simdCorners );
+
+  if( simdGeometry.affine() != (geometries[ 0 ].affine() && geometries[ 1 ].affine()) )
+  {
+    std::cerr << "Error: affine() of the SIMD geometry does not agree with its lanes." << std::endl;
+    pass = false;
+  }
+
+  // the corners in lane 0 (including the tip of a pyramid, where 1-x_n
+  // vanishes) and quadrature points in both lanes
+  const Dune::QuadratureRule< double, mydim > &quadrature = Dune::QuadratureRules< double, mydim >::rule( gt, 2 );
+  std::vector< std::array< LocalCoordinate, lanes > > points;
+  for( int c = 0; c < numCorners; ++c )
+    points.push_back( {{ refElement.position( c, mydim ), refElement.position( 0, 0 ) }} );
+  const std::size_t numQuadraturePoints = quadrature.size();
+  for( std::size_t i = 0; i < numQuadraturePoints; ++i )
+    points.push_back( {{ quadrature[ i ].position(), quadrature[ numQuadraturePoints-1-i ].position() }} );
+
+  for( std::size_t k = 0; k < points.size(); ++k )
+  {
+    typename SimdGeometry::LocalCoordinate x;
+    for( int i = 0; i < mydim; ++i )
+      for( int l = 0; l < lanes; ++l )
+        x[ i ][ l ] = points[ k ][ l ][ i ];
+
+    // the masked lanes must not divide by zero
+    std::feclearexcept( FE_DIVBYZERO );
+    const typename SimdGeometry::GlobalCoordinate y = simdGeometry.global( x );
+    const typename SimdGeometry::JacobianTransposed jt = simdGeometry.jacobianTransposed( x );
+    if( std::fetestexcept( FE_DIVBYZERO ) )
+    {
+      std::cerr << "Error: SIMD geometry divided by zero in " << x << "." << std::endl;
+      pass = false;
+    }
+
+    const bool interior = (k >= std::size_t( numCorners ));
+    typename SimdGeometry::LocalCoordinate local;
+    const bool converged = interior && (simdGeometry.local( y, local ) == SimdGeometry::LocalStatus::converged);
+    const Simd integrationElement = (interior ? simdGeometry.integrationElement( x ) : Simd( 0 ));
+
+    for( int l = 0; l < lanes; ++l )
+    {
+      const ScalarGeometry &geometry = geometries[ l ];
+      const LocalCoordinate &xl = points[ k ][ l ];
+      double error = 0;
+      const GlobalCoordinate yl = geometry.global( xl );
+      const typename ScalarGeometry::JacobianTransposed jtl = geometry.jacobianTransposed( xl );
+      for( int i = 0; i < cdim; ++i )
+      {
+        error += std::abs( y[ i ][ l ] - yl[ i ] );
+        for( int j = 0; j < mydim; ++j )
+          error += std::abs( jt[ j ][ i ][ l ] - jtl[ j ][ i ] );
+      }
+      if( interior )
+      {
+        error += std::abs( integrationElement[ l ] - geometry.integrationElement( xl ) );
+        for( int i = 0; i < mydim; ++i )
+          error += std::abs( local[ i ][ l ] - xl[ i ] );
+      }
+      if( !(error <= epsilon) || (interior && !converged) )
+      {
+        std::cerr << "Error: lane " << l << " of the SIMD geometry differs from the scalar geometry in "
+                  << xl << " (error = " << error << ")." << std::endl;
+        pass = false;
+      }
+    }
+  }
+
   std::cout << (pass ? "passed" : "failed") << std::endl;
   return pass;
 }
@@ -359,6 +918,7 @@ static bool testMultiLinearGeometry ( const Traits& traits )
   pass &= testMultiLinearGeometry< ctype, 4, 5 >( cube4d, traits );
 
   pass &= testNonLinearGeometry<ctype>( traits );
+  pass &= testDegenerateGeometry<ctype>( traits );
 
   return pass;
 }
@@ -376,6 +936,16 @@ int main ( int argc, char **argv )
   pass &= testMultiLinearGeometry< double >
     ( ReferenceWrapperGeometryTraits< double >{} );
 
+  pass &= testGeometryStore< double >();
+
+  std::cout << ">>> Checking ctype = SIMD type with 2 lanes of double" << std::endl;
+  pass &= testSimdGeometry< 2, 2 >( Dune::GeometryType( Dune::Impl::SimplexTopology< 2 >::type::id, 2 ) );
+  pass &= testSimdGeometry< 2, 3 >( Dune::GeometryType( Dune::Impl::CubeTopology< 2 >::type::id, 2 ) );
+  pass &= testSimdGeometry< 3, 3 >( Dune::GeometryType( Dune::Impl::SimplexTopology< 3 >::type::id, 3 ) );
+  pass &= testSimdGeometry< 3, 3 >( Dune::GeometryType( Dune::Impl::PyramidTopology< 3 >::type::id, 3 ) );
+  pass &= testSimdGeometry< 3, 3 >( Dune::GeometryType( Dune::Impl::PrismTopology< 3 >::type::id, 3 ) );
+  pass &= testSimdGeometry< 3, 3 >( Dune::GeometryType( Dune::Impl::CubeTopology< 3 >::type::id, 3 ) );
+
   // std::cout << ">>> Checking ctype = float" << std::endl;
   // pass &= testMultiLinearGeometry< float >
   //   ( Dune::MultiLinearGeometryTraits< float >{} );
@@ -0,0 +1,130 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#include <config.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+
+#include <dune/geometry/multilineargeometry.hh>
+#include <dune/geometry/multilineartabulation.hh>
+#include <dune/geometry/quadraturerules.hh>
+#include <dune/geometry/referenceelements.hh>
+#include <dune/geometry/type.hh>
+
+template< class ctype, int dim, int cdim >
+static bool testTabulation ( const Dune::GeometryType &type, int order )
+{
+  typedef Dune::MultiLinearGeometry< ctype, dim, cdim > Geometry;
+  const ctype epsilon = ctype( 1e4 )*std::numeric_limits< ctype >::epsilon();
+
+  bool pass = true;
+
+  const Dune::MultiLinearTabulation< ctype, dim > &tabulation
+    = Dune::MultiLinearTabulations< ctype, dim >::tabulation( type, order );
+
+  // the cache must return the same object for repeated requests
+  if( &tabulation != &Dune::MultiLinearTabulations< ctype, dim >::tabulation( type, order ) )
+  {
+    std::cerr << "Error: tabulation cache returned different objects for " << type << ", order " << order << "." << std::endl;
+    pass = false;
+  }
+
+  const Dune::QuadratureRule< ctype, dim > &quadrature = Dune::QuadratureRules< ctype, dim >::rule( type, order );
+  if( &tabulation.quadrature() != &quadrature )
+  {
+    std::cerr << "Error: tabulation does not refer to the cached quadrature rule." << std::endl;
+    pass = false;
+  }
+
+  const auto &refElement = Dune::ReferenceElements< ctype, dim >::general( type );
+  if( (tabulation.size() != quadrature.size()) || (tabulation.corners() != refElement.size( dim )) )
+  {
+    std::cerr << "Error: tabulation has wrong size." << std::endl;
+    return false;
+  }
+
+  // distorted corners in a higher-dimensional world
+  std::vector< Dune::FieldVector< ctype, cdim > > corners( refElement.size( dim ) );
+  for( std::size_t c = 0; c < corners.size(); ++c )
+  {
+    const Dune::FieldVector< ctype, dim > &x = refElement.position( c, dim );
+    for( int i = 0; i < cdim; ++i )
+      corners[ c ][ i ] = (i < dim ? ctype( 2 )*x[ i ] : ctype( 0 )) + ctype( 0.1 )*std::sin( ctype( 3*c + i + 1 ) );
+  }
+  const Geometry geometry( type, corners );
+
+  std::vector< typename Geometry::GlobalCoordinate > globals( tabulation.size() );
+  std::vector< typename Geometry::JacobianTransposed > jacobianTransposeds( tabulation.size() );
+  tabulation.evaluate( corners, globals.data(), jacobianTransposeds.data() );
+
+  for( std::size_t qp = 0; qp < tabulation.size(); ++qp )
+  {
+    const typename Geometry::LocalCoordinate &x = quadrature[ qp ].position();
+
+    // the shape functions form a partition of unity
+    ctype sum( 0 );
+    for( int c = 0; c < tabulation.corners(); ++c )
+      sum += tabulation.values( qp )[ c ];
+    if( std::abs( sum - ctype( 1 ) ) > epsilon )
+    {
+      std::cerr << "Error: shape functions do not sum up to one (" << sum << ")." << std::endl;
+      pass = false;
+    }
+
+    const typename Geometry::GlobalCoordinate y = geometry.global( x );
+    if( (globals[ qp ] - y).two_norm() > epsilon )
+    {
+      std::cerr << "Error: tabulated global(" << x << ") = " << globals[ qp ]
+                << ", expected " << y << " (" << type << ", order " << order << ")." << std::endl;
+      pass = false;
+    }
+
+    const typename Geometry::JacobianTransposed jt = geometry.jacobianTransposed( x );
+    for( int j = 0; j < dim; ++j )
+    {
+      if( (jacobianTransposeds[ qp ][ j ] - jt[ j ]).two_norm() > epsilon )
+      {
+        std::cerr << "Error: tabulated jacobianTransposed(" << x << ")[ " << j << " ] = " << jacobianTransposeds[ qp ][ j ]
+                  << ", expected " << jt[ j ] << " (" << type << ", order " << order << ")." << std::endl;
+        pass = false;
+      }
+    }
+  }
+
+  return pass;
+}
+
+template< class ctype, int dim >
+static bool testTabulations ()
+{
+  bool pass = true;
+  for( unsigned int topologyId = 0; topologyId < (1u << dim); topologyId += 2 )
+  {
+    const Dune::GeometryType type( topologyId, dim );
+    const int maxOrder = std::min( int( Dune::QuadratureRules< ctype, dim >::maxOrder( type ) ), 6 );
+    for( int order = 0; order <= maxOrder; ++order )
+    {
+      pass &= testTabulation< ctype, dim, dim >( type, order );
+      pass &= testTabulation< ctype, dim, dim+1 >( type, order );
+    }
+  }
+  return pass;
+}
+
+int main ( int argc, char **argv )
+{
+  bool pass = true;
+
+  pass &= testTabulations< double, 0 >();
+  pass &= testTabulations< double, 1 >();
+  pass &= testTabulations< double, 2 >();
+  pass &= testTabulations< double, 3 >();
+
+  return (pass ? 0 : 1);
+}
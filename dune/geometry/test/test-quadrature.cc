@@ -2,14 +2,22 @@
 // vi: set et ts=4 sw=2 sts=2:
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 #include <config.h>
 
 #include <dune/geometry/referenceelements.hh>
 #include <dune/geometry/quadraturerules.hh>
 #include <dune/geometry/quadraturerules/compositequadraturerule.hh>
+#include <dune/geometry/quadraturerules/staticquadraturerule.hh>
+#include <dune/geometry/quadraturerules/sumfactorization.hh>
 
 bool success = true;
 
@@ -154,6 +162,44 @@ void checkWeights(const QuadratureRule &quad)
   }
 }
 
+/*
+   Check that the structure-of-arrays layout matches the quadrature points
+ */
+template<class QuadratureRule>
+void checkSoA(const QuadratureRule &quad)
+{
+  const unsigned int dim = QuadratureRule::d;
+  const auto &soa = quad.soa();
+  if (soa.size() != quad.size() || soa.paddedSize() < soa.size())
+  {
+    std::cerr << "Error: structure of arrays for " << quad.type()
+              << " and order=" << quad.order() << " has " << soa.size()
+              << " points (padded to " << soa.paddedSize() << "), but the rule has "
+              << quad.size() << std::endl;
+    success = false;
+    return;
+  }
+  if (reinterpret_cast<std::uintptr_t>(soa.weights()) % soa.alignment != 0)
+  {
+    std::cerr << "Error: structure of arrays for " << quad.type()
+              << " and order=" << quad.order() << " is not aligned" << std::endl;
+    success = false;
+  }
+  for (std::size_t i = 0; i < soa.paddedSize(); ++i)
+  {
+    bool match = (i < quad.size() ? soa.weights()[i] == quad[i].weight() : soa.weights()[i] == 0);
+    for (unsigned int d = 0; d < dim; ++d)
+      match &= (i < quad.size() ? soa.position(d)[i] == quad[i].position()[d] : soa.position(d)[i] == 0);
+    if (!match)
+    {
+      std::cerr << "Error: structure of arrays for " << quad.type()
+                << " and order=" << quad.order() << " differs at point " << i << std::endl;
+      success = false;
+      return;
+    }
+  }
+}
+
 template<class ctype, int dim>
 void check(const Dune::GeometryType::BasicType &btype,
            unsigned int maxOrder,
@@ -175,6 +221,7 @@ void check(const Dune::GeometryType::BasicType &btype,
     }
     checkWeights(quad);
     checkQuadrature(quad);
+    checkSoA(quad);
   }
   if (dim>0 && (dim>3 ||
                 btype==Dune::GeometryType::cube ||
@@ -184,6 +231,667 @@ void check(const Dune::GeometryType::BasicType &btype,
   }
 }
 
+/*
+   Look up the rules of all geometry types from several threads at once and
+   make sure everyone gets the same objects, both for preloaded rules and for
+   rules created on demand.
+ */
+template<class ctype, int dim>
+void checkConcurrentLookup(unsigned int maxOrder)
+{
+  typedef Dune::QuadratureRule<ctype, dim> Quad;
+  typedef Dune::QuadratureRules<ctype, dim> Rules;
+
+  std::vector<Dune::GeometryType> types;
+  for (unsigned int topologyId = 0; topologyId < (1u << dim); topologyId += 2)
+    types.emplace_back(topologyId, dim);
+
+  // only create the low orders up front
+  Rules::preload(maxOrder/2, types);
+
+  const unsigned int numThreads = 4;
+  std::vector<std::vector<const Quad*> > rules(numThreads);
+  std::vector<std::thread> threads;
+  for (unsigned int i = 0; i < numThreads; ++i)
+  {
+    threads.emplace_back([&types, &rules, maxOrder, i] () {
+        // start at different orders so the threads race for new rules
+        for (unsigned int q = 0; q <= maxOrder; ++q)
+        {
+          const unsigned int p = (q + i*maxOrder/numThreads) % (maxOrder+1);
+          for (const Dune::GeometryType &t : types)
+            rules[i].push_back(&Rules::rule(t, p));
+        }
+      });
+  }
+  for (std::thread &thread : threads)
+    thread.join();
+
+  for (unsigned int i = 0; i < numThreads; ++i)
+  {
+    std::size_t k = 0;
+    for (unsigned int q = 0; q <= maxOrder; ++q)
+    {
+      const unsigned int p = (q + i*maxOrder/numThreads) % (maxOrder+1);
+      for (const Dune::GeometryType &t : types)
+      {
+        const Quad *quad = rules[i][k++];
+        if (quad != &Rules::rule(t, p) || quad->type() != t || unsigned(quad->order()) < p)
+        {
+          std::cerr << "Error: concurrent lookup returned a wrong rule for " << t
+                    << " and order=" << p << "." << std::endl;
+          success = false;
+          return;
+        }
+      }
+    }
+  }
+}
+
+template<class ctype, int dim>
+void checkHandles()
+{
+  typedef Dune::QuadratureRules<ctype, dim> Rules;
+  const Dune::GeometryType t(Dune::GeometryType::simplex, dim);
+
+  Dune::QuadratureRuleHandle<ctype, dim> handle;
+  if (handle)
+  {
+    std::cerr << "Error: default constructed handle is valid." << std::endl;
+    success = false;
+  }
+
+  handle = Rules::handle(t, 3);
+  if (!handle || handle.get() != &Rules::rule(t, 3) || handle->size() != (*handle).size())
+  {
+    std::cerr << "Error: handle does not refer to the cached rule." << std::endl;
+    success = false;
+  }
+
+  typedef Dune::StaticQuadratureRuleHandle<ctype, dim, Dune::Impl::SimplexTopology<dim>::type::id, 3> StaticHandle;
+  const StaticHandle staticHandle;
+  if (staticHandle.get() != &Rules::rule(t, 3) || Dune::QuadratureRuleHandle<ctype, dim>(staticHandle) != handle)
+  {
+    std::cerr << "Error: static handle does not refer to the cached rule." << std::endl;
+    success = false;
+  }
+}
+
+// the points and weights of static rules are constant expressions
+static_assert(Dune::StaticQuadratureRule<double,1,0,3>::size == 2, "Wrong number of points");
+static_assert(Dune::StaticQuadratureRule<double,2,3,4>::weights[4] > 0.0, "Wrong weight");
+static_assert(Dune::StaticQuadratureRule<double,3,0,2>::points[0][2] > 0.0, "Wrong point");
+
+template<class ctype, int dim, unsigned int topologyId, int p, Dune::QuadratureType::Enum qt>
+void checkStaticRule()
+{
+  typedef Dune::StaticQuadratureRule<ctype, dim, topologyId, p, qt> StaticRule;
+  const Dune::QuadratureRule<ctype, dim> quad = StaticRule::quadratureRule();
+  if (quad.type() != Dune::GeometryType(topologyId, dim) || quad.order() < p || quad.size() != StaticRule::size)
+  {
+    std::cerr << "Error: static quadrature rule for " << quad.type()
+              << " and order=" << p << " is inconsistent." << std::endl;
+    success = false;
+    return;
+  }
+  checkWeights(quad);
+  checkQuadrature(quad);
+}
+
+template<int p, Dune::QuadratureType::Enum qt>
+void checkStaticRules()
+{
+  checkStaticRule<double,1,0,p,qt>();
+  checkStaticRule<double,2,0,p,qt>();
+  checkStaticRule<double,2,3,p,qt>();
+  checkStaticRule<double,3,0,p,qt>();
+  checkStaticRule<double,3,3,p,qt>();
+  checkStaticRule<double,3,5,p,qt>();
+  checkStaticRule<double,3,7,p,qt>();
+}
+
+/*
+   Check the Gauss-type rules computed at runtime: They have to integrate
+   all monomials up to their order exactly (with respect to the weight
+   2^a (1-x)^a of the Gauss-Jacobi rules), and rules beyond the
+   preallocated orders must be cached as well.
+ */
+template<class ctype>
+void checkGaussTypeRule(Dune::QuadratureType::Enum qt, int alpha, unsigned int maxOrder)
+{
+  typedef Dune::QuadratureRules<ctype, 1> Rules;
+  const Dune::GeometryType line(Dune::GeometryType::cube, 1);
+
+  // maxOrder() is the highest tabulated order, not a limit for rule()
+  if (Rules::maxOrder(line, qt) != maxOrder)
+  {
+    std::cerr << "Error: maxOrder of the rules of type " << qt << " is "
+              << Rules::maxOrder(line, qt) << " instead of " << maxOrder << "." << std::endl;
+    success = false;
+  }
+
+  for (int p : { 0, 1, 7, 30, 61, Rules::numCachedOrders, 200 })
+  {
+    const Dune::QuadratureRule<ctype, 1> &quad = Rules::rule(line, p, qt);
+    if (quad.order() < p || &quad != &Rules::rule(line, p, qt))
+    {
+      std::cerr << "Error: rule of type " << qt << " and order " << p
+                << " is too inaccurate or not cached." << std::endl;
+      success = false;
+      continue;
+    }
+
+    for (int k = 0; k <= p; ++k)
+    {
+      ctype integral = 0;
+      for (const auto &qp : quad)
+        integral += qp.weight() * std::pow(qp.position()[0], k);
+
+      // int_0^1 2^a (1-x)^a x^k dx = 2^a a! k! / (k+a+1)!
+      ctype exact = ctype(1 << alpha) / (k+1);
+      for (int a = 1; a <= alpha; ++a)
+        exact *= ctype(a) / (k+a+1);
+      if (std::abs(integral - exact) > 1e-13*exact)
+      {
+        std::cerr << "Error: rule of type " << qt << " and order " << p
+                  << " does not integrate x^" << k << " exactly (exact = " << exact
+                  << ", numerical = " << integral << ")." << std::endl;
+        success = false;
+        break;
+      }
+    }
+  }
+}
+
+template<class ctype>
+void checkGaussTypeRules()
+{
+  checkGaussTypeRule<ctype>(Dune::QuadratureType::GaussLegendre, 0, 61);
+  checkGaussTypeRule<ctype>(Dune::QuadratureType::GaussJacobi_1_0, 1, 61);
+  checkGaussTypeRule<ctype>(Dune::QuadratureType::GaussJacobi_2_0, 2, 61);
+  checkGaussTypeRule<ctype>(Dune::QuadratureType::GaussLobatto, 0, 31);
+
+  // compare with the closed forms of the two-point Gauss and the
+  // three-point Gauss-Lobatto rule
+  const Dune::GeometryType line(Dune::GeometryType::cube, 1);
+  const ctype eps = 4*std::numeric_limits<ctype>::epsilon();
+  const Dune::QuadratureRule<ctype, 1> &gauss = Dune::QuadratureRules<ctype, 1>::rule(line, 3);
+  const Dune::QuadratureRule<ctype, 1> &lobatto
+    = Dune::QuadratureRules<ctype, 1>::rule(line, 3, Dune::QuadratureType::GaussLobatto);
+  const ctype x = std::sqrt(ctype(3)) / 6;
+  bool agree = (gauss.size() == 2 && lobatto.size() == 3);
+  for (std::size_t i = 0; agree && i < 2; ++i)
+    agree = (std::abs(std::abs(gauss[i].position()[0] - ctype(0.5)) - x) < eps)
+            && (std::abs(gauss[i].weight() - ctype(0.5)) < eps);
+  for (std::size_t i = 0; agree && i < 3; ++i)
+  {
+    const ctype xi = lobatto[i].position()[0];
+    const ctype wi = (std::abs(xi - ctype(0.5)) < eps ? ctype(2) / 3 : ctype(1) / 6);
+    agree = (std::abs(xi*(xi-ctype(0.5))*(xi-1)) < eps) && (std::abs(lobatto[i].weight() - wi) < eps);
+  }
+  if (!agree)
+  {
+    std::cerr << "Error: low order Gauss-type rules do not agree with their closed forms." << std::endl;
+    success = false;
+  }
+
+  // products of the computed rules
+  const Dune::GeometryType cube(Dune::GeometryType::cube, 2);
+  const Dune::QuadratureRule<ctype, 2> &quad = Dune::QuadratureRules<ctype, 2>::rule(cube, 150);
+  if (quad.order() < 150 || quad.size() != 76*76 || &quad != &Dune::QuadratureRules<ctype, 2>::rule(cube, 150))
+  {
+    std::cerr << "Error: cube rule of order 150 is inconsistent." << std::endl;
+    success = false;
+  }
+  checkWeights(quad);
+}
+
+/*
+   FNV-1a hashes of the bit patterns of the points and weights (sorted by
+   the points) of the n-point rules, n = 1, ..., 31, of the former literal
+   tables, correctly rounded to double and float.
+ */
+const std::uint64_t formerTableHashes[3][2][31] = {
+  // Gauss-Legendre
+  {
+    { // double
+      0x5fa28807b4eb6fedull, 0x472a5178f28f271cull, 0x976e19a1d46394acull,
+      0x8c8e57a086cf8ca7ull, 0x9d47bbe3d76336bbull, 0xef48fcced6ced81aull,
+      0x3ac514508829fab8ull, 0xce0b119d794de6c9ull, 0x7d5d08f6a1071bfaull,
+      0x90fe8485a717d483ull, 0x1f0ea359eb2878d6ull, 0xc5cab90cc7f92938ull,
+      0x28bfa7a4eb43ffa1ull, 0x0851cfc624f61d9bull, 0x5fac20ce56b648a3ull,
+      0xd715282bac6f5b80ull, 0xceecc0935bfab43dull, 0xde7f179b7327a657ull,
+      0x5c5c87bea2929dcdull, 0xf8f3d81f18c68b9full, 0xab4f7a927d4b8ac7ull,
+      0x1da431ba71296d51ull, 0x9f63807ca5e05a2eull, 0x2fa6399586a2d690ull,
+      0xcb443d9e154e2377ull, 0xb39fe2853ed0cf1dull, 0x0466521b20b6e589ull,
+      0xf44ec418c30ae145ull, 0x1076027873170f14ull, 0x025b611121ee22d0ull,
+      0x084551ae56463fe0ull
+    },
+    { // float
+      0x88332678e86b6fedull, 0xf9a707e9f088946cull, 0x507c6a061d36e2cbull,
+      0xc4b9f952bf29f86bull, 0xe9a5ab0258beafbdull, 0x073c6eb85f092494ull,
+      0x642d6b3eb0dbd8fbull, 0xc19e5ed6c30c4a42ull, 0x61deff5e1439d36aull,
+      0x321390855b24f0c2ull, 0x8ecb27787bd75caaull, 0xadda08eb42b01791ull,
+      0x1f2eb1c7174937b5ull, 0xe52c2dd08059226full, 0x3d51b9075ed52431ull,
+      0x76e3374899c16130ull, 0xb81cf73f7aa6c637ull, 0x5cdaeacb567de846ull,
+      0x4ae8041cc73c4e21ull, 0x362a54b1cd0ee3f3ull, 0xfb24639586016891ull,
+      0xccf490950baf07c1ull, 0x8fdf1c318c7b86f4ull, 0x78fb1866fdbb533cull,
+      0x9256a82b901a9a0dull, 0x86219b4d8ddbc2c4ull, 0xd7c4ead4e0866365ull,
+      0x21ba72c3b7f99372ull, 0x9e5eb9e2f4de10c4ull, 0xde49a31bd73213b8ull,
+      0x740589e13d60e8fbull
+    }
+  },
+  // Gauss-Jacobi, alpha = 1
+  {
+    { // double
+      0x368c3d26670747f0ull, 0xbc5386deb9931086ull, 0x445ee2433632d1e0ull,
+      0x85b0cfd45b7f936dull, 0x56a026d57062de27ull, 0x869d664f0db7eaaeull,
+      0xcc774fea83c8972bull, 0x31deb8fa8a0501d3ull, 0x8c62aedb89bb8392ull,
+      0x4f96722c57bc7be8ull, 0x52b765f0b8087b03ull, 0x6ef4f9fb0500c505ull,
+      0x944def20736914e0ull, 0x1c72f3a465241144ull, 0xcf69681063f94d66ull,
+      0x09dab3471a6b5a71ull, 0x31690ae49218b4f1ull, 0xb572dac46145bfddull,
+      0xa09093ab42ddfb24ull, 0xba0acd3f2b008a4full, 0x9931489cf2261fa0ull,
+      0x123e921cb7802139ull, 0x7bc4ce6c998b1ec3ull, 0x1d42fee0476f12f0ull,
+      0xf54fad145296ffcfull, 0x5e1758331da6d636ull, 0x54209cd3ca59cebdull,
+      0x8cb03feab6d371fdull, 0x6aa8913da96643e8ull, 0x2fb60ac21a3c9638ull,
+      0x390586913c46902dull
+    },
+    { // float
+      0x883bface6772f1beull, 0xd34f07e3ccbc6d39ull, 0x1017ce629034ac94ull,
+      0x09473cafcc24df22ull, 0x46ee764769e4f4cdull, 0x4ef12040064b14adull,
+      0xef05e98fecd91aafull, 0x8422e42b1ef1b229ull, 0x2a5725ba1a5d6737ull,
+      0xab100122392ead9aull, 0x5d0595ae4e31d46cull, 0xb849b84da8c6b580ull,
+      0x91d167c1fef6a637ull, 0xb55f60144e5d02f2ull, 0x49563857f4288135ull,
+      0x201efc940b011c6eull, 0x983bcdccb533fa56ull, 0x5b39a1f1d122507aull,
+      0xf4d49a18d674ff47ull, 0x0db48396451e9572ull, 0x8fe208a8bcfefcd2ull,
+      0x6df18f6b0a53c174ull, 0x1eef1368754756f0ull, 0x0f9a9f6cff3f5191ull,
+      0xca70422ce4dcaa6full, 0x6375e54b6b589fc8ull, 0xf893e99ec138bdf8ull,
+      0x29900312e2358f63ull, 0xde4cedd5f2ca21b0ull, 0xec1a02b28ec56b4eull,
+      0x22dd1fc594e8488cull
+    }
+  },
+  // Gauss-Jacobi, alpha = 2
+  {
+    { // double
+      0x859eede2193cf07eull, 0xe8f91e26e1ce8896ull, 0x1368cbb4ee6c1aa6ull,
+      0x0a0f0171cbf3c680ull, 0x16f6a9df10d687fbull, 0x3ae2c49b49b4dcf0ull,
+      0xab51eca20a4e63c4ull, 0xa60ac4de4eb0a806ull, 0x0cb1065cf9b1f1c6ull,
+      0xd2d3e5ce2eb773bbull, 0x16b5541bf3e11436ull, 0xc17316cdbe24a58full,
+      0x88956ca077215d6dull, 0x3828b113beb76651ull, 0x68bf9a0a2d756851ull,
+      0x249c17601ca57282ull, 0xfb57d9ad6ab9d5fcull, 0x990daddec42e0101ull,
+      0xbbde902e45da2adaull, 0xa1ecd5941e1158e2ull, 0x270f3f7a90795d9cull,
+      0xd60ade886a47239aull, 0xdde7ebdc438b77c6ull, 0xf820a7ff75c875c2ull,
+      0xcc653cdcaeb91c65ull, 0xab9246136279f8ffull, 0x7bc86291bfb5a588ull,
+      0x2b998c537f971c68ull, 0x4deba228c9f3a06eull, 0x2eb7c42836e69a4eull,
+      0xe688c462a4b360d8ull
+    },
+    { // float
+      0xb198ba5e43430c1cull, 0x29c0f39c2171137cull, 0x39643eb316f5e990ull,
+      0xf19cb07131d5046cull, 0x69014b9f5a039870ull, 0x15abaefe4f4c0507ull,
+      0xfde0075de8415766ull, 0x76d10dbef4783013ull, 0xa18a86de4f02c59dull,
+      0xad8a6e0e8c6790e8ull, 0x56d0ec8661db610dull, 0x169ad9e884d6ca90ull,
+      0xe3ea02c97b9b23d6ull, 0xf3fa4572a03e321full, 0xf519077eb539eba4ull,
+      0x91a1db5920b377e8ull, 0x02a0c1015d8e8a90ull, 0xa65142f3dfc9ad0eull,
+      0xa9b6a4a2c033e06full, 0x0dd0a832b27ee40bull, 0xa806fbbe9d8e7130ull,
+      0x482688204631d5ebull, 0xe26f1136c42ae354ull, 0x82d1838a53edfa02ull,
+      0x82213469e5a8bfb4ull, 0x99c61e431576136full, 0x341f74a83d96a31eull,
+      0x3a53e0364d378890ull, 0x0d8dc528418bfe8bull, 0xe5193be15b328c31ull,
+      0x95d0314de5b96576ull
+    }
+  }
+};
+
+template<class ctype, class Bits>
+std::uint64_t bitHash(const Dune::QuadratureRule<ctype, 1> &quad)
+{
+  std::vector<std::pair<ctype, ctype> > values;
+  for (const auto &qp : quad)
+    values.emplace_back(qp.position()[0], qp.weight());
+  std::sort(values.begin(), values.end());
+
+  std::uint64_t hash = 0xcbf29ce484222325ull;
+  for (const auto &value : values)
+    for (ctype v : { value.first, value.second })
+    {
+      Bits bits;
+      static_assert(sizeof(bits) == sizeof(v), "Bits has to match ctype");
+      std::memcpy(&bits, &v, sizeof(bits));
+      hash = (hash ^ bits) * 0x100000001b3ull;
+    }
+  return hash;
+}
+
+// the Gauss-Legendre and Gauss-Jacobi rules up to order 61 are bit-identical to the former tables
+template<class ctype, class Bits>
+void checkFormerTables(int column)
+{
+  const Dune::GeometryType line(Dune::GeometryType::cube, 1);
+  const Dune::QuadratureType::Enum types[ 3 ]
+    = { Dune::QuadratureType::GaussLegendre, Dune::QuadratureType::GaussJacobi_1_0, Dune::QuadratureType::GaussJacobi_2_0 };
+  for (int alpha = 0; alpha < 3; ++alpha)
+    for (int n = 1; n <= 31; ++n)
+    {
+      const Dune::QuadratureRule<ctype, 1> &quad = Dune::QuadratureRules<ctype, 1>::rule(line, 2*n-1, types[alpha]);
+      if ((quad.size() != std::size_t(n)) || (bitHash<ctype, Bits>(quad) != formerTableHashes[alpha][column][n-1]))
+      {
+        std::cerr << "Error: " << n << "-point rule of type " << types[alpha] << " (" << (column == 0 ? "double" : "float")
+                  << ") differs from the former table." << std::endl;
+        success = false;
+      }
+    }
+}
+
+template<class ctype, int dim>
+void checkTensorProduct(unsigned int maxOrder)
+{
+  const Dune::GeometryType cube(Dune::GeometryType::cube, dim);
+  const Dune::GeometryType simplex(Dune::GeometryType::simplex, dim);
+  // the line is both a cube and a simplex
+  if ((dim > 1) && Dune::QuadratureRules<ctype, dim>::rule(simplex, 2).isTensorProduct())
+  {
+    std::cerr << "Error: simplex rule claims to be a tensor product." << std::endl;
+    success = false;
+  }
+
+  for (unsigned int p=0; p<=maxOrder; ++p)
+  {
+    const Dune::QuadratureRule<ctype, dim> &quad = Dune::QuadratureRules<ctype, dim>::rule(cube, p);
+    if (!quad.isTensorProduct())
+    {
+      std::cerr << "Error: cube rule of order " << p << " is not a tensor product." << std::endl;
+      success = false;
+      return;
+    }
+
+    // the points are the tensor products of the factors, direction 0 varying slowest
+    const std::array<std::size_t, dim> sizes = Dune::tensorSizes(quad);
+    std::size_t size = 1;
+    for (int k=0; k<dim; ++k)
+      size *= sizes[k];
+    if (size != quad.size())
+    {
+      std::cerr << "Error: tensor factors of cube rule of order " << p << " have wrong sizes." << std::endl;
+      success = false;
+      return;
+    }
+    for (std::size_t q=0; q<quad.size(); ++q)
+    {
+      ctype weight = 1;
+      for (int k=dim-1, i=q; k>=0; i /= sizes[k], --k)
+      {
+        const auto &factorPoint = quad.tensorFactor(k)[i % sizes[k]];
+        weight *= factorPoint.weight();
+        if (std::abs(quad[q].position()[k] - factorPoint.position()[0]) > std::numeric_limits<ctype>::epsilon())
+        {
+          std::cerr << "Error: point " << q << " of cube rule of order " << p << " does not match its tensor factors." << std::endl;
+          success = false;
+        }
+      }
+      if (std::abs(quad[q].weight() - weight) > 8*std::numeric_limits<ctype>::epsilon())
+      {
+        std::cerr << "Error: weight " << q << " of cube rule of order " << p << " does not match its tensor factors." << std::endl;
+        success = false;
+      }
+    }
+
+    // sum-factorized evaluation of x^alpha (alpha_k < m) in all points
+    const std::size_t m = std::min(p+1, 4u);
+    std::array<std::vector<ctype>, dim> values;
+    std::array<const ctype *, dim> matrices;
+    std::array<std::size_t, dim> cols;
+    for (int k=0; k<dim; ++k)
+    {
+      for (std::size_t i=0; i<sizes[k]; ++i)
+        for (std::size_t j=0; j<m; ++j)
+          values[k].push_back(std::pow(quad.tensorFactor(k)[i].position()[0], ctype(j)));
+      matrices[k] = values[k].data();
+      cols[k] = m;
+    }
+    Dune::TensorContraction<ctype, dim> contraction(sizes, cols);
+
+    std::vector<ctype> coefficients(contraction.colSize());
+    for (std::size_t j=0; j<coefficients.size(); ++j)
+      coefficients[j] = ctype(j % 7) - ctype(3);
+    std::vector<ctype> u(contraction.rowSize());
+    contraction.apply(matrices, coefficients.data(), u.data());
+    for (std::size_t q=0; q<quad.size(); ++q)
+    {
+      ctype direct = 0;
+      for (std::size_t j=0; j<coefficients.size(); ++j)
+      {
+        ctype monomial = 1;
+        for (int k=dim-1, i=j; k>=0; i /= m, --k)
+          monomial *= std::pow(quad[q].position()[k], ctype(i % m));
+        direct += coefficients[j] * monomial;
+      }
+      if (std::abs(u[q] - direct) > 1e3*std::numeric_limits<ctype>::epsilon())
+      {
+        std::cerr << "Error: sum-factorized evaluation differs from direct evaluation in point " << q
+                  << " of cube rule of order " << p << "." << std::endl;
+        success = false;
+      }
+    }
+
+    // integration of all x^alpha via the transposed contraction
+    std::vector<ctype> weights(quad.size()), integrals(contraction.colSize());
+    for (std::size_t q=0; q<quad.size(); ++q)
+      weights[q] = quad[q].weight();
+    contraction.applyTransposed(matrices, weights.data(), integrals.data());
+    for (std::size_t j=0; j<integrals.size(); ++j)
+    {
+      ctype exact = 1;
+      for (int k=dim-1, i=j; k>=0; i /= m, --k)
+        exact /= ctype(i % m + 1);
+      if (std::abs(integrals[j] - exact) > 1e3*std::numeric_limits<ctype>::epsilon())
+      {
+        std::cerr << "Error: sum-factorized integration of monomial " << j
+                  << " with cube rule of order " << p << " is wrong." << std::endl;
+        success = false;
+      }
+    }
+  }
+}
+
+/*
+   The symmetric simplex rules must have positive weights and interior points
+   and they must integrate all monomials up to their order exactly.
+ */
+template<class ctype, int dim>
+void checkSymmetricSimplexRules()
+{
+  const Dune::GeometryType t(Dune::GeometryType::simplex, dim);
+  const int maxOrder = Dune::SymmetricSimplexQuadratureRule<ctype, dim>::highest_order;
+  for (int p=0; p<=maxOrder; ++p)
+  {
+    const Dune::QuadratureRule<ctype, dim> &quad = Dune::QuadratureRules<ctype, dim>::rule(t, p, Dune::QuadratureType::Symmetric);
+    if (quad.order() < p)
+    {
+      std::cerr << "Error: symmetric rule for order " << p << " has order " << quad.order() << "." << std::endl;
+      success = false;
+      continue;
+    }
+
+    for (const auto &qp : quad)
+    {
+      ctype lambda0 = 1;
+      bool interior = (qp.weight() > 0);
+      for (int i=0; i<dim; ++i)
+      {
+        interior &= (qp.position()[i] > 0);
+        lambda0 -= qp.position()[i];
+      }
+      if (!interior || !(lambda0 > 0))
+      {
+        std::cerr << "Error: symmetric rule for order " << p << " has a non-positive weight or a point on the boundary." << std::endl;
+        success = false;
+        break;
+      }
+    }
+
+    // integrate x^alpha for |alpha| <= order, exact value alpha! / (|alpha|+dim)!
+    std::array<int, dim> alpha;
+    alpha.fill(0);
+    while (true)
+    {
+      int degree = 0;
+      ctype exact = 1;
+      for (int i=0; i<dim; ++i)
+        for (int k=1; k<=alpha[i]; ++k)
+          exact *= ctype(k) / ctype(++degree);
+      for (int k=1; k<=dim; ++k)
+        exact /= ctype(++degree);
+
+      ctype integral = 0;
+      for (const auto &qp : quad)
+      {
+        ctype value = qp.weight();
+        for (int i=0; i<dim; ++i)
+          value *= std::pow(qp.position()[i], alpha[i]);
+        integral += value;
+      }
+      if (std::abs(integral - exact) > 1e-12*exact)
+      {
+        std::cerr << "Error: symmetric rule for order " << p << " does not integrate x^(";
+        for (int i=0; i<dim; ++i)
+          std::cerr << (i > 0 ? "," : "") << alpha[i];
+        std::cerr << ") exactly (relative error " << std::abs(integral - exact) / exact << ")." << std::endl;
+        success = false;
+      }
+
+      // next multi-index with |alpha| <= order
+      int i = 0;
+      for (; i<dim; ++i)
+      {
+        int sum = 0;
+        for (int j=0; j<dim; ++j)
+          sum += alpha[j];
+        if (sum < quad.order())
+        {
+          ++alpha[i];
+          break;
+        }
+        alpha[i] = 0;
+      }
+      if (i == dim)
+        break;
+    }
+
+    // beyond the classical simplex rules, we must beat the conical product rules
+    if (p > Dune::SimplexQuadratureRule<ctype, dim>::highest_order
+        && quad.size() >= Dune::QuadratureRules<ctype, dim>::rule(t, p).size())
+    {
+      std::cerr << "Error: symmetric rule for order " << p << " has " << quad.size()
+                << " points, which is not less than the Gauss-Legendre rule." << std::endl;
+      success = false;
+    }
+  }
+}
+
+/*
+   The symmetric prism rules must have positive weights and interior points,
+   integrate all monomials up to their order exactly, and need fewer points
+   than the Gauss-Legendre based rules.
+ */
+template<class ctype>
+void checkSymmetricPrismRules()
+{
+  const Dune::GeometryType t(Dune::GeometryType::prism, 3);
+  const int maxOrder = Dune::SymmetricPrismQuadratureRule<ctype, 3>::highest_order;
+  for (int p=0; p<=maxOrder; ++p)
+  {
+    const Dune::QuadratureRule<ctype, 3> &quad = Dune::QuadratureRules<ctype, 3>::rule(t, p, Dune::QuadratureType::Symmetric);
+    if (quad.order() < p)
+    {
+      std::cerr << "Error: symmetric prism rule for order " << p << " has order " << quad.order() << "." << std::endl;
+      success = false;
+      continue;
+    }
+
+    for (const auto &qp : quad)
+    {
+      const auto &x = qp.position();
+      if (!(qp.weight() > 0) || !(x[0] > 0) || !(x[1] > 0) || !(x[0] + x[1] < 1) || !(x[2] > 0) || !(x[2] < 1))
+      {
+        std::cerr << "Error: symmetric prism rule for order " << p << " has a non-positive weight or a point on the boundary." << std::endl;
+        success = false;
+        break;
+      }
+    }
+
+    // integrate x^a y^b z^c, exact value a! b! / ((a+b+2)! (c+1))
+    for (int a=0; a<=quad.order(); ++a)
+      for (int b=0; a+b<=quad.order(); ++b)
+        for (int c=0; a+b+c<=quad.order(); ++c)
+        {
+          ctype exact = ctype(1) / ctype(c+1);
+          int degree = 0;
+          for (int k=1; k<=a; ++k)
+            exact *= ctype(k) / ctype(++degree);
+          for (int k=1; k<=b; ++k)
+            exact *= ctype(k) / ctype(++degree);
+          exact /= ctype(++degree);
+          exact /= ctype(++degree);
+
+          ctype integral = 0;
+          for (const auto &qp : quad)
+          {
+            const auto &x = qp.position();
+            integral += qp.weight() * std::pow(x[0], a) * std::pow(x[1], b) * std::pow(x[2], c);
+          }
+          if (std::abs(integral - exact) > 1e-12*exact)
+          {
+            std::cerr << "Error: symmetric prism rule for order " << p << " does not integrate x^" << a
+                      << " y^" << b << " z^" << c << " exactly (relative error " << std::abs(integral - exact) / exact << ")." << std::endl;
+            success = false;
+          }
+        }
+
+    if (p > Dune::PrismQuadratureRule<ctype, 3>::highest_order
+        && quad.size() >= Dune::QuadratureRules<ctype, 3>::rule(t, p).size())
+    {
+      std::cerr << "Error: symmetric prism rule for order " << p << " has " << quad.size()
+                << " points, which is not less than the Gauss-Legendre rule." << std::endl;
+      success = false;
+    }
+  }
+}
+
+/*
+   The collapsed pyramid rules must integrate the rational functions
+   (xy/(1-z))^p exactly, and need fewer points than the conical product rules.
+ */
+template<class ctype>
+void checkPyramidRules(unsigned int maxOrder)
+{
+  const Dune::GeometryType t(Dune::GeometryType::pyramid, 3);
+  for (unsigned int p=0; p<=maxOrder; ++p)
+  {
+    const Dune::QuadratureRule<ctype, 3> &quad = Dune::QuadratureRules<ctype, 3>::rule(t, p, Dune::QuadratureType::Symmetric);
+
+    // exact value 1 / ((p+1)^2 (p+3))
+    const ctype exact = ctype(1) / ctype((p+1)*(p+1)*(p+3));
+    ctype integral = 0;
+    for (const auto &qp : quad)
+    {
+      const auto &x = qp.position();
+      integral += qp.weight() * std::pow(x[0]*x[1] / (1 - x[2]), double(p));
+    }
+    if (std::abs(integral - exact) > 1e-12*exact)
+    {
+      std::cerr << "Error: pyramid rule for order " << p << " does not integrate (xy/(1-z))^" << p
+                << " exactly (relative error " << std::abs(integral - exact) / exact << ")." << std::endl;
+      success = false;
+    }
+
+    if (quad.size() >= Dune::QuadratureRules<ctype, 3>::rule(t, p).size())
+    {
+      std::cerr << "Error: pyramid rule for order " << p << " has " << quad.size()
+                << " points, which is not less than the conical product rule." << std::endl;
+      success = false;
+    }
+  }
+}
+
 template<class ctype, int dim>
 void checkCompositeRule(const Dune::GeometryType::BasicType &btype,
                         unsigned int maxOrder,
@@ -202,6 +910,7 @@ void checkCompositeRule(const Dune::GeometryType::BasicType &btype,
 
     checkWeights(quad);
     checkQuadrature(quad);
+    checkSoA(quad);
   }
   if (dim>0 && (dim>3 ||
                 btype==Dune::GeometryType::cube ||
@@ -220,12 +929,37 @@ int main (int argc, char** argv)
     std::cout << "maxOrder = " << maxOrder << std::endl;
   }
   try {
+    checkConcurrentLookup<double,3>(std::min(maxOrder, unsigned(Dune::QuadratureRules<double,3>::numFastOrders + 4)));
+    checkHandles<double,2>();
+    checkHandles<double,3>();
+
+    checkStaticRules<0, Dune::QuadratureType::GaussLegendre>();
+    checkStaticRules<5, Dune::QuadratureType::GaussLegendre>();
+    checkStaticRules<12, Dune::QuadratureType::GaussLegendre>();
+    checkStaticRules<7, Dune::QuadratureType::GaussLobatto>();
+
+    checkGaussTypeRules<double>();
+    checkFormerTables<double, std::uint64_t>(0);
+    checkFormerTables<float, std::uint32_t>(1);
+
+    checkTensorProduct<double,1>(std::min(maxOrder, unsigned(20)));
+    checkTensorProduct<double,2>(std::min(maxOrder, unsigned(20)));
+    checkTensorProduct<double,3>(std::min(maxOrder, unsigned(20)));
+
+    checkSymmetricSimplexRules<double,2>();
+    checkSymmetricSimplexRules<double,3>();
+    checkSymmetricPrismRules<double>();
+    checkPyramidRules<double>(std::min(maxOrder, unsigned(20)));
+
     check<double,4>(Dune::GeometryType::cube, maxOrder);
     check<double,4>(Dune::GeometryType::cube, std::min(maxOrder, unsigned(31)),
                     Dune::QuadratureType::GaussLobatto);
     check<double,4>(Dune::GeometryType::simplex, maxOrder);
+    check<double,3>(Dune::GeometryType::simplex, maxOrder, Dune::QuadratureType::Symmetric);
     check<double,3>(Dune::GeometryType::prism, maxOrder);
     check<double,3>(Dune::GeometryType::pyramid, maxOrder);
+    check<double,3>(Dune::GeometryType::prism, maxOrder, Dune::QuadratureType::Symmetric);
+    check<double,3>(Dune::GeometryType::pyramid, maxOrder, Dune::QuadratureType::Symmetric);
 
     unsigned int maxRefinement = 4;
 
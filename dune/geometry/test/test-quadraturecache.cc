@@ -0,0 +1,159 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+#include <config.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <dune/common/exceptions.hh>
+
+#include <dune/geometry/quadraturerules.hh>
+
+/*
+   A cache file is written by this program and then read by a second
+   instance of it (started with the name of the file), because rules once
+   created in a process are never replaced.  The first weight in the file is
+   modified in between, so the second instance can tell whether it really
+   obtained the rules from the file.
+ */
+
+bool success = true;
+
+const double marker = 42.0;
+
+// the rules written to and read from the cache file (in this order)
+void useRules()
+{
+  typedef Dune::QuadratureRules<double, 3> Rules;
+  for (int p = 0; p <= 8; ++p)
+  {
+    Rules::rule(Dune::GeometryType(Dune::GeometryType::cube, 3), p);
+    Rules::rule(Dune::GeometryType(Dune::GeometryType::simplex, 3), p);
+    Rules::rule(Dune::GeometryType(Dune::GeometryType::prism, 3), p, Dune::QuadratureType::Symmetric);
+    Rules::rule(Dune::GeometryType(Dune::GeometryType::pyramid, 3), p);
+  }
+  Rules::rule(Dune::GeometryType(Dune::GeometryType::cube, 3), 70, Dune::QuadratureType::GaussLobatto);
+}
+
+std::vector<char> readFile(const std::string &filename)
+{
+  std::ifstream in(filename.c_str(), std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void writeFile(const std::string &filename, const std::vector<char> &data)
+{
+  std::ofstream out(filename.c_str(), std::ios::binary);
+  out.write(data.data(), data.size());
+}
+
+template<class ctype, int dim>
+void checkRejected(const std::string &filename, const std::string &reason)
+{
+  try {
+    Dune::QuadratureRules<ctype, dim>::readCache(filename);
+    std::cerr << "Error: cache file " << reason << " was accepted." << std::endl;
+    success = false;
+  }
+  catch (const Dune::IOError &) {}
+}
+
+int writer(const std::string &program)
+{
+  const std::string filename = "test-quadraturecache.cache";
+  useRules();
+  Dune::QuadratureRules<double, 3>::writeCache(filename);
+
+  std::vector<char> data = readFile(filename);
+  const std::size_t firstWeight = sizeof(Dune::Impl::QuadratureCacheHeader)
+                                  + sizeof(Dune::Impl::QuadratureCacheRecord)
+                                  + 3*sizeof(std::int32_t) + 3*sizeof(double);
+  if (data.size() < firstWeight + sizeof(double))
+  {
+    std::cerr << "Error: cache file is too small." << std::endl;
+    return 1;
+  }
+
+  // files not matching the reader must be rejected
+  checkRejected<float, 3>(filename, "for float");
+  checkRejected<double, 2>(filename, "for dimension 2");
+  writeFile(filename + ".truncated", std::vector<char>(data.begin(), data.end() - 1));
+  checkRejected<double, 3>(filename + ".truncated", "missing its last byte");
+  std::vector<char> corrupt(data);
+  corrupt[0] = 'X';
+  writeFile(filename + ".corrupt", corrupt);
+  checkRejected<double, 3>(filename + ".corrupt", "with broken magic number");
+  checkRejected<double, 3>(filename + ".missing", "that does not exist");
+
+  // writing into a missing directory must fail cleanly
+  try {
+    Dune::QuadratureRules<double, 3>::writeCache("test-quadraturecache.missing/" + filename);
+    std::cerr << "Error: cache file written into a missing directory." << std::endl;
+    success = false;
+  }
+  catch (const Dune::IOError &) {}
+
+  std::memcpy(data.data() + firstWeight, &marker, sizeof(double));
+  writeFile(filename, data);
+
+  if (std::system((program + " " + filename).c_str()) != 0)
+  {
+    std::cerr << "Error: reading the cache file failed." << std::endl;
+    return 1;
+  }
+
+  // the reader writes the rules it obtained, which must coincide with ours
+  if (readFile(filename + ".reread") != data)
+  {
+    std::cerr << "Error: rules read from the cache file differ from the rules written." << std::endl;
+    success = false;
+  }
+  return success ? 0 : 1;
+}
+
+int reader(const std::string &filename)
+{
+  const std::size_t numRules = Dune::QuadratureRules<double, 3>::readCache(filename);
+  if (numRules != 4*9 + 1)
+  {
+    std::cerr << "Error: cache file contains " << numRules << " rules." << std::endl;
+    success = false;
+  }
+
+  useRules();
+
+  const Dune::QuadratureRule<double, 3> &quad
+    = Dune::QuadratureRules<double, 3>::rule(Dune::GeometryType(Dune::GeometryType::cube, 3), 0);
+  if (quad[0].weight() != marker || quad.soa().weights()[0] != marker)
+  {
+    std::cerr << "Error: rule was not taken from the cache file." << std::endl;
+    success = false;
+  }
+  if (!quad.isTensorProduct()
+      || !Dune::QuadratureRules<double, 3>::rule(Dune::GeometryType(Dune::GeometryType::cube, 3), 8).isTensorProduct())
+  {
+    std::cerr << "Error: rule read from the cache file lost its tensor product structure." << std::endl;
+    success = false;
+  }
+
+  Dune::QuadratureRules<double, 3>::writeCache(filename + ".reread");
+  return success ? 0 : 1;
+}
+
+int main(int argc, char** argv)
+{
+  try {
+    return (argc > 1 ? reader(argv[1]) : writer(argv[0]));
+  }
+  catch (const Dune::Exception &e)
+  {
+    std::cerr << e << std::endl;
+    return 1;
+  }
+}
@@ -8,10 +8,21 @@
 
 #include "config.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <iostream>
+#include <map>
+#include <memory>
 #include <ostream>
+#include <thread>
+#include <vector>
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/fmatrix.hh>
 
 #include <dune/geometry/test/checkgeometry.hh>
+#include <dune/geometry/multilineargeometry.hh>
 #include <dune/geometry/referenceelements.hh>
 #include <dune/geometry/type.hh>
 #include <dune/geometry/virtualrefinement.hh>
@@ -44,6 +55,253 @@ void collect(int &result, bool passed)
   }
 }
 
+/*!
+ * \brief Test that exportLevel() agrees with the iterators
+ *
+ * The level may be given by a number or by RefinementIntervals.
+ */
+template <class Refinement, class Level>
+void testExportLevel(int &result, const Refinement &refinement, const Level &level)
+{
+  typedef typename Refinement::ElementIterator eIterator;
+  typedef typename Refinement::VertexIterator vIterator;
+
+  const int dim = Refinement::CoordVector::dimension;
+  const int nCorners = refinement.nCorners();
+  std::vector<double> coords(refinement.nVertices(level)*dim);
+  std::vector<int> connectivity(refinement.nElements(level)*nCorners);
+  std::vector<double> corners(connectivity.size()*dim);
+  refinement.exportLevel(level, coords.data(), connectivity.data(), corners.data());
+
+  // the arrays have to be independent of each other
+  std::vector<double> cornersOnly(corners.size());
+  refinement.exportLevel(level, nullptr, nullptr, cornersOnly.data());
+
+  bool passed = (cornersOnly == corners);
+
+  vIterator vSubEnd = refinement.vEnd(level);
+  for (vIterator vSubIt = refinement.vBegin(level); vSubIt != vSubEnd; ++vSubIt)
+    for (int j = 0; j < dim; ++j)
+      passed &= (coords[vSubIt.index()*dim + j] == vSubIt.coords()[j]);
+
+  eIterator eSubEnd = refinement.eEnd(level);
+  for (eIterator eSubIt = refinement.eBegin(level); eSubIt != eSubEnd; ++eSubIt)
+  {
+    const auto vertexIndices = eSubIt.vertexIndices();
+    for (int k = 0; k < nCorners; ++k)
+      passed &= (connectivity[eSubIt.index()*nCorners + k] == vertexIndices[k]);
+  }
+
+  if (!passed)
+    std::cerr << "Error: exportLevel() does not agree with the iterators" << std::endl;
+  collect(result, passed);
+}
+
+/*!
+ * \brief Test that the tables of a level are shared
+ */
+template <class Refinement, class Table>
+bool isSharedTable(const Refinement &refinement, int level, const Table &table)
+{
+  typedef typename Refinement::Intervals Intervals;
+  return (refinement.table(level) == table) && (refinement.table(Intervals::level(level)) == table);
+}
+
+/*!
+ * \brief Test that the tables of other intervals are not kept
+ */
+template <class Refinement, class Table>
+bool isSharedTable(const Refinement &refinement, const typename Refinement::Intervals &intervals,
+                   const Table &table)
+{
+  return (refinement.table(intervals) == table);
+}
+
+/*!
+ * \brief Test that the table of a level holds the arrays of exportLevel()
+ *
+ * Only the tables of refinement levels are created once and shared.
+ */
+template <class Refinement, class Level>
+void testTable(int &result, const Refinement &refinement, const Level &level, bool shared)
+{
+  const int dim = Refinement::CoordVector::dimension;
+  const int nCorners = refinement.nCorners();
+  std::vector<double> coords(refinement.nVertices(level)*dim);
+  std::vector<int> connectivity(refinement.nElements(level)*nCorners);
+  std::vector<double> corners(connectivity.size()*dim);
+  refinement.exportLevel(level, coords.data(), connectivity.data(), corners.data());
+
+  const auto table = refinement.table(level);
+  const bool passed = (isSharedTable(refinement, level, table) == shared)
+                      && (table->nVertices() == int(refinement.nVertices(level)))
+                      && (table->nElements() == int(refinement.nElements(level)))
+                      && (table->nCorners() == nCorners)
+                      && std::equal(coords.begin(), coords.end(), table->coords())
+                      && std::equal(connectivity.begin(), connectivity.end(), table->connectivity())
+                      && std::equal(corners.begin(), corners.end(), table->corners());
+  if (!passed)
+    std::cerr << "Error: table() does not agree with exportLevel()" << std::endl;
+  collect(result, passed);
+}
+
+/*!
+ * \brief Test that the ranges of a split level traverse the level
+ */
+template <class Refinement, class Level>
+void testRanges(int &result, const Refinement &refinement, const Level &level)
+{
+  typedef typename Refinement::ElementIterator eIterator;
+  typedef typename Refinement::VertexIterator vIterator;
+
+  std::vector<int> vIndices, eIndices;
+  std::vector<typename Refinement::CoordVector> vCoords, eCoords;
+  vIterator vSubEnd = refinement.vEnd(level);
+  for (vIterator vSubIt = refinement.vBegin(level); vSubIt != vSubEnd; ++vSubIt)
+  {
+    vIndices.push_back(vSubIt.index());
+    vCoords.push_back(vSubIt.coords());
+  }
+  eIterator eSubEnd = refinement.eEnd(level);
+  for (eIterator eSubIt = refinement.eBegin(level); eSubIt != eSubEnd; ++eSubIt)
+  {
+    eIndices.push_back(eSubIt.index());
+    eCoords.push_back(eSubIt.coords());
+  }
+
+  bool passed = true;
+  const int nVertices = vIndices.size();
+  const int nElements = eIndices.size();
+  for (int nParts : {1, 2, 3, 7})
+  {
+    int i = 0;
+    for (int part = 0; part < nParts; ++part)
+    {
+      const auto range = refinement.vRange(level, nVertices*part/nParts, nVertices*(part+1)/nParts);
+      for (auto it = range.begin(); it != range.end(); ++it, ++i)
+        passed &= (i < nVertices) && (it.index() == vIndices[i]) && (it.coords() == vCoords[i]);
+    }
+    passed &= (i == nVertices);
+
+    i = 0;
+    for (int part = 0; part < nParts; ++part)
+    {
+      const auto range = refinement.eRange(level, nElements*part/nParts, nElements*(part+1)/nParts);
+      for (auto it = range.begin(); it != range.end(); ++it, ++i)
+        passed &= (i < nElements) && (it.index() == eIndices[i]) && (it.coords() == eCoords[i]);
+    }
+    passed &= (i == nElements);
+  }
+
+  if (!passed)
+    std::cerr << "Error: vRange() and eRange() do not agree with the iterators" << std::endl;
+  collect(result, passed);
+}
+
+/*!
+ * \brief Test seeking with random access iterators against incrementing
+ */
+template <class Iterator>
+bool checkRandomAccess(const Iterator &begin, const Iterator &end)
+{
+  const int n = end - begin;
+  bool passed = (n >= 0);
+
+  Iterator it = begin;
+  for (int i = 0; i < n; ++i, ++it)
+  {
+    const Iterator seek = begin + i;
+    passed &= (seek == it) && (seek.index() == it.index()) && (seek.coords() == it.coords())
+              && (it - begin == i) && (end - it == n - i) && (end - (n - i) == it);
+  }
+  passed &= (it == end);
+
+  for (int i = n; i > 0; --i)
+  {
+    --it;
+    passed &= (it == begin + (i-1)) && (it.index() == (begin + (i-1)).index())
+              && (it.coords() == (begin + (i-1)).coords());
+  }
+  return passed && (it == begin);
+}
+
+template <unsigned topologyId, class ct, unsigned coerceToId, int dim, class Level>
+void testRandomAccess(int &result, const Level &refinement)
+{
+  typedef Dune::StaticRefinement<topologyId, ct, coerceToId, dim> Refinement;
+
+  const bool passed = checkRandomAccess(Refinement::vBegin(refinement), Refinement::vEnd(refinement))
+                      && checkRandomAccess(Refinement::eBegin(refinement), Refinement::eEnd(refinement));
+  if (!passed)
+    std::cerr << "Error: random access iterators of " << GeometryType(topologyId, dim)
+              << " -> " << GeometryType(coerceToId, dim)
+              << " do not agree with incrementing" << std::endl;
+  collect(result, passed);
+}
+
+/*!
+ * \brief Test that forEachVertex() and forEachElement() agree with the
+ *        virtual iterators
+ */
+template <class ct, int dim, class Level>
+void testForEach(int &result, const Dune::GeometryType& elementType,
+                 const Dune::GeometryType& coerceTo, const Level &level)
+{
+  typedef Dune::VirtualRefinement<dim, ct> Refinement;
+  const Refinement &refinement = Dune::buildRefinement<dim, ct>(elementType, coerceTo);
+
+  bool passed = true;
+  typename Refinement::VertexIterator vSubIt = refinement.vBegin(level);
+  Dune::forEachVertex<dim, ct>(elementType, coerceTo, level, [&] (const auto &it) {
+      passed &= (vSubIt != refinement.vEnd(level)) && (it.index() == vSubIt.index()) && (it.coords() == vSubIt.coords());
+      ++vSubIt;
+    });
+  passed &= (vSubIt == refinement.vEnd(level));
+
+  typename Refinement::ElementIterator eSubIt = refinement.eBegin(level);
+  Dune::forEachElement<dim, ct>(elementType, coerceTo, level, [&] (const auto &it) {
+      passed &= (eSubIt != refinement.eEnd(level)) && (it.index() == eSubIt.index()) && (it.coords() == eSubIt.coords());
+      if (passed)
+      {
+        const auto vertexIndices = it.vertexIndices();
+        const typename Refinement::IndexVector expected = eSubIt.vertexIndices();
+        passed &= (int(expected.size()) == refinement.nCorners())
+                  && std::equal(expected.begin(), expected.end(), vertexIndices.begin());
+      }
+      ++eSubIt;
+    });
+  passed &= (eSubIt == refinement.eEnd(level));
+
+  if (!passed)
+    std::cerr << "Error: forEachVertex() and forEachElement() do not agree with the virtual iterators" << std::endl;
+  collect(result, passed);
+}
+
+/*!
+ * \brief Test that concurrent requests of a new table obtain the same table
+ */
+template <class ct, int dim>
+void testConcurrentTable(int &result, const Dune::GeometryType& elementType,
+                         const Dune::GeometryType& coerceTo, int level)
+{
+  const Dune::VirtualRefinement<dim, ct> &refinement = Dune::buildRefinement<dim, ct>(elementType, coerceTo);
+
+  typedef std::shared_ptr<const typename Dune::VirtualRefinement<dim, ct>::Table> TablePointer;
+  std::vector<TablePointer> tables(4);
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < tables.size(); ++i)
+    threads.emplace_back([&refinement, &tables, i, level] () { tables[i] = refinement.table(level); });
+  for (std::thread &thread : threads)
+    thread.join();
+
+  const bool passed = std::all_of(tables.begin(), tables.end(), [&tables] (const TablePointer &table) {
+      return table && (table == tables[0]);
+    });
+  if (!passed)
+    std::cerr << "Error: concurrent calls of table() obtained different tables" << std::endl;
+  collect(result, passed);
+}
+
 /*!
  * \brief Test virtual refinement for an element with a run-time type
  */
@@ -98,6 +356,107 @@ void testVirtualRefinement(int &result, const Dune::GeometryType& elementType,
       fail(result);
     }
   }
+
+  testExportLevel(result, elementRefinement, refinement);
+  testTable(result, elementRefinement, refinement, true);
+  testRanges(result, elementRefinement, refinement);
+  testForEach<ct, dim>(result, elementType, coerceTo, refinement);
+}
+
+/*!
+ * \brief Test that the subelements form a conforming refinement
+ *
+ * Every face of a subelement has to be shared with exactly one other
+ * subelement, unless it lies on the boundary of the refined element.  The
+ * faces are identified by the indices of their vertices, so coinciding
+ * vertices with different indices are detected, too.  The boundary faces
+ * have to cover the boundary of the refined element exactly.
+ */
+template <unsigned topologyId, class ct, unsigned coerceToId, int dim, class Level>
+void testConformity(int &result, const Level &level)
+{
+  typedef Dune::StaticRefinement<topologyId, ct, coerceToId, dim> Refinement;
+  typedef typename Refinement::ElementIterator eIterator;
+  typedef typename Refinement::VertexIterator vIterator;
+  typedef FieldVector<ct, dim> CoordVector;
+
+  std::vector<CoordVector> vertices;
+  const vIterator vSubEnd = Refinement::vEnd(level);
+  for (vIterator vSubIt = Refinement::vBegin(level); vSubIt != vSubEnd; ++vSubIt)
+    vertices.push_back(vSubIt.coords());
+
+  const ReferenceElement<ct, dim> &refElem = ReferenceElements<ct, dim>::general(GeometryType(topologyId, dim));
+  const ReferenceElement<ct, dim> &subRefElem = ReferenceElements<ct, dim>::general(GeometryType(coerceToId, dim));
+
+  bool passed = true;
+  std::map<std::vector<int>, int> faceCount;
+  std::map<std::vector<int>, ct> faceVolume;
+  const eIterator eSubEnd = Refinement::eEnd(level);
+  for (eIterator eSubIt = Refinement::eBegin(level); eSubIt != eSubEnd; ++eSubIt)
+  {
+    // the vertex indices are not necessarily ordered like the corners
+    const auto geometry = eSubIt.geometry();
+    const auto vertexIndices = eSubIt.vertexIndices();
+    std::vector<int> cornerIndex(geometry.corners(), -1);
+    for (int k = 0; k < geometry.corners(); ++k)
+      for (std::size_t i = 0; i < vertexIndices.size(); ++i)
+        if ((vertices[vertexIndices[i]] - geometry.corner(k)).two_norm() < 1e-12)
+          cornerIndex[k] = vertexIndices[i];
+    passed &= std::none_of(cornerIndex.begin(), cornerIndex.end(), [] (int i) { return i < 0; });
+
+    for (int f = 0; f < subRefElem.size(1); ++f)
+    {
+      std::vector<int> face;
+      std::vector<CoordVector> corners;
+      for (int j = 0; j < subRefElem.size(f, 1, dim); ++j)
+      {
+        const int k = subRefElem.subEntity(f, 1, j, dim);
+        face.push_back(cornerIndex[k]);
+        corners.push_back(geometry.corner(k));
+      }
+      std::sort(face.begin(), face.end());
+      ++faceCount[face];
+      faceVolume[face] = MultiLinearGeometry<ct, dim-1, dim>(subRefElem.type(f, 1), corners).volume();
+    }
+  }
+
+  ct boundaryVolume = 0;
+  for (const auto &face : faceCount)
+  {
+    passed &= (face.second <= 2);
+    if (face.second == 1)
+      boundaryVolume += faceVolume[face.first];
+  }
+  ct refBoundaryVolume = 0;
+  for (int f = 0; f < refElem.size(1); ++f)
+    refBoundaryVolume += refElem.template geometry<1>(f).volume();
+  passed &= (std::abs(boundaryVolume - refBoundaryVolume) < 1e-12);
+
+  if (!passed)
+    std::cerr << "Error: the refinement " << GeometryType(topologyId, dim) << " -> "
+              << GeometryType(coerceToId, dim) << " is not conforming" << std::endl;
+  collect(result, passed);
+}
+
+/*!
+ * \brief Test that the geometry of each subvertex is located at its
+ *        coordinates
+ */
+template <unsigned topologyId, class ct, unsigned coerceToId, int dim>
+void testVertexGeometry(int &result, int refinement)
+{
+  typedef Dune::StaticRefinement<topologyId, ct, coerceToId, dim> Refinement;
+  typedef typename Refinement::VertexIterator vIterator;
+
+  bool passed = true;
+  const vIterator vSubEnd = Refinement::vEnd(refinement);
+  for (vIterator vSubIt = Refinement::vBegin(refinement); vSubIt != vSubEnd; ++vSubIt)
+    passed &= ((vSubIt.geometry().corner(0) - vSubIt.coords()).two_norm() < 1e-12);
+  if (!passed)
+    std::cerr << "Error: the geometries of the subvertices of "
+              << GeometryType(topologyId, dim) << " -> " << GeometryType(coerceToId, dim)
+              << " level " << refinement << " are not located at their coordinates" << std::endl;
+  collect(result, passed);
 }
 
 /*!
@@ -132,6 +491,148 @@ void testStaticRefinementGeometry(int &result, int refinement)
     // Call the standard test for geometries
     collect(result, checkGeometry(vSubIt.geometry()));
   }
+
+  testExportLevel(result, Refinement(), refinement);
+  testTable(result, Refinement(), refinement, true);
+  testRanges(result, Refinement(), refinement);
+
+  // the exported corners are the corners of the subelement geometries
+  const int nCorners = Refinement::nCorners();
+  std::vector<ct> corners(Refinement::nElements(refinement)*nCorners*dim);
+  Refinement::exportLevel(refinement, nullptr, nullptr, corners.data());
+  for (eIterator eIt = Refinement::eBegin(refinement); eIt != eSubEnd; ++eIt)
+  {
+    const auto geometry = eIt.geometry();
+    for (int k = 0; k < nCorners; ++k)
+      for (int j = 0; j < dim; ++j)
+        if (std::abs(corners[(eIt.index()*nCorners + k)*dim + j] - geometry.corner(k)[j]) > 1e-12)
+        {
+          std::cerr << "Error: exported corner " << k << " of subelement " << eIt.index()
+                    << " differs from the corner of its geometry" << std::endl;
+          fail(result);
+        }
+  }
+}
+
+/*!
+ * \brief Test a refinement with the given (anisotropic or graded) intervals
+ *
+ * The subelements have to be valid geometries that cover the reference
+ * element, and their vertex indices have to refer to their corners.
+ * Except for the pyramid refinement, the subelements have to be conforming
+ * (see testConformity()), and triangulations of hypercubes and prisms have
+ * to be positively oriented.
+ */
+template <unsigned topologyId, class ct, unsigned coerceToId, int dim>
+void testIntervals(int &result, const RefinementIntervals<dim> &intervals)
+{
+  const GeometryType type(topologyId, dim), coerceTo(coerceToId, dim);
+  std::cout << "Checking refinement " << type << " -> " << coerceTo << " with intervals";
+  for (int d = 0; d < dim; ++d)
+    std::cout << " " << intervals.intervals(d) << " (ratio " << intervals.ratio(d) << ")";
+  std::cout << std::endl;
+
+  typedef Dune::StaticRefinement<topologyId, ct, coerceToId, dim> Refinement;
+  typedef typename Refinement::ElementIterator eIterator;
+  typedef typename Refinement::VertexIterator vIterator;
+  typedef typename Refinement::CoordVector CoordVector;
+
+  const ReferenceElement<ct, dim> &refElem = ReferenceElements<ct, dim>::general(type);
+  bool passed = true;
+
+  std::vector<CoordVector> vertices;
+  const vIterator vSubEnd = Refinement::vEnd(intervals);
+  for (vIterator vSubIt = Refinement::vBegin(intervals); vSubIt != vSubEnd; ++vSubIt)
+  {
+    const CoordVector x = vSubIt.coords();
+    collect(result, checkGeometry(vSubIt.geometry()));
+    passed &= refElem.checkInside(x) && ((vSubIt.geometry().corner(0) - x).two_norm() < 1e-12);
+    vertices.push_back(x);
+  }
+  passed &= (int(vertices.size()) == Refinement::nVertices(intervals));
+  if (!passed)
+    std::cerr << "Error: subvertices are not inside of the reference element" << std::endl;
+
+  // the pyramid refinement duplicates the vertices of its two Kuhn simplices
+  if (!type.isPyramid())
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+      for (std::size_t j = 0; j < i; ++j)
+        if ((vertices[i] - vertices[j]).two_norm() < 1e-12)
+        {
+          std::cerr << "Error: subvertices " << j << " and " << i << " coincide" << std::endl;
+          passed = false;
+        }
+
+  ct volume = 0;
+  int nElements = 0;
+  const eIterator eSubEnd = Refinement::eEnd(intervals);
+  for (eIterator eSubIt = Refinement::eBegin(intervals); eSubIt != eSubEnd; ++eSubIt, ++nElements)
+  {
+    const auto geometry = eSubIt.geometry();
+    collect(result, checkGeometry(geometry));
+    volume += geometry.volume();
+    passed &= refElem.checkInside(eSubIt.coords());
+    passed &= ((eSubIt.coords() - geometry.center()).two_norm() < 1e-12);
+
+    // the vertex indices refer to the corners, possibly in another order
+    const auto vertexIndices = eSubIt.vertexIndices();
+    for (int k = 0; k < geometry.corners(); ++k)
+      passed &= std::any_of(vertexIndices.begin(), vertexIndices.end(), [&] (int i) {
+          return (0 <= i) && (i < int(vertices.size())) && ((vertices[i] - geometry.corner(k)).two_norm() < 1e-12);
+        });
+
+    if (coerceTo.isSimplex() && (type.isCube() || type.isPrism()))
+    {
+      FieldMatrix<ct, dim, dim> jacobian;
+      for (int i = 0; i < dim; ++i)
+        jacobian[i] = vertices[vertexIndices[i+1]] - vertices[vertexIndices[0]];
+      passed &= (jacobian.determinant() > 0);
+    }
+  }
+  passed &= (nElements == Refinement::nElements(intervals));
+  if (!passed)
+    std::cerr << "Error: subelements do not agree with the subvertices" << std::endl;
+  if (std::abs(volume - refElem.volume()) > 1e-12)
+  {
+    std::cerr << "Error: subelements do not cover the reference element" << std::endl;
+    passed = false;
+  }
+  collect(result, passed);
+
+  if (!type.isPyramid())
+    testConformity<topologyId, ct, coerceToId, dim>(result, intervals);
+
+  testExportLevel(result, Refinement(), intervals);
+  testTable(result, Refinement(), intervals, false);
+  testRanges(result, Refinement(), intervals);
+
+  const VirtualRefinement<dim, ct> &refinement = buildRefinement<dim, ct>(type, coerceTo);
+  collect(result, (refinement.nVertices(intervals) == Refinement::nVertices(intervals))
+                  && (refinement.nElements(intervals) == Refinement::nElements(intervals)));
+  testExportLevel(result, refinement, intervals);
+  testTable(result, refinement, intervals, false);
+  testRanges(result, refinement, intervals);
+  testForEach<ct, dim>(result, type, coerceTo, intervals);
+}
+
+/*!
+ * \brief Test that unsupported intervals raise NotImplemented
+ */
+template <unsigned topologyId, class ct, unsigned coerceToId, int dim>
+void testUnsupportedIntervals(int &result, const RefinementIntervals<dim> &intervals)
+{
+  typedef Dune::StaticRefinement<topologyId, ct, coerceToId, dim> Refinement;
+  const VirtualRefinement<dim, ct> &refinement
+    = buildRefinement<dim, ct>(GeometryType(topologyId, dim), GeometryType(coerceToId, dim));
+
+  int nThrown = 0;
+  try { Refinement::nElements(intervals); } catch (const NotImplemented &) { ++nThrown; }
+  try { Refinement::vBegin(intervals); } catch (const NotImplemented &) { ++nThrown; }
+  try { refinement.eBegin(intervals); } catch (const NotImplemented &) { ++nThrown; }
+  if (nThrown != 3)
+    std::cerr << "Error: unsupported intervals of " << GeometryType(topologyId, dim)
+              << " -> " << GeometryType(coerceToId, dim) << " were accepted" << std::endl;
+  collect(result, nThrown == 3);
 }
 
 
@@ -243,6 +744,72 @@ int main(int argc, char** argv) try
       (result, refinement);
   }
 
+  // a level not used above
+  testConcurrentTable<double,3>(result, gt1, gt2, 4);
+
+  // the refinements are conforming (except for the pyramid, whose
+  // subelements are refined independently)
+  for (unsigned int refinement = 0; refinement < 3; refinement++)
+  {
+    testConformity<Line::id,double,Line::id,1>(result, refinement);
+    testConformity<Triangle::id,double,Triangle::id,2>(result, refinement);
+    testConformity<Square::id,double,Square::id,2>(result, refinement);
+    testConformity<Square::id,double,Triangle::id,2>(result, refinement);
+    testConformity<Tet::id,double,Tet::id,3>(result, refinement);
+    testConformity<Prism::id,double,Tet::id,3>(result, refinement);
+    testConformity<Cube::id,double,Cube::id,3>(result, refinement);
+    testConformity<Cube::id,double,Tet::id,3>(result, refinement);
+  }
+
+  // the geometries of the subvertices are located at their coordinates
+  for (unsigned int refinement = 0; refinement < 3; refinement++)
+  {
+    testVertexGeometry<Line::id,double,Line::id,1>(result, refinement);
+    testVertexGeometry<Triangle::id,double,Triangle::id,2>(result, refinement);
+    testVertexGeometry<Square::id,double,Square::id,2>(result, refinement);
+    testVertexGeometry<Square::id,double,Triangle::id,2>(result, refinement);
+    testVertexGeometry<Tet::id,double,Tet::id,3>(result, refinement);
+    testVertexGeometry<Pyramid::id,double,Tet::id,3>(result, refinement);
+    testVertexGeometry<Prism::id,double,Tet::id,3>(result, refinement);
+    testVertexGeometry<Cube::id,double,Cube::id,3>(result, refinement);
+    testVertexGeometry<Cube::id,double,Tet::id,3>(result, refinement);
+  }
+
+  // the iterators are random access, except for the pyramid refinement
+  for (unsigned int refinement = 0; refinement < 5; refinement++)
+  {
+    testRandomAccess<Line::id,double,Line::id,1>(result, refinement);
+    testRandomAccess<Triangle::id,double,Triangle::id,2>(result, refinement);
+    testRandomAccess<Square::id,double,Square::id,2>(result, refinement);
+    testRandomAccess<Square::id,double,Triangle::id,2>(result, refinement);
+    testRandomAccess<Tet::id,double,Tet::id,3>(result, refinement);
+    testRandomAccess<Prism::id,double,Tet::id,3>(result, refinement);
+    testRandomAccess<Cube::id,double,Cube::id,3>(result, refinement);
+    testRandomAccess<Cube::id,double,Tet::id,3>(result, refinement);
+  }
+
+  // anisotropic and graded refinement
+  testIntervals<Line::id,double,Line::id,1>(result, RefinementIntervals<1>(5).grade(0, 0.5));
+  testIntervals<Triangle::id,double,Triangle::id,2>(result, RefinementIntervals<2>(3));
+  testIntervals<Square::id,double,Square::id,2>(result, RefinementIntervals<2>(std::array<int, 2>{{3, 5}}).grade(1, 2.0));
+  testIntervals<Square::id,double,Triangle::id,2>(result, RefinementIntervals<2>(std::array<int, 2>{{4, 1}}).grade(0, 0.7));
+  testIntervals<Tet::id,double,Tet::id,3>(result, RefinementIntervals<3>(3));
+  testIntervals<Pyramid::id,double,Tet::id,3>(result, RefinementIntervals<3>(3));
+  testIntervals<Prism::id,double,Tet::id,3>(result, RefinementIntervals<3>(std::array<int, 3>{{3, 3, 5}}).grade(2, 0.5));
+  testIntervals<Cube::id,double,Cube::id,3>(result, RefinementIntervals<3>(std::array<int, 3>{{2, 3, 4}}).grade(0, 0.5).grade(2, 3.0));
+  testIntervals<Cube::id,double,Tet::id,3>(result, RefinementIntervals<3>(std::array<int, 3>{{2, 3, 4}}).grade(1, 0.5));
+
+  testRandomAccess<Square::id,double,Square::id,2>(result, RefinementIntervals<2>(std::array<int, 2>{{3, 5}}));
+  testRandomAccess<Square::id,double,Triangle::id,2>(result, RefinementIntervals<2>(std::array<int, 2>{{4, 1}}));
+  testRandomAccess<Prism::id,double,Tet::id,3>(result, RefinementIntervals<3>(std::array<int, 3>{{3, 3, 5}}));
+  testRandomAccess<Cube::id,double,Tet::id,3>(result, RefinementIntervals<3>(std::array<int, 3>{{2, 3, 4}}));
+
+  testUnsupportedIntervals<Triangle::id,double,Triangle::id,2>(result, RefinementIntervals<2>(std::array<int, 2>{{2, 4}}));
+  testUnsupportedIntervals<Tet::id,double,Tet::id,3>(result, RefinementIntervals<3>(2).grade(0, 0.5));
+  testUnsupportedIntervals<Pyramid::id,double,Tet::id,3>(result, RefinementIntervals<3>(std::array<int, 3>{{2, 2, 3}}));
+  testUnsupportedIntervals<Prism::id,double,Tet::id,3>(result, RefinementIntervals<3>(std::array<int, 3>{{2, 3, 4}}));
+  testUnsupportedIntervals<Prism::id,double,Tet::id,3>(result, RefinementIntervals<3>(2).grade(1, 0.5));
+
   return result;
 
 }
@@ -0,0 +1,80 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#include <config.h>
+
+#include <initializer_list>
+#include <iostream>
+#include <utility>
+
+#include <dune/geometry/referenceelements.hh>
+#include <dune/geometry/staticreferenceelements.hh>
+#include <dune/geometry/type.hh>
+
+// all tables must be available in constant expressions
+static_assert( Dune::StaticCubeReferenceElement< double, 3 >::size( 2 ) == 12, "Wrong number of edges." );
+static_assert( Dune::StaticCubeReferenceElement< double, 3 >::size( 4, 1, 3 ) == 4, "Wrong number of face vertices." );
+static_assert( Dune::StaticSimplexReferenceElement< double, 2 >::subEntity( 2, 1, 1, 2 ) == 2, "Wrong edge numbering." );
+static_assert( Dune::StaticSimplexReferenceElement< double, 2 >::type( 0, 1 ).dim() == 1, "Wrong subentity type." );
+static_assert( Dune::StaticSimplexReferenceElement< double, 3 >::volume() == 1.0 / 6.0, "Wrong volume." );
+static_assert( Dune::StaticCubeReferenceElement< double, 2 >::position( 0, 0, 1 ) == 0.5, "Wrong barycenter." );
+static_assert( Dune::StaticCubeReferenceElement< double, 2 >::integrationOuterNormal( 3, 1 ) == 1.0, "Wrong normal." );
+
+template< class ctype, unsigned int topologyId, int dim >
+static bool testStaticReferenceElement ()
+{
+  typedef Dune::StaticReferenceElement< ctype, topologyId, dim > StaticReferenceElement;
+
+  const Dune::GeometryType type( topologyId, dim );
+  const auto &refElement = Dune::ReferenceElements< ctype, dim >::general( type );
+
+  bool pass = true;
+  auto check = [ &pass, &type ] ( bool condition, const char *what ) {
+      if( !condition )
+      {
+        std::cerr << "Error: static reference element for " << type << " has wrong " << what << "." << std::endl;
+        pass = false;
+      }
+    };
+
+  check( StaticReferenceElement::type() == refElement.type(), "type" );
+  check( StaticReferenceElement::volume() == refElement.volume(), "volume" );
+  for( int c = 0; c <= dim; ++c )
+  {
+    check( StaticReferenceElement::size( c ) == refElement.size( c ), "size" );
+    for( int i = 0; i < refElement.size( c ); ++i )
+    {
+      check( StaticReferenceElement::type( i, c ) == refElement.type( i, c ), "subentity type" );
+      check( StaticReferenceElement::position( i, c ) == refElement.position( i, c ), "position" );
+      for( int cc = c; cc <= dim; ++cc )
+      {
+        check( StaticReferenceElement::size( i, c, cc ) == refElement.size( i, c, cc ), "subentity size" );
+        for( int ii = 0; ii < refElement.size( i, c, cc ); ++ii )
+          check( StaticReferenceElement::subEntity( i, c, ii, cc ) == refElement.subEntity( i, c, ii, cc ), "subentity numbering" );
+      }
+    }
+  }
+  for( int face = 0; face < (dim > 0 ? refElement.size( 1 ) : 0); ++face )
+    check( StaticReferenceElement::integrationOuterNormal( face ) == refElement.integrationOuterNormal( face ), "integration outer normal" );
+
+  return pass;
+}
+
+template< class ctype, int dim, unsigned int... topologyId >
+static bool testStaticReferenceElements ( std::integer_sequence< unsigned int, topologyId... > )
+{
+  bool pass = true;
+  std::initializer_list< bool >{ (pass &= testStaticReferenceElement< ctype, topologyId, dim >())... };
+  return pass;
+}
+
+int main ( int argc, char **argv )
+{
+  bool pass = true;
+
+  pass &= testStaticReferenceElements< double, 0 >( std::make_integer_sequence< unsigned int, 1 >() );
+  pass &= testStaticReferenceElements< double, 1 >( std::make_integer_sequence< unsigned int, 2 >() );
+  pass &= testStaticReferenceElements< double, 2 >( std::make_integer_sequence< unsigned int, 4 >() );
+  pass &= testStaticReferenceElements< double, 3 >( std::make_integer_sequence< unsigned int, 8 >() );
+
+  return (pass ? 0 : 1);
+}
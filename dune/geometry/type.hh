@@ -95,7 +95,7 @@ namespace Dune
      *
      *  \returns number of topologies for the dimension
      */
-    inline static unsigned int numTopologies ( int dim ) noexcept
+    inline static constexpr unsigned int numTopologies ( int dim ) noexcept
     {
       return (1u << dim);
     }
@@ -111,7 +111,7 @@ namespace Dune
      *  \returns true, if a pyramid construction was used to generate the
      *           codimension the topology.
      */
-    inline bool static isPyramid ( unsigned int topologyId, int dim, int codim = 0 ) noexcept
+    inline static constexpr bool isPyramid ( unsigned int topologyId, int dim, int codim = 0 ) noexcept
     {
       assert( (dim > 0) && (topologyId < numTopologies( dim )) );
       assert( (0 <= codim) && (codim < dim) );
@@ -129,7 +129,7 @@ namespace Dune
      *  \returns true, if a prism construction was used to generate the
      *           codimension the topology.
      */
-    inline static bool isPrism ( unsigned int topologyId, int dim, int codim = 0 ) noexcept
+    inline static constexpr bool isPrism ( unsigned int topologyId, int dim, int codim = 0 ) noexcept
     {
       assert( (dim > 0) && (topologyId < numTopologies( dim )) );
       assert( (0 <= codim) && (codim < dim) );
@@ -148,7 +148,7 @@ namespace Dune
      *  \returns true, if construction was used to generate the codimension the
      *           topology.
      */
-    inline static bool isTopology ( TopologyConstruction construction, unsigned int topologyId, int dim, int codim = 0 ) noexcept
+    inline static constexpr bool isTopology ( TopologyConstruction construction, unsigned int topologyId, int dim, int codim = 0 ) noexcept
     {
       assert( (dim > 0) && (topologyId < numTopologies( dim )) );
       assert( (0 <= codim) && (codim <= dim) );
@@ -162,7 +162,7 @@ namespace Dune
      *  \param[in]  codim         codimension for which the information is desired
      *                            (defaults to 1)
      */
-    inline static unsigned int baseTopologyId ( unsigned int topologyId, int dim, int codim = 1 ) noexcept
+    inline static constexpr unsigned int baseTopologyId ( unsigned int topologyId, int dim, int codim = 1 ) noexcept
     {
       assert( (dim >= 0) && (topologyId < numTopologies( dim )) );
       assert( (0 <= codim) && (codim <= dim) );
@@ -303,7 +303,7 @@ namespace Dune
 
   public:
     /** \brief Default constructor, not initializing anything */
-    GeometryType ()
+    constexpr GeometryType ()
       : topologyId_(0), dim_(0), none_(true)
     {}
 
@@ -348,7 +348,7 @@ namespace Dune
      *       the TypologyType, users are encouraged to use the
      *       GeometryType(TopologyType t) constructor.
      */
-    GeometryType(unsigned int topologyId, unsigned int dim)
+    constexpr GeometryType(unsigned int topologyId, unsigned int dim)
       : topologyId_(topologyId), dim_(dim), none_(false)
     {}
 
@@ -525,17 +525,17 @@ namespace Dune
     }
 
     /** \brief Return true if entity is a singular of any dimension */
-    bool isNone() const {
+    constexpr bool isNone() const {
       return none_;
     }
 
     /** \brief Return dimension of the type */
-    unsigned int dim() const {
+    constexpr unsigned int dim() const {
       return dim_;
     }
 
     /** \brief Return the topology id of the type */
-    unsigned int id() const {
+    constexpr unsigned int id() const {
       return topologyId_;
     }
 
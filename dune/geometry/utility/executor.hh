@@ -0,0 +1,144 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_GEOMETRY_UTILITY_EXECUTOR_HH
+#define DUNE_GEOMETRY_UTILITY_EXECUTOR_HH
+
+/** \file
+ *  \brief executors distributing ranges of indices for batched kernels
+ *
+ *  An executor is a callable object taking an index range [first, last) and
+ *  a functor f.  It must call <tt>f( begin, end )</tt> on disjoint
+ *  subranges covering [first, last) and return only after all calls have
+ *  completed.  Any type satisfying this, e.g., a thin wrapper around a work
+ *  stealing scheduler, can be passed to the batched kernels of
+ *  MultiLinearGeometryStore.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace Dune
+{
+
+  // SerialExecutor
+  // --------------
+
+  /** \brief executor processing an index range in the calling thread */
+  struct SerialExecutor
+  {
+    template< class F >
+    void operator() ( std::size_t first, std::size_t last, F &&f ) const
+    {
+      if( first < last )
+        f( first, last );
+    }
+  };
+
+
+
+  // ThreadExecutor
+  // --------------
+
+  /** \brief executor splitting an index range into contiguous chunks, each
+   *         processed by its own std::thread
+   *
+   *  The calling thread processes the first chunk itself.  If any chunk
+   *  throws, the first exception (in chunk order) is rethrown after all
+   *  threads have been joined.  If a thread cannot be started, the threads
+   *  already started are joined before the error is rethrown.
+   *
+   *  \note This is a simple reference executor: Each call starts and joins
+   *        its own threads, so it only pays off for ranges whose work
+   *        clearly exceeds the cost of thread creation.  Applications with
+   *        many small batches should pass an executor wrapping a persistent
+   *        thread pool instead.
+   */
+  class ThreadExecutor
+  {
+  public:
+    /** \brief constructor
+     *
+     *  \param[in]  numThreads  maximum number of threads to use (0 selects
+     *                          std::thread::hardware_concurrency())
+     *  \param[in]  grainSize   minimum number of indices per chunk
+     */
+    explicit ThreadExecutor ( unsigned int numThreads = 0, std::size_t grainSize = 1 )
+      : numThreads_( numThreads > 0 ? numThreads : std::max( std::thread::hardware_concurrency(), 1u ) ),
+        grainSize_( std::max( grainSize, std::size_t( 1 ) ) )
+    {}
+
+    /** \brief obtain the maximum number of threads used */
+    unsigned int numThreads () const { return numThreads_; }
+
+    /** \brief obtain the minimum number of indices per chunk */
+    std::size_t grainSize () const { return grainSize_; }
+
+    template< class F >
+    void operator() ( std::size_t first, std::size_t last, F &&f ) const
+    {
+      if( first >= last )
+        return;
+
+      const std::size_t size = last - first;
+      const std::size_t chunks = std::min( std::size_t( numThreads_ ), (size + grainSize_ - 1) / grainSize_ );
+      if( chunks <= 1 )
+      {
+        f( first, last );
+        return;
+      }
+
+      // distribute the remainder over the first chunks
+      auto begin = [ first, size, chunks ] ( std::size_t c ) {
+        return first + c*(size / chunks) + std::min( c, size % chunks );
+      };
+
+      std::vector< std::exception_ptr > errors( chunks );
+      auto run = [ &f, &errors, &begin ] ( std::size_t c ) {
+        try
+        {
+          f( begin( c ), begin( c+1 ) );
+        }
+        catch( ... )
+        {
+          errors[ c ] = std::current_exception();
+        }
+      };
+
+      std::vector< std::thread > threads;
+      auto join = [ &threads ] () {
+        for( std::thread &thread : threads )
+          thread.join();
+      };
+      try
+      {
+        threads.reserve( chunks-1 );
+        for( std::size_t c = 1; c < chunks; ++c )
+          threads.emplace_back( run, c );
+      }
+      catch( ... )
+      {
+        // the running threads reference f and errors on this stack frame
+        join();
+        throw;
+      }
+      run( 0 );
+      join();
+
+      for( const std::exception_ptr &error : errors )
+      {
+        if( error )
+          std::rethrow_exception( error );
+      }
+    }
+
+  private:
+    unsigned int numThreads_;
+    std::size_t grainSize_;
+  };
+
+} // namespace Dune
+
+#endif // #ifndef DUNE_GEOMETRY_UTILITY_EXECUTOR_HH
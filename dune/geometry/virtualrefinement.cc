@@ -10,7 +10,11 @@
  */
 
 #include <cassert>
+#include <iterator>
+#include <memory>
+#include <type_traits>
 #include <typeinfo>
+#include <utility>
 
 #include <dune/common/exceptions.hh>
 #include <dune/common/fvector.hh>
@@ -35,7 +39,7 @@ namespace Dune
   VirtualRefinement<dimension, CoordType>::
   vBegin(int level) const
   {
-    return VertexIterator(vBeginBack(level));
+    return vBegin(Intervals::level(level));
   }
 
   template<int dimension, class CoordType>
@@ -43,7 +47,41 @@ namespace Dune
   VirtualRefinement<dimension, CoordType>::
   vEnd(int level) const
   {
-    return VertexIterator(vEndBack(level));
+    return vEnd(Intervals::level(level));
+  }
+
+  template<int dimension, class CoordType>
+  IteratorRange<typename VirtualRefinement<dimension, CoordType>::VertexIterator>
+  VirtualRefinement<dimension, CoordType>::
+  vRange(int level, int first, int last) const
+  {
+    return vRange(Intervals::level(level), first, last);
+  }
+
+  template<int dimension, class CoordType>
+  typename VirtualRefinement<dimension, CoordType>::VertexIterator
+  VirtualRefinement<dimension, CoordType>::
+  vBegin(const Intervals &intervals) const
+  {
+    return VertexIterator(vBeginBack(intervals));
+  }
+
+  template<int dimension, class CoordType>
+  typename VirtualRefinement<dimension, CoordType>::VertexIterator
+  VirtualRefinement<dimension, CoordType>::
+  vEnd(const Intervals &intervals) const
+  {
+    return VertexIterator(vEndBack(intervals));
+  }
+
+  template<int dimension, class CoordType>
+  IteratorRange<typename VirtualRefinement<dimension, CoordType>::VertexIterator>
+  VirtualRefinement<dimension, CoordType>::
+  vRange(const Intervals &intervals, int first, int last) const
+  {
+    assert(0 <= first && first <= last && last <= nVertices(intervals));
+    return IteratorRange<VertexIterator>(VertexIterator(vSeekBack(intervals, first)),
+                                         VertexIterator(vSeekBack(intervals, last)));
   }
 
   template<int dimension, class CoordType>
@@ -51,7 +89,7 @@ namespace Dune
   VirtualRefinement<dimension, CoordType>::
   eBegin(int level) const
   {
-    return ElementIterator(eBeginBack(level));
+    return eBegin(Intervals::level(level));
   }
 
   template<int dimension, class CoordType>
@@ -59,7 +97,41 @@ namespace Dune
   VirtualRefinement<dimension, CoordType>::
   eEnd(int level) const
   {
-    return ElementIterator(eEndBack(level));
+    return eEnd(Intervals::level(level));
+  }
+
+  template<int dimension, class CoordType>
+  IteratorRange<typename VirtualRefinement<dimension, CoordType>::ElementIterator>
+  VirtualRefinement<dimension, CoordType>::
+  eRange(int level, int first, int last) const
+  {
+    return eRange(Intervals::level(level), first, last);
+  }
+
+  template<int dimension, class CoordType>
+  typename VirtualRefinement<dimension, CoordType>::ElementIterator
+  VirtualRefinement<dimension, CoordType>::
+  eBegin(const Intervals &intervals) const
+  {
+    return ElementIterator(eBeginBack(intervals));
+  }
+
+  template<int dimension, class CoordType>
+  typename VirtualRefinement<dimension, CoordType>::ElementIterator
+  VirtualRefinement<dimension, CoordType>::
+  eEnd(const Intervals &intervals) const
+  {
+    return ElementIterator(eEndBack(intervals));
+  }
+
+  template<int dimension, class CoordType>
+  IteratorRange<typename VirtualRefinement<dimension, CoordType>::ElementIterator>
+  VirtualRefinement<dimension, CoordType>::
+  eRange(const Intervals &intervals, int first, int last) const
+  {
+    assert(0 <= first && first <= last && last <= nElements(intervals));
+    return IteratorRange<ElementIterator>(ElementIterator(eSeekBack(intervals, first)),
+                                          ElementIterator(eSeekBack(intervals, last)));
   }
 
   //
@@ -264,17 +336,29 @@ namespace Dune
     template<int codimension>
     class SubEntityIteratorBack;
 
+    typedef typename VirtualRefinement::Intervals Intervals;
+
     int nVertices(int level) const;
+    int nVertices(const Intervals &intervals) const;
     int nElements(int level) const;
+    int nElements(const Intervals &intervals) const;
+
+    int nCorners() const;
+    void exportLevel(int level, CoordType *coords, int *connectivity, CoordType *corners) const;
+    void exportLevel(const Intervals &intervals, CoordType *coords, int *connectivity, CoordType *corners) const;
+    std::shared_ptr<const typename VirtualRefinement::Table> table(int level) const;
+    std::shared_ptr<const typename VirtualRefinement::Table> table(const Intervals &intervals) const;
 
     static VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension> &instance();
   private:
     VirtualRefinementImp() {}
 
-    typename VirtualRefinement::VertexIteratorBack *vBeginBack(int level) const;
-    typename VirtualRefinement::VertexIteratorBack *vEndBack(int level) const;
-    typename VirtualRefinement::ElementIteratorBack *eBeginBack(int level) const;
-    typename VirtualRefinement::ElementIteratorBack *eEndBack(int level) const;
+    typename VirtualRefinement::VertexIteratorBack *vBeginBack(const Intervals &intervals) const;
+    typename VirtualRefinement::VertexIteratorBack *vEndBack(const Intervals &intervals) const;
+    typename VirtualRefinement::ElementIteratorBack *eBeginBack(const Intervals &intervals) const;
+    typename VirtualRefinement::ElementIteratorBack *eEndBack(const Intervals &intervals) const;
+    typename VirtualRefinement::VertexIteratorBack *vSeekBack(const Intervals &intervals, int index) const;
+    typename VirtualRefinement::ElementIteratorBack *eSeekBack(const Intervals &intervals, int index) const;
   };
 
   template<unsigned topologyId, class CoordType,
@@ -294,19 +378,27 @@ namespace Dune
     return StaticRefinement::nVertices(level);
   }
 
+  template<unsigned topologyId, class CoordType,
+      unsigned coerceToId, int dimension>
+  int VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::
+  nVertices(const Intervals &intervals) const
+  {
+    return StaticRefinement::nVertices(intervals);
+  }
+
   template<unsigned topologyId, class CoordType,
       unsigned coerceToId, int dimension>
   typename VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::VirtualRefinement::VertexIteratorBack *
   VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::
-  vBeginBack(int level) const
-  { return new SubEntityIteratorBack<dimension>(StaticRefinement::vBegin(level)); }
+  vBeginBack(const Intervals &intervals) const
+  { return new SubEntityIteratorBack<dimension>(StaticRefinement::vBegin(intervals)); }
 
   template<unsigned topologyId, class CoordType,
       unsigned coerceToId, int dimension>
   typename VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::VirtualRefinement::VertexIteratorBack *
   VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::
-  vEndBack(int level) const
-  { return new SubEntityIteratorBack<dimension>(StaticRefinement::vEnd(level)); }
+  vEndBack(const Intervals &intervals) const
+  { return new SubEntityIteratorBack<dimension>(StaticRefinement::vEnd(intervals)); }
 
   template<unsigned topologyId, class CoordType,
       unsigned coerceToId, int dimension>
@@ -315,19 +407,82 @@ namespace Dune
     return StaticRefinement::nElements(level);
   }
 
+  template<unsigned topologyId, class CoordType,
+      unsigned coerceToId, int dimension>
+  int VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::
+  nElements(const Intervals &intervals) const
+  {
+    return StaticRefinement::nElements(intervals);
+  }
+
+  template<unsigned topologyId, class CoordType,
+      unsigned coerceToId, int dimension>
+  typename VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::VirtualRefinement::ElementIteratorBack *
+  VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::
+  eBeginBack(const Intervals &intervals) const
+  { return new SubEntityIteratorBack<0>(StaticRefinement::eBegin(intervals)); }
+
   template<unsigned topologyId, class CoordType,
       unsigned coerceToId, int dimension>
   typename VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::VirtualRefinement::ElementIteratorBack *
   VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::
-  eBeginBack(int level) const
-  { return new SubEntityIteratorBack<0>(StaticRefinement::eBegin(level)); }
+  eEndBack(const Intervals &intervals) const
+  { return new SubEntityIteratorBack<0>(StaticRefinement::eEnd(intervals)); }
+
+  template<unsigned topologyId, class CoordType,
+      unsigned coerceToId, int dimension>
+  typename VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::VirtualRefinement::VertexIteratorBack *
+  VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::
+  vSeekBack(const Intervals &intervals, int index) const
+  { return new SubEntityIteratorBack<dimension>(std::next(StaticRefinement::vBegin(intervals), index)); }
 
   template<unsigned topologyId, class CoordType,
       unsigned coerceToId, int dimension>
   typename VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::VirtualRefinement::ElementIteratorBack *
   VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::
-  eEndBack(int level) const
-  { return new SubEntityIteratorBack<0>(StaticRefinement::eEnd(level)); }
+  eSeekBack(const Intervals &intervals, int index) const
+  { return new SubEntityIteratorBack<0>(std::next(StaticRefinement::eBegin(intervals), index)); }
+
+  template<unsigned topologyId, class CoordType,
+      unsigned coerceToId, int dimension>
+  int VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::nCorners() const
+  {
+    return StaticRefinement::nCorners();
+  }
+
+  template<unsigned topologyId, class CoordType,
+      unsigned coerceToId, int dimension>
+  void VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::
+  exportLevel(int level, CoordType *coords, int *connectivity, CoordType *corners) const
+  {
+    StaticRefinement::exportLevel(level, coords, connectivity, corners);
+  }
+
+  template<unsigned topologyId, class CoordType,
+      unsigned coerceToId, int dimension>
+  void VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::
+  exportLevel(const Intervals &intervals, CoordType *coords, int *connectivity, CoordType *corners) const
+  {
+    StaticRefinement::exportLevel(intervals, coords, connectivity, corners);
+  }
+
+  template<unsigned topologyId, class CoordType,
+      unsigned coerceToId, int dimension>
+  std::shared_ptr<const typename VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::VirtualRefinement::Table>
+  VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::
+  table(int level) const
+  {
+    return StaticRefinement::table(level);
+  }
+
+  template<unsigned topologyId, class CoordType,
+      unsigned coerceToId, int dimension>
+  std::shared_ptr<const typename VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::VirtualRefinement::Table>
+  VirtualRefinementImp<topologyId, CoordType, coerceToId, dimension>::
+  table(const Intervals &intervals) const
+  {
+    return StaticRefinement::table(intervals);
+  }
 
   //
   // The iterator backend implementation
@@ -499,6 +654,79 @@ namespace Dune
     return RefinementBuilder<dimension, CoordType>::build( geometryType.id(), coerceTo.id() );
   }
 
+  /*!
+   * \brief call f with each VertexIterator of the StaticRefinement
+   *        according to the parameters
+   *
+   * The StaticRefinement is selected once per call, the loop over the
+   * vertices contains neither virtual calls nor heap allocations.
+   *
+   * \tparam dimension Dimension of the element to refine
+   * \tparam CoordType C++ type of the coordinates
+   *
+   * \throws NotImplemented There is no Refinement implementation for
+   *                        the specified parameters.
+   */
+  template<int dimension, class CoordType, class F>
+  void forEachVertex( //! geometry type of the refined element
+    GeometryType geometryType,
+    //! geometry type of the subelements
+    GeometryType coerceTo,
+    //! intervals of the refinement
+    const RefinementIntervals<dimension> &intervals,
+    //! functor called with each VertexIterator
+    F &&f)
+  {
+    assert(geometryType.dim() == dimension && coerceTo.dim() == dimension);
+    RefinementBuilder<dimension, CoordType>::apply( geometryType.id(), coerceTo.id(), [&intervals, &f] (const auto &refinement) {
+        typedef typename std::decay_t<decltype(refinement)>::StaticRefinement StaticRefinement;
+        const typename StaticRefinement::VertexIterator end = StaticRefinement::vEnd(intervals);
+        for(typename StaticRefinement::VertexIterator it = StaticRefinement::vBegin(intervals); it != end; ++it)
+          f(static_cast<const typename StaticRefinement::VertexIterator &>(it));
+      } );
+  }
+
+  //! call f with each VertexIterator of a refinement level, see forEachVertex()
+  template<int dimension, class CoordType, class F>
+  void forEachVertex(GeometryType geometryType, GeometryType coerceTo, int level, F &&f)
+  {
+    forEachVertex<dimension, CoordType>(geometryType, coerceTo, RefinementIntervals<dimension>::level(level),
+                                        std::forward<F>(f));
+  }
+
+  /*!
+   * \brief call f with each ElementIterator of the StaticRefinement
+   *        according to the parameters
+   *
+   * See forEachVertex().
+   */
+  template<int dimension, class CoordType, class F>
+  void forEachElement( //! geometry type of the refined element
+    GeometryType geometryType,
+    //! geometry type of the subelements
+    GeometryType coerceTo,
+    //! intervals of the refinement
+    const RefinementIntervals<dimension> &intervals,
+    //! functor called with each ElementIterator
+    F &&f)
+  {
+    assert(geometryType.dim() == dimension && coerceTo.dim() == dimension);
+    RefinementBuilder<dimension, CoordType>::apply( geometryType.id(), coerceTo.id(), [&intervals, &f] (const auto &refinement) {
+        typedef typename std::decay_t<decltype(refinement)>::StaticRefinement StaticRefinement;
+        const typename StaticRefinement::ElementIterator end = StaticRefinement::eEnd(intervals);
+        for(typename StaticRefinement::ElementIterator it = StaticRefinement::eBegin(intervals); it != end; ++it)
+          f(static_cast<const typename StaticRefinement::ElementIterator &>(it));
+      } );
+  }
+
+  //! call f with each ElementIterator of a refinement level, see forEachElement()
+  template<int dimension, class CoordType, class F>
+  void forEachElement(GeometryType geometryType, GeometryType coerceTo, int level, F &&f)
+  {
+    forEachElement<dimension, CoordType>(geometryType, coerceTo, RefinementIntervals<dimension>::level(level),
+                                         std::forward<F>(f));
+  }
+
   // In principle the trick with the class is no longer necessary,
   // but I'm keeping it in here so it will be easier to specialize
   // buildRefinement when someone implements pyramids and prisms
@@ -509,6 +737,15 @@ namespace Dune
     static
     VirtualRefinement<dimension, CoordType> &
     build(unsigned topologyId, unsigned coerceToId)
+    {
+      return apply(topologyId, coerceToId, [] (VirtualRefinement<dimension, CoordType> &refinement) -> VirtualRefinement<dimension, CoordType> & {
+          return refinement;
+        });
+    }
+
+    //! call f with the VirtualRefinementImp for the given topology ids and return its result
+    template<class F>
+    static decltype(auto) apply(unsigned topologyId, unsigned coerceToId, F &&f)
     {
       topologyId &= ~1;
       coerceToId &= ~1;
@@ -525,7 +762,7 @@ namespace Dune
         {
         //case GeometryType::simplex:
         case idSimplex :
-          return VirtualRefinementImp< idSimplex, CoordType, idSimplex, dimension>::instance();
+          return f(VirtualRefinementImp< idSimplex, CoordType, idSimplex, dimension>::instance());
         default :
           break;
         }
@@ -536,9 +773,9 @@ namespace Dune
         switch( coerceToId )
         {
         case idSimplex :
-          return VirtualRefinementImp< idCube, CoordType, idSimplex, dimension>::instance();
+          return f(VirtualRefinementImp< idCube, CoordType, idSimplex, dimension>::instance());
         case idCube :
-          return VirtualRefinementImp< idCube, CoordType, idCube, dimension>::instance();
+          return f(VirtualRefinementImp< idCube, CoordType, idCube, dimension>::instance());
         default :
           break;
         }
@@ -560,6 +797,15 @@ namespace Dune
     static
     VirtualRefinement<dimension, CoordType> &
     build(unsigned topologyId, unsigned coerceToId)
+    {
+      return apply(topologyId, coerceToId, [] (VirtualRefinement<dimension, CoordType> &refinement) -> VirtualRefinement<dimension, CoordType> & {
+          return refinement;
+        });
+    }
+
+    //! call f with the VirtualRefinementImp for the given topology ids and return its result
+    template<class F>
+    static decltype(auto) apply(unsigned topologyId, unsigned coerceToId, F &&f)
     {
       topologyId &= ~1;
       coerceToId &= ~1;
@@ -567,7 +813,7 @@ namespace Dune
       const unsigned idSimplex = Impl::SimplexTopology<dimension>::type::id & ~1;
 
       if (topologyId == 0 && coerceToId == 0)
-        return VirtualRefinementImp< idSimplex, CoordType, idSimplex, dimension>::instance();
+        return f(VirtualRefinementImp< idSimplex, CoordType, idSimplex, dimension>::instance());
 
       DUNE_THROW( NotImplemented, "No Refinement<" << topologyId << ", CoordType, "
                                                    << coerceToId << " >.");
@@ -582,6 +828,15 @@ namespace Dune
     static
     VirtualRefinement<dimension, CoordType> &
     build(unsigned topologyId, unsigned coerceToId)
+    {
+      return apply(topologyId, coerceToId, [] (VirtualRefinement<dimension, CoordType> &refinement) -> VirtualRefinement<dimension, CoordType> & {
+          return refinement;
+        });
+    }
+
+    //! call f with the VirtualRefinementImp for the given topology ids and return its result
+    template<class F>
+    static decltype(auto) apply(unsigned topologyId, unsigned coerceToId, F &&f)
     {
       topologyId &= ~1;
       coerceToId &= ~1;
@@ -600,7 +855,7 @@ namespace Dune
         {
         //case GeometryType::simplex:
         case idSimplex :
-          return VirtualRefinementImp< idSimplex, CoordType, idSimplex, dimension>::instance();
+          return f(VirtualRefinementImp< idSimplex, CoordType, idSimplex, dimension>::instance());
         default :
           break;
         }
@@ -611,9 +866,9 @@ namespace Dune
         switch( coerceToId )
         {
         case idSimplex :
-          return VirtualRefinementImp< idCube, CoordType, idSimplex, dimension>::instance();
+          return f(VirtualRefinementImp< idCube, CoordType, idSimplex, dimension>::instance());
         case idCube :
-          return VirtualRefinementImp< idCube, CoordType, idCube, dimension>::instance();
+          return f(VirtualRefinementImp< idCube, CoordType, idCube, dimension>::instance());
         default :
           break;
         }
@@ -624,7 +879,7 @@ namespace Dune
         switch( coerceToId )
         {
         case idSimplex :
-          return VirtualRefinementImp< idPrism, CoordType, idSimplex, dimension>::instance();
+          return f(VirtualRefinementImp< idPrism, CoordType, idSimplex, dimension>::instance());
         default :
           break;
         }
@@ -635,7 +890,7 @@ namespace Dune
         switch( coerceToId )
         {
         case idSimplex :
-          return VirtualRefinementImp< idPyramid, CoordType, idSimplex, dimension>::instance();
+          return f(VirtualRefinementImp< idPyramid, CoordType, idSimplex, dimension>::instance());
         default :
           break;
         }
@@ -89,13 +89,23 @@
  *
  *   typedef IndexVector; // This is a std::vector
  *   typedef CoordVector; // This is a FieldVector
+ *   typedef Intervals;   // This is a RefinementIntervals<dimension>
  *
+ *   // each of the following also takes Intervals instead of a level
  *   virtual int nVertices(int level) const;
  *   VertexIterator vBegin(int level) const;
  *   VertexIterator vEnd(int level) const;
+ *   IteratorRange<VertexIterator> vRange(int level, int first, int last) const;
  *   virtual int nElements(int level) const;
  *   ElementIterator eBegin(int level) const;
  *   ElementIterator eEnd(int level) const;
+ *   IteratorRange<ElementIterator> eRange(int level, int first, int last) const;
+ *
+ *   virtual int nCorners() const;
+ *   virtual void exportLevel(int level, CoordType *coords, int *connectivity,
+ *                            CoordType *corners = nullptr) const;
+ *   virtual std::shared_ptr<const RefinementTable<dimension, CoordType> > table(int level) const;
+ *   virtual std::shared_ptr<const RefinementTable<dimension, CoordType> > table(const Intervals &intervals) const;
  * };
  * \endcode
  *
@@ -160,6 +170,35 @@
  * Summary: geometryType is the geometry type of the entity you want to
  * refine, while coerceTo is the geometry type of the subentities.
  *
+ * \subsection User_interface_forEach forEachVertex() and forEachElement()
+ * <!------------------------------------------------------------------>
+ *
+ * Each step of the VirtualRefinement iterators costs several virtual
+ * calls, and each copy of an iterator a heap allocation.  If the
+ * subentities of a level are visited in a loop anyway, use
+ *
+ * \code
+ * template<int dimension, class CoordType, class F>
+ * void forEachVertex(GeometryType geometryType, GeometryType coerceTo, int level, F &&f);
+ * template<int dimension, class CoordType, class F>
+ * void forEachElement(GeometryType geometryType, GeometryType coerceTo, int level, F &&f);
+ * \endcode
+ *
+ * instead.  They select the \link Refinement StaticRefinement\endlink
+ * for the pair of geometry types once and call f with each of its
+ * iterators, so the loop contains no virtual calls and no allocations.
+ * The type of the iterator depends on the geometry types, thus f is
+ * usually a generic lambda:
+ *
+ * \code
+ * forEachElement<2, double>(type, coerceTo, level, [&](const auto &it) {
+ *   std::cout << it.index() << ": " << it.coords() << std::endl;
+ * });
+ * \endcode
+ *
+ * Note that vertexIndices() of these iterators returns a FieldVector.
+ * Both functions also take RefinementIntervals instead of a level.
+ *
  * \section Virtual_Implementing Implementing a new Refinement type
  * <!--=================================================-->
  *
@@ -263,9 +302,11 @@
  * long as buildRefinement() is enough for the job.
  */
 
+#include <memory>
 #include <vector>
 
 #include <dune/common/fvector.hh>
+#include <dune/common/iteratorrange.hh>
 
 #include "refinement.hh"
 #include "type.hh"
@@ -310,6 +351,8 @@ namespace Dune
      * This is always a typedef to a std::vector
      */
     typedef std::vector<int> IndexVector;
+    //! The intervals of a refinement, see RefinementIntervals
+    typedef RefinementIntervals<dimension> Intervals;
 
     template<int codimension>
     class SubEntityIteratorBack;
@@ -322,6 +365,21 @@ namespace Dune
     VertexIterator vBegin(int level) const;
     //! Get a VertexIterator
     VertexIterator vEnd(int level) const;
+    /*!
+     * \brief Get the subvertices with indices first, ..., last-1
+     *
+     * See StaticRefinement::vRange().
+     */
+    IteratorRange<VertexIterator> vRange(int level, int first, int last) const;
+
+    //! Get the number of Vertices for the given intervals
+    virtual int nVertices(const Intervals &intervals) const = 0;
+    //! Get a VertexIterator for the given intervals
+    VertexIterator vBegin(const Intervals &intervals) const;
+    //! Get a VertexIterator for the given intervals
+    VertexIterator vEnd(const Intervals &intervals) const;
+    //! Get the subvertices for the given intervals with indices first, ..., last-1
+    IteratorRange<VertexIterator> vRange(const Intervals &intervals, int first, int last) const;
 
     //! Get the number of Elements
     virtual int nElements(int level) const = 0;
@@ -329,16 +387,69 @@ namespace Dune
     ElementIterator eBegin(int level) const;
     //! Get an ElementIterator
     ElementIterator eEnd(int level) const;
+    /*!
+     * \brief Get the subelements with indices first, ..., last-1
+     *
+     * See StaticRefinement::eRange().
+     */
+    IteratorRange<ElementIterator> eRange(int level, int first, int last) const;
+
+    //! Get the number of Elements for the given intervals
+    virtual int nElements(const Intervals &intervals) const = 0;
+    //! Get an ElementIterator for the given intervals
+    ElementIterator eBegin(const Intervals &intervals) const;
+    //! Get an ElementIterator for the given intervals
+    ElementIterator eEnd(const Intervals &intervals) const;
+    //! Get the subelements for the given intervals with indices first, ..., last-1
+    IteratorRange<ElementIterator> eRange(const Intervals &intervals, int first, int last) const;
+
+    //! Get the number of vertices of each subelement
+    virtual int nCorners() const = 0;
+
+    /*!
+     * \brief Write the subvertices and subelements of a level to flat
+     *        arrays
+     *
+     * This costs a single virtual call instead of several virtual calls
+     * and a heap allocated iterator copy per entity.  See
+     * StaticRefinement::exportLevel() for the layout of the arrays.
+     */
+    virtual void exportLevel(int level, CoordType *coords, int *connectivity,
+                             CoordType *corners = nullptr) const = 0;
+
+    //! Write the subvertices and subelements for the given intervals to flat arrays
+    virtual void exportLevel(const Intervals &intervals, CoordType *coords, int *connectivity,
+                             CoordType *corners = nullptr) const = 0;
+
+    //! The type of the tables returned by table()
+    typedef RefinementTable<dimension, CoordType> Table;
+
+    /*!
+     * \brief Get the shared table of a refinement level
+     *
+     * See StaticRefinement::table().
+     */
+    virtual std::shared_ptr<const Table> table(int level) const = 0;
+
+    /*!
+     * \brief Get the table of the given intervals
+     *
+     * Only the tables of refinement levels are shared, see
+     * StaticRefinement::table(const Intervals &).
+     */
+    virtual std::shared_ptr<const Table> table(const Intervals &intervals) const = 0;
 
     //! Destructor
     virtual ~VirtualRefinement()
     {}
 
   protected:
-    virtual VertexIteratorBack *vBeginBack(int level) const = 0;
-    virtual VertexIteratorBack *vEndBack(int level) const = 0;
-    virtual ElementIteratorBack *eBeginBack(int level) const = 0;
-    virtual ElementIteratorBack *eEndBack(int level) const = 0;
+    virtual VertexIteratorBack *vBeginBack(const Intervals &intervals) const = 0;
+    virtual VertexIteratorBack *vEndBack(const Intervals &intervals) const = 0;
+    virtual ElementIteratorBack *eBeginBack(const Intervals &intervals) const = 0;
+    virtual ElementIteratorBack *eEndBack(const Intervals &intervals) const = 0;
+    virtual VertexIteratorBack *vSeekBack(const Intervals &intervals, int index) const = 0;
+    virtual ElementIteratorBack *eSeekBack(const Intervals &intervals, int index) const = 0;
   };
 
   //! codim database of VirtualRefinement
@@ -358,6 +469,20 @@ namespace Dune
   VirtualRefinement<dimension, CoordType> &
   buildRefinement(GeometryType geometryType, GeometryType coerceTo);
 
+  template<int dimension, class CoordType, class F>
+  void forEachVertex(GeometryType geometryType, GeometryType coerceTo, int level, F &&f);
+
+  template<int dimension, class CoordType, class F>
+  void forEachVertex(GeometryType geometryType, GeometryType coerceTo,
+                     const RefinementIntervals<dimension> &intervals, F &&f);
+
+  template<int dimension, class CoordType, class F>
+  void forEachElement(GeometryType geometryType, GeometryType coerceTo, int level, F &&f);
+
+  template<int dimension, class CoordType, class F>
+  void forEachElement(GeometryType geometryType, GeometryType coerceTo,
+                      const RefinementIntervals<dimension> &intervals, F &&f);
+
 } // namespace Dune
 
 #include "virtualrefinement.cc"